@@ -1,8 +1,22 @@
 #pragma once
 
 #include "EngineCore/UI/UIPanel.hpp"
+#include "EngineCore/Config.hpp"
 #include "EngineCore/Renderer.hpp"
+#include "EngineCore/Assets/AssetCache.hpp"
+#include "EngineCore/Assets/MeshLoader.hpp"
+#include "EngineCore/Assets/TextureStreamer.hpp"
 #include "EngineCore/Camera.hpp"
+#include "EngineCore/Profiling/GpuProfiler.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Vulkan/BindlessTable.hpp"
+#include "EngineCore/Vulkan/DeletionQueue.hpp"
+#include "EngineCore/Vulkan/DescriptorAllocator.hpp"
+#include "EngineCore/Vulkan/DeviceFeatures.hpp"
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+#include "EngineCore/Vulkan/PipelineCache.hpp"
+#include "EngineCore/Vulkan/QueueFamilies.hpp"
+#include "EngineCore/Vulkan/UploadQueue.hpp"
 #include "EngineCore/Events/Event.hpp"
 #include "EngineCore/Events/ApplicationEvent.hpp"
 #include "EngineCore/Events/KeyEvent.hpp"
@@ -26,8 +40,9 @@ class Application
 public:
     /**
      * @brief Constructs the Application object.
+     * @param config The startup settings (frames in flight, etc.).
      */
-    Application();
+    explicit Application(const EngineConfig& config = EngineConfig());
 
     /**
      * @brief Destroys the Application object and cleans up resources.
@@ -36,6 +51,9 @@ public:
 
     /**
      * @brief Starts the main application loop.
+     *
+     * In headless mode this renders the configured number of offscreen frames
+     * instead, logs the timing statistics and returns.
      */
     void run();
 
@@ -50,6 +68,23 @@ public:
      */
     void OnEvent(Event& e);
 
+    /**
+     * @brief Writes the recent CPU profiling zones to a timestamped Chrome trace file.
+     */
+    void captureCpuTrace();
+
+    /**
+     * @brief Starts loading a mesh file in the background; it replaces the drawn mesh once uploaded.
+     * @param path The .obj or .glb file.
+     */
+    void loadMesh(const std::string& path);
+
+    /**
+     * @brief Starts loading a texture file in the background; it shows up in the texture panel and is mapped onto the scene.
+     * @param path The .ktx2 or .dds file.
+     */
+    void loadTexture(const std::string& path);
+
 private:
     // --- Initialization and Cleanup ---
 
@@ -78,6 +113,11 @@ private:
      */
     void mainLoop();
 
+    /**
+     * @brief Renders a fixed number of offscreen frames without a window and reports timings.
+     */
+    void runHeadless();
+
     /**
      * @brief Cleans up all allocated resources.
      */
@@ -105,6 +145,11 @@ private:
      */
     void createLogicalDevice();
 
+    /**
+     * @brief Creates the pipeline cache, loading it from disk if a valid cache file exists.
+     */
+    void createPipelineCache();
+
     /**
      * @brief Creates the swap chain for presenting images to the screen.
      */
@@ -149,11 +194,14 @@ private:
 
     /**
      * @brief Recreates the swap chain when the window is resized.
+     *
+     * The old swap chain, its views and framebuffers are retired to the
+     * deletion queue, so frames in flight are not waited for.
      */
     void recreateSwapChain();
 
     /**
-     * @brief Cleans up the old swap chain before recreation.
+     * @brief Destroys the swap chain, its views, framebuffers and the UI command buffers at shutdown.
      */
     void cleanupSwapChain();
 
@@ -209,30 +257,57 @@ private:
      */
     void processCameraKeyboardInput(float deltaTime);
 
+    /**
+     * @brief Casts a ray from the camera through a point of the viewport and reports the instance it hits.
+     * @param imagePosition The point in normalized viewport coordinates, (0, 0) being the top-left corner.
+     */
+    void pickInstance(const glm::vec2& imagePosition);
+
+    /**
+     * @brief Advances the mesh loader and hands the requested mesh to the renderer once it is ready.
+     */
+    void updateMeshes();
+
+    /**
+     * @brief Advances the texture streamer and points the scene material at the scene texture's current slot.
+     */
+    void updateTextures();
+
+    /**
+     * @brief Matches the camera to the viewport panel and resizes the scene image once the panel's size has settled.
+     * @param deltaTime The time since the last frame, in seconds.
+     */
+    void updateSceneExtent(float deltaTime);
+
     // --- Window and State ---
+    EngineConfig m_config;                ///< The validated startup settings.
     GLFWwindow* m_window = nullptr;       ///< Pointer to the GLFW window.
     const int m_width = 1280;             ///< The width of the window.
     const int m_height = 720;             ///< The height of the window.
     bool m_framebufferResized = false;    ///< Flag indicating if the framebuffer was resized.
 
     // --- Vulkan Objects ---
-    VkInstance m_instance;                ///< The Vulkan instance.
-    VkSurfaceKHR m_surface;               ///< The window surface.
+    VkInstance m_instance = VK_NULL_HANDLE; ///< The Vulkan instance.
+    VkSurfaceKHR m_surface = VK_NULL_HANDLE; ///< The window surface (none in headless mode).
     VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE; ///< The physical device (GPU).
-    VkDevice m_device;                    ///< The logical device.
-    VkQueue m_graphicsQueue;              ///< The graphics queue.
-    VkQueue m_presentQueue;               ///< The presentation queue.
-    VkSwapchainKHR m_swapChain;           ///< The swap chain.
+    VkDevice m_device = VK_NULL_HANDLE;   ///< The logical device.
+    VkQueue m_graphicsQueue = VK_NULL_HANDLE; ///< The graphics queue.
+    VkQueue m_presentQueue = VK_NULL_HANDLE; ///< The presentation queue.
+    VkQueue m_transferQueue = VK_NULL_HANDLE; ///< The dedicated transfer queue, null when uploads use the graphics queue.
+    QueueFamilies m_queueFamilies;        ///< The queue families picked for the physical device.
+    VkSwapchainKHR m_swapChain = VK_NULL_HANDLE; ///< The swap chain (none in headless mode).
     std::vector<VkImage> m_swapChainImages; ///< The images of the swap chain.
     VkFormat m_swapChainImageFormat;      ///< The image format of the swap chain.
     VkExtent2D m_swapChainExtent;         ///< The extent (resolution) of the swap chain.
     std::vector<VkImageView> m_swapChainImageViews; ///< The image views of the swap chain.
     std::vector<VkFramebuffer> m_swapChainFramebuffers; ///< The framebuffers for the swap chain.
-    VkRenderPass m_renderPass;            ///< The render pass.
-    VkDescriptorPool m_descriptorPool;    ///< The descriptor pool for ImGui.
-    VkCommandPool m_commandPool;          ///< The command pool.
+    VkRenderPass m_renderPass = VK_NULL_HANDLE; ///< The render pass.
+    VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE; ///< The descriptor pool for ImGui's font atlas.
+    VkCommandPool m_commandPool = VK_NULL_HANDLE; ///< The command pool.
     std::vector<VkCommandBuffer> m_commandBuffers; ///< The command buffers.
     VkPhysicalDeviceProperties m_deviceProperties; ///< The properties of the physical device.
+    uint32_t m_instanceApiVersion = VK_API_VERSION_1_0; ///< The Vulkan version the instance was created with.
+    DeviceFeatures m_deviceFeatures;      ///< The optional features enabled on the logical device.
 
     // --- Synchronization ---
     std::vector<VkSemaphore> m_imageAvailableSemaphores; ///< Signals when an image is available for rendering.
@@ -243,10 +318,25 @@ private:
     // --- Engine Systems ---
     std::unique_ptr<Renderer> m_renderer; ///< The main renderer.
     std::unique_ptr<Camera> m_camera;     ///< The main camera.
+    std::unique_ptr<GpuProfiler> m_gpuProfiler; ///< GPU pass timings, shared by the renderer and the UI.
+    std::unique_ptr<GpuAllocator> m_allocator; ///< Device memory for every buffer and image of the engine.
+    std::unique_ptr<PipelineCache> m_pipelineCache; ///< Persistent pipeline cache shared by all pipeline creation.
+    std::unique_ptr<ThreadPool> m_threadPool; ///< Worker threads for data-parallel CPU work.
+    std::unique_ptr<DeletionQueue> m_deletionQueue; ///< GPU objects waiting for the frames that use them to complete.
+    std::unique_ptr<UploadQueue> m_uploadQueue; ///< Staging ring every buffer upload goes through.
+    std::unique_ptr<DescriptorAllocator> m_descriptorAllocator; ///< Growable pools, per-frame transient sets and cached layouts.
+    std::unique_ptr<BindlessTable> m_bindlessTable; ///< Global texture and buffer descriptors the shaders index.
+    std::unique_ptr<AssetCache> m_assetCache; ///< Cooked imports reused across runs, null if disabled.
+    std::unique_ptr<MeshLoader> m_meshLoader; ///< Background mesh loading and uploading.
+    MeshHandle m_pendingMesh = 0;         ///< The mesh to draw once it is ready, 0 if none is loading.
+    std::unique_ptr<TextureStreamer> m_textureStreamer; ///< Background texture loading and mip residency.
+    TextureHandle m_sceneTexture = 0;     ///< The texture mapped onto the scene, 0 if none.
 
     // --- UI ---
     std::vector<std::unique_ptr<UIPanel>> m_UIPanels; ///< A list of all UI panels.
     ViewportPanel* m_viewportPanel = nullptr; ///< Pointer to the viewport panel for specific interactions.
+    VkExtent2D m_requestedSceneExtent = { 0, 0 }; ///< The viewport size the scene image is waiting to be resized to.
+    float m_sceneResizeTimer = 0.0f;      ///< Seconds the requested size has been unchanged.
 
     // --- Camera Control ---
     glm::vec2 m_lastMousePosition{0.0f, 0.0f}; ///< The last recorded mouse position.
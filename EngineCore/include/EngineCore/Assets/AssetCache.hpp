@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+/**
+ * @struct AssetCacheStats
+ * @brief Counters of an AssetCache since it was opened.
+ */
+struct AssetCacheStats
+{
+    uint64_t hits = 0;             ///< Lookups that found a cooked result.
+    uint64_t misses = 0;           ///< Lookups that had to cook the asset.
+    uint64_t failures = 0;         ///< Results that could not be stored or turned out unreadable.
+    uint64_t hashedBytes = 0;      ///< Source bytes hashed to build keys.
+    uint64_t writtenBytes = 0;     ///< Cooked bytes stored.
+    double hashMilliseconds = 0.0; ///< Time spent hashing sources.
+    uint32_t entryCount = 0;       ///< Cooked results in the directory.
+    uint64_t diskBytes = 0;        ///< Size of the cooked results in the directory.
+};
+
+/**
+ * @class AssetCache
+ * @brief A content-addressed directory of cooked assets.
+ *
+ * A key is the hash of a source file's bytes together with a string
+ * describing everything else the cooked result depends on: the import
+ * settings and the version of the code producing it. Cooked results are
+ * stored as `<key><extension>` in the cache directory, so an unchanged source
+ * imported with the same settings is found again after a restart, whatever
+ * its path, and any change to the source, the settings or the cooker version
+ * simply misses. Results are written to a temporary file and renamed into
+ * place, so a crash never leaves a half-written entry behind.
+ *
+ * All methods are thread-safe, so workers cook and look up in parallel.
+ */
+class AssetCache
+{
+public:
+    /**
+     * @brief Opens the cache, creating the directory if it does not exist.
+     * @param directory The cache directory. Throws std::runtime_error if it cannot be created.
+     */
+    explicit AssetCache(std::string directory);
+
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+    /**
+     * @brief Builds the key of a source file.
+     * @param sourcePath The source file; its bytes are hashed. Throws std::runtime_error if it cannot be read.
+     * @param settings Everything besides the bytes that changes the cooked result, e.g. "mesh v1 lods=1".
+     * @return The key.
+     */
+    uint64_t MakeKey(const std::string& sourcePath, const std::string& settings);
+
+    /**
+     * @brief Looks up a cooked result, counting a hit or a miss.
+     * @param key The key from MakeKey().
+     * @param extension The extension of the cooked file, e.g. ".emesh".
+     * @param cookedPath Receives the path of the cooked file on a hit.
+     * @return True on a hit.
+     */
+    bool Find(uint64_t key, const std::string& extension, std::string& cookedPath);
+
+    /**
+     * @brief Stores a cooked result.
+     * @param key The key from MakeKey().
+     * @param extension The extension of the cooked file.
+     * @param write Writes the cooked file to the path it is given, throwing on failure.
+     * @return True if the result was stored; failures are logged and leave the cache unchanged.
+     */
+    bool Store(uint64_t key, const std::string& extension, const std::function<void(const std::string&)>& write);
+
+    /**
+     * @brief Removes a cooked result that turned out to be unreadable, counting a failure.
+     *
+     * The caller logs why; the next Store() for the key writes a fresh result.
+     */
+    void Invalidate(uint64_t key, const std::string& extension);
+
+    /**
+     * @brief Removes every cooked result.
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the counters and the size of the directory.
+     */
+    AssetCacheStats GetStats() const;
+
+    /**
+     * @brief Gets the cache directory.
+     */
+    const std::string& GetDirectory() const { return m_directory; }
+
+private:
+    std::string getPath(uint64_t key, const std::string& extension) const;
+    void scan();
+
+    std::string m_directory;
+    std::atomic<uint64_t> m_hits{ 0 };
+    std::atomic<uint64_t> m_misses{ 0 };
+    std::atomic<uint64_t> m_failures{ 0 };
+    std::atomic<uint64_t> m_hashedBytes{ 0 };
+    std::atomic<uint64_t> m_writtenBytes{ 0 };
+    std::atomic<uint64_t> m_hashMicroseconds{ 0 };
+
+    /// @brief Guards the directory totals and serializes renames and removals.
+    mutable std::mutex m_mutex;
+    uint32_t m_entryCount = 0;
+    uint64_t m_diskBytes = 0;
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "EngineCore/Scene/Aabb.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct Vertex
+ * @brief Defines the structure of a single vertex.
+ * It contains the position and color attributes.
+ */
+struct Vertex {
+    glm::vec3 pos;
+    glm::vec3 color;
+};
+
+/**
+ * @struct MeshLod
+ * @brief One level of detail of a mesh: a range of the mesh's index buffer.
+ *
+ * All levels index the same vertex buffer, so switching levels only changes
+ * which indices are drawn.
+ */
+struct MeshLod {
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+    float error = 0.0f; ///< Largest deviation from the full-detail surface, in object units. 0 for LOD 0.
+};
+
+/**
+ * @struct MeshData
+ * @brief CPU-side geometry of a mesh with its level-of-detail chain.
+ */
+struct MeshData {
+    std::string name;
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;  ///< All levels of detail, back to back.
+    std::vector<MeshLod> lods;      ///< Finest first; a mesh without a chain has a single level covering all indices.
+    Aabb bounds;                    ///< Object-space bounds of the vertices.
+    glm::vec4 boundingSphere{ 0.0f }; ///< Object-space center (xyz) and radius (w) enclosing every vertex.
+
+    /**
+     * @brief Recomputes the bounds and bounding sphere from the vertices.
+     */
+    void ComputeBounds()
+    {
+        bounds = Aabb();
+        for (const Vertex& vertex : vertices) {
+            bounds.Grow(vertex.pos);
+        }
+        glm::vec3 center = vertices.empty() ? glm::vec3(0.0f) : bounds.Center();
+        float radiusSquared = 0.0f;
+        for (const Vertex& vertex : vertices) {
+            glm::vec3 offset = vertex.pos - center;
+            radiusSquared = std::max(radiusSquared, glm::dot(offset, offset));
+        }
+        boundingSphere = glm::vec4(center, std::sqrt(radiusSquared));
+    }
+
+    /**
+     * @brief Makes the whole index buffer the only level of detail, discarding any chain.
+     */
+    void ResetLods()
+    {
+        lods = { MeshLod{ 0, static_cast<uint32_t>(indices.size()), 0.0f } };
+    }
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "EngineCore/Assets/Mesh.hpp"
+#include "EngineCore/MappedFile.hpp"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @struct MeshFileHeader
+ * @brief The fixed-size start of an .emesh file.
+ *
+ * Sections follow in this order, each starting on a MeshFile::SectionAlignment
+ * boundary: the LOD table (MeshLod records), the vertex stream (Vertex
+ * records), the index stream (32-bit indices of all LODs, back to back) and
+ * the UTF-8 name. The streams are stored exactly as the renderer's buffers
+ * hold them, in the byte order of the machine that wrote them.
+ */
+struct MeshFileHeader
+{
+    uint32_t magic;             ///< MeshFile::Magic.
+    uint32_t version;           ///< MeshFile::Version.
+    uint32_t vertexStride;      ///< sizeof(Vertex) when written; files with another layout are rejected.
+    uint32_t indexSize;         ///< Bytes per index.
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    uint32_t lodCount;
+    uint32_t nameLength;
+    float boundsMin[3];
+    float boundsMax[3];
+    float boundingSphere[4];    ///< Center (xyz) and radius (w).
+    uint64_t lodOffset;
+    uint64_t vertexOffset;
+    uint64_t indexOffset;
+    uint64_t nameOffset;
+    uint64_t fileSize;          ///< Guards against truncated files.
+};
+
+/**
+ * @class MeshFile
+ * @brief A mesh in the engine's binary format, mapped into memory and used without parsing.
+ *
+ * Opening a file only validates the header and section bounds; the vertex
+ * and index streams are then read straight out of the mapping, so loading
+ * costs a copy into staging memory rather than per-vertex work. Files are
+ * written by Write(), typically from an OBJ or glTF file by the
+ * MeshConverter tool, which also bakes in the LOD chain.
+ *
+ * Opening and reading only touch CPU memory, so both are safe on worker threads.
+ */
+class MeshFile
+{
+public:
+    /// @brief "EMSH" read as a little-endian 32-bit integer.
+    static constexpr uint32_t Magic = 0x48534D45;
+
+    /// @brief Bumped whenever the layout of the header or a section changes.
+    static constexpr uint32_t Version = 1;
+
+    /// @brief Every section starts on a multiple of this, so the streams can be copied with aligned loads.
+    static constexpr uint64_t SectionAlignment = 16;
+
+    /**
+     * @brief Checks whether a file has the binary mesh extension.
+     * @param path The file path.
+     * @return True for .emesh files.
+     */
+    static bool IsMeshFile(const std::string& path);
+
+    /**
+     * @brief Writes a mesh in the binary format.
+     * @param path The file to create or overwrite.
+     * @param mesh The mesh, with its bounds and LOD chain set. Throws std::runtime_error if the file cannot be written.
+     */
+    static void Write(const std::string& path, const MeshData& mesh);
+
+    /**
+     * @brief Maps a binary mesh file and validates its header.
+     * @param path The file path. Throws std::runtime_error if the file is not a valid mesh of this version.
+     */
+    explicit MeshFile(const std::string& path);
+
+    MeshFile(const MeshFile&) = delete;
+    MeshFile& operator=(const MeshFile&) = delete;
+
+    const std::string& GetName() const { return m_name; }
+    const Vertex* GetVertices() const { return reinterpret_cast<const Vertex*>(m_file.GetData() + m_header->vertexOffset); }
+    uint32_t GetVertexCount() const { return m_header->vertexCount; }
+    const uint32_t* GetIndices() const { return reinterpret_cast<const uint32_t*>(m_file.GetData() + m_header->indexOffset); }
+    uint32_t GetIndexCount() const { return m_header->indexCount; }
+    const MeshLod* GetLods() const { return reinterpret_cast<const MeshLod*>(m_file.GetData() + m_header->lodOffset); }
+    uint32_t GetLodCount() const { return m_header->lodCount; }
+
+    /**
+     * @brief Gets the object-space bounds stored with the mesh.
+     */
+    Aabb GetBounds() const;
+
+    /**
+     * @brief Gets the object-space bounding sphere stored with the mesh.
+     */
+    glm::vec4 GetBoundingSphere() const;
+
+    /**
+     * @brief Reads every page of the file, so copying the streams later does not wait for the disk.
+     */
+    void Prefetch() const { m_file.Prefetch(); }
+
+    /**
+     * @brief Copies the mesh out of the mapping.
+     */
+    MeshData ToMeshData() const;
+
+private:
+    MappedFile m_file;
+    const MeshFileHeader* m_header = nullptr;
+    std::string m_name;
+};
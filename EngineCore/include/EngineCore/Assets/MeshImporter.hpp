@@ -0,0 +1,38 @@
+#pragma once
+
+#include "EngineCore/Assets/Mesh.hpp"
+
+#include <string>
+
+/**
+ * @class MeshImporter
+ * @brief Parses mesh files into MeshData.
+ *
+ * Supported formats are Wavefront OBJ (positions, optional per-vertex colors
+ * and normals; polygons are fanned into triangles) and binary glTF 2.0 (.glb;
+ * the triangle primitives of the default scene with their node transforms
+ * baked in, from the embedded binary chunk only). Vertex colors are taken
+ * from the file where present and otherwise derived from the normals, which
+ * are computed if the file has none. Triangles are flipped to the engine's
+ * clockwise front faces. Everything is merged into a single mesh with one
+ * level of detail.
+ *
+ * Loading only touches CPU memory, so it is safe to call from worker threads.
+ */
+class MeshImporter
+{
+public:
+    /**
+     * @brief Checks whether a file has one of the supported extensions.
+     * @param path The file path.
+     * @return True for .obj and .glb files.
+     */
+    static bool IsSupported(const std::string& path);
+
+    /**
+     * @brief Reads a mesh file.
+     * @param path The file path.
+     * @return The mesh with its bounds computed. Throws std::runtime_error if the file cannot be read or parsed.
+     */
+    static MeshData Load(const std::string& path);
+};
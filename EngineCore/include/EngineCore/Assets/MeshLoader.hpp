@@ -0,0 +1,244 @@
+#pragma once
+
+#include "EngineCore/Assets/Mesh.hpp"
+#include "EngineCore/Assets/MeshFile.hpp"
+#include "EngineCore/Assets/MeshSimplifier.hpp"
+#include "EngineCore/Assets/VertexFormat.hpp"
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+class AssetCache;
+class ThreadPool;
+class UploadQueue;
+
+/// @brief Identifies a mesh requested from a MeshLoader. 0 is never a valid handle.
+using MeshHandle = uint32_t;
+
+/**
+ * @enum MeshState
+ * @brief Where a requested mesh is in the loading pipeline.
+ */
+enum class MeshState
+{
+    Invalid,   ///< The handle was never returned by the loader.
+    Parsing,   ///< A worker is reading the file (or mapping a binary one) and generating the LOD chain.
+    Uploading, ///< The geometry is being staged and copied to device-local buffers.
+    Ready,     ///< The copies have completed; the mesh can be drawn.
+    Failed     ///< Loading failed; see MeshLoader::GetError().
+};
+
+/**
+ * @struct GpuMesh
+ * @brief A mesh in device-local memory with its level-of-detail chain, as the renderer draws it.
+ */
+struct GpuMesh
+{
+    std::string name;
+    VkBuffer vertexBuffer = VK_NULL_HANDLE;
+    GpuAllocation vertexMemory;
+    VkBuffer indexBuffer = VK_NULL_HANDLE;     ///< Indices of all levels, back to back.
+    GpuAllocation indexMemory;
+    VkIndexType indexType = VK_INDEX_TYPE_UINT32; ///< 16-bit when every vertex is addressable with it.
+    uint32_t vertexCount = 0;
+    uint32_t indexCount = 0;                   ///< Indices of all levels.
+    VertexLayout vertexLayout = VertexLayout::Float; ///< The layout the vertex buffer holds.
+    VertexQuantization quantization;           ///< Recovers object-space positions from packed ones.
+    std::vector<MeshLod> lods;                 ///< Finest first, at least one.
+    Aabb bounds;                               ///< Object-space bounds of the vertices.
+    glm::vec4 boundingSphere{ 0.0f };          ///< Object-space center (xyz) and radius (w).
+};
+
+/**
+ * @class MeshLoader
+ * @brief Loads meshes in the background and uploads them without stalling the frame loop.
+ *
+ * LoadAsync() queues the file parsing and LOD generation on the thread
+ * pool and returns a handle right away. Update(), called once per frame on
+ * the render thread, picks up the parsed meshes, creates their buffers and
+ * stages their geometry through the UploadQueue, at most UploadBudget bytes
+ * per call so a large mesh is spread over several frames. All copies staged
+ * in one call are submitted as one batch; a mesh becomes Ready once the
+ * fence of the batch holding its last copy has signaled.
+ *
+ * Binary .emesh files skip parsing: the worker maps the file, validates its
+ * header and touches its pages, and the streams are then copied from the
+ * mapping into the staging ring as they are, LOD chain included. With an
+ * AssetCache set, OBJ and glTF files are cooked into .emesh files on their
+ * first import and take the same path from then on.
+ *
+ * Imported meshes are reordered by MeshOptimizer on the worker, before they
+ * are cooked. Vertices are packed into the layout set with SetVertexLayout()
+ * and indices narrowed to 16 bits when the vertex count allows on the worker
+ * as well, so the render thread only ever copies finished buffers.
+ *
+ * Meshes stay loaded until the loader is destroyed, which must happen once
+ * the device is idle.
+ */
+class MeshLoader
+{
+public:
+    /// @brief The default number of bytes staged per Update().
+    static constexpr VkDeviceSize DefaultUploadBudget = 8ull * 1024 * 1024;
+
+    /**
+     * @brief Creates the loader.
+     * @param allocator The allocator the mesh buffers come from.
+     * @param uploads The queue the geometry is staged and copied through.
+     * @param threadPool The workers files are parsed on.
+     */
+    MeshLoader(GpuAllocator& allocator, UploadQueue& uploads, ThreadPool& threadPool);
+
+    /**
+     * @brief Destroys every mesh, abandoning unfinished parse jobs. The device must be idle.
+     */
+    ~MeshLoader();
+
+    MeshLoader(const MeshLoader&) = delete;
+    MeshLoader& operator=(const MeshLoader&) = delete;
+
+    /**
+     * @brief Starts loading a mesh file (see MeshImporter for the text formats).
+     *
+     * Binary .emesh files (see MeshFile) are mapped instead of parsed, and
+     * their streams are staged straight out of the mapping.
+     *
+     * @param path The file path.
+     * @return The handle to poll; parse errors are reported through GetState() and GetError().
+     */
+    MeshHandle LoadAsync(const std::string& path);
+
+    /**
+     * @brief Starts uploading a mesh built in memory, generating its LOD chain on a worker if it has none.
+     * @param mesh The mesh geometry.
+     * @return The handle to poll.
+     */
+    MeshHandle LoadAsync(MeshData mesh);
+
+    /**
+     * @brief Advances every request: collects parsed meshes, stages uploads up to the budget and marks completed ones ready.
+     */
+    void Update();
+
+    /**
+     * @brief Blocks until every requested mesh is ready or has failed, ignoring the upload budget.
+     */
+    void Flush();
+
+    /**
+     * @brief Gets the state of a request.
+     */
+    MeshState GetState(MeshHandle handle) const;
+
+    /**
+     * @brief Gets a loaded mesh.
+     * @return The mesh, or null unless it is Ready.
+     */
+    const GpuMesh* GetMesh(MeshHandle handle) const;
+
+    /**
+     * @brief Gets why a request failed.
+     * @return The error message, empty unless the request Failed.
+     */
+    const std::string& GetError(MeshHandle handle) const;
+
+    /**
+     * @brief Gets the number of requests that are still parsing or uploading.
+     */
+    size_t GetPendingCount() const;
+
+    /**
+     * @brief Toggles generating a LOD chain for meshes that come without one.
+     */
+    void SetGenerateLods(bool generate) { m_generateLods = generate; }
+
+    /**
+     * @brief Sets how LOD chains are generated for requests made afterwards.
+     */
+    void SetLodSettings(const LodSettings& settings) { m_lodSettings = settings; }
+
+    /**
+     * @brief Sets the number of bytes staged per Update(), bounding the per-frame upload cost.
+     */
+    void SetUploadBudget(VkDeviceSize bytes) { m_uploadBudget = bytes; }
+
+    /**
+     * @brief Sets the cache imported meshes are cooked into, so later loads of the same file map the cooked copy.
+     * @param cache The cache, or null to always import. Must outlive the loader.
+     */
+    void SetAssetCache(AssetCache* cache) { m_assetCache = cache; }
+
+    /**
+     * @brief Sets the layout the vertex buffers of meshes requested afterwards are packed into.
+     */
+    void SetVertexLayout(VertexLayout layout) { m_vertexLayout = layout; }
+
+    /**
+     * @brief Toggles reordering imported meshes for the vertex cache, overdraw and vertex fetch.
+     *
+     * Binary .emesh files are used as they were converted.
+     */
+    void SetOptimizeMeshes(bool optimize) { m_optimizeMeshes = optimize; }
+
+private:
+    /**
+     * @struct ParsedMesh
+     * @brief What a worker produced: parsed geometry, or a mapped binary file whose streams are used as they are.
+     */
+    struct ParsedMesh
+    {
+        MeshData data;
+        std::unique_ptr<MeshFile> file;
+        VertexLayout layout = VertexLayout::Float;
+        std::vector<PackedVertex> packed; ///< The vertices of data or file in layout, unless it is Float.
+        VertexQuantization quantization;
+        std::vector<uint16_t> indices16;  ///< The indices of data or file narrowed to 16 bits, if they fit.
+    };
+
+    /**
+     * @struct Request
+     * @brief One mesh moving through the pipeline.
+     */
+    struct Request
+    {
+        std::string name;
+        MeshState state = MeshState::Parsing;
+        std::future<ParsedMesh> parsing;    ///< Valid while Parsing.
+        MeshData data;                      ///< The parsed geometry, released once fully staged.
+        std::unique_ptr<MeshFile> file;     ///< Staged from instead of data for binary files, unmapped once fully staged.
+        std::vector<PackedVertex> packed;   ///< Staged from instead of data or file for packed layouts.
+        std::vector<uint16_t> indices16;    ///< Staged from instead of data or file for 16-bit indices.
+        const void* vertexData = nullptr;   ///< The vertex stream, in data or file.
+        const void* indexData = nullptr;    ///< The index stream, in data or file.
+        GpuMesh mesh;
+        VkDeviceSize stagedBytes = 0;
+        uint64_t uploadBatch = 0;           ///< The batch holding the last copy, 0 while staging.
+        std::string error;
+        std::chrono::steady_clock::time_point requestTime;
+    };
+
+    static void packBuffers(ParsedMesh& parsed, VertexLayout layout);
+    MeshHandle addRequest(const std::string& name, std::future<ParsedMesh> parsing);
+    Request* find(MeshHandle handle) const;
+    void finishParsing(Request& request);
+    VkDeviceSize stage(Request& request, VkDeviceSize budget);
+
+    GpuAllocator& m_allocator;
+    UploadQueue& m_uploads;
+    ThreadPool& m_threadPool;
+    bool m_generateLods = true;
+    LodSettings m_lodSettings;
+    VkDeviceSize m_uploadBudget = DefaultUploadBudget;
+    AssetCache* m_assetCache = nullptr;
+    VertexLayout m_vertexLayout = VertexLayout::Float;
+    bool m_optimizeMeshes = true;
+    std::vector<std::unique_ptr<Request>> m_requests; ///< Indexed by handle - 1.
+};
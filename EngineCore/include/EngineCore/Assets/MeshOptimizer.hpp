@@ -0,0 +1,85 @@
+#pragma once
+
+#include "EngineCore/Assets/Mesh.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct VertexCacheStats
+ * @brief How well a triangle list uses a simulated post-transform vertex cache.
+ */
+struct VertexCacheStats {
+    float acmr = 0.0f; ///< Average cache miss ratio: vertex shader invocations per triangle (0.5 is ideal, 3 is worst).
+    float atvr = 0.0f; ///< Average transformed vertex ratio: invocations per referenced vertex (1 is ideal).
+};
+
+/**
+ * @class MeshOptimizer
+ * @brief Reorders triangles and vertices so the GPU transforms, shades and fetches less.
+ *
+ * Three passes, applied to every level of detail:
+ *  - Vertex cache: Tipsify (Sander et al. 2007) fans around recently used
+ *    vertices so most of a triangle's vertices are still in the
+ *    post-transform cache.
+ *  - Overdraw: the cache-ordered list is cut into clusters where the cache
+ *    restarts or the local miss ratio is close to the whole run's, and the
+ *    clusters are sorted so outward-facing ones are drawn first, occluding
+ *    the rest for depth testing. The threshold bounds how much cache
+ *    efficiency is given up for this.
+ *  - Vertex fetch: vertices are renumbered in the order the index buffer
+ *    first uses them, so fetches walk the vertex buffer sequentially.
+ *    Vertices no level uses are dropped.
+ *
+ * Only index order and vertex order change, so the rendered result is the
+ * same. A level whose miss ratio would get worse keeps its original order. Works on CPU memory only and is safe to call from worker threads.
+ */
+class MeshOptimizer
+{
+public:
+    /// @brief The cache size the passes optimize for and the statistics simulate, a FIFO cache like most GPUs'.
+    static constexpr uint32_t CacheSize = 16;
+
+    /// @brief How much worse than the cache-optimized order the overdraw pass may make a cluster's and the list's miss ratio.
+    static constexpr float DefaultOverdrawThreshold = 1.05f;
+
+    /**
+     * @brief Runs all passes on every level of detail of a mesh, logging the cache statistics before and after.
+     * @param mesh The mesh; its vertices and indices are reordered in place.
+     * @param overdrawThreshold See DefaultOverdrawThreshold; 1 never gives up cache efficiency for overdraw.
+     */
+    static void Optimize(MeshData& mesh, float overdrawThreshold = DefaultOverdrawThreshold);
+
+    /**
+     * @brief Reorders a triangle list for the post-transform cache.
+     * @param indices The triangle list, reordered in place.
+     * @param count The number of indices, a multiple of 3.
+     * @param vertexCount The number of vertices the indices refer to.
+     */
+    static void OptimizeVertexCache(uint32_t* indices, size_t count, uint32_t vertexCount);
+
+    /**
+     * @brief Reorders the clusters of a cache-optimized triangle list to reduce overdraw.
+     * @param indices The triangle list, reordered in place.
+     * @param count The number of indices, a multiple of 3.
+     * @param vertices The vertices the indices refer to.
+     * @param threshold See DefaultOverdrawThreshold.
+     */
+    static void OptimizeOverdraw(uint32_t* indices, size_t count, const std::vector<Vertex>& vertices, float threshold);
+
+    /**
+     * @brief Renumbers vertices in order of first use and drops unused ones.
+     * @param mesh The mesh; every index and the vertex buffer are rewritten.
+     */
+    static void OptimizeVertexFetch(MeshData& mesh);
+
+    /**
+     * @brief Simulates a FIFO cache of CacheSize entries over a triangle list.
+     * @param indices The triangle list.
+     * @param count The number of indices.
+     * @param vertexCount The number of vertices the indices refer to.
+     * @return The miss ratios.
+     */
+    static VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t count, uint32_t vertexCount);
+};
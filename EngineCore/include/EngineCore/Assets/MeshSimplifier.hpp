@@ -0,0 +1,57 @@
+#pragma once
+
+#include "EngineCore/Assets/Mesh.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct LodSettings
+ * @brief Controls how many levels of detail are generated and how coarse they get.
+ */
+struct LodSettings {
+    uint32_t maxLodCount = 6;     ///< Upper limit for the chain length, including LOD 0.
+    float reduction = 0.5f;       ///< Fraction of the previous level's triangles each level aims to keep.
+    float maxError = 0.05f;       ///< Largest allowed deviation per level, relative to the bounding sphere radius.
+    float minReduction = 0.1f;    ///< Stop once a level removes less than this fraction of the previous level's triangles.
+};
+
+/**
+ * @class MeshSimplifier
+ * @brief Generates levels of detail with quadric error metric edge collapses (Garland-Heckbert).
+ *
+ * Every collapse merges a vertex into one of its neighbours instead of a
+ * new optimal position, so simplified index buffers keep indexing the
+ * original vertex buffer and all LODs of a mesh share it. Vertices with the
+ * same position are treated as one (attribute seams are welded in the coarser
+ * levels), open borders are locked so silhouettes do not shrink, and
+ * collapses that would flip a triangle are rejected.
+ */
+class MeshSimplifier
+{
+public:
+    /**
+     * @brief Simplifies a triangle list.
+     * @param positions The vertex positions the indices refer to.
+     * @param indices The triangle list to simplify.
+     * @param targetIndexCount The index count to stop at.
+     * @param maxError Collapses deviating further from the input surface are not done, in position units.
+     * @param resultError Optional; receives the largest deviation of the collapses done.
+     * @return The simplified triangle list, indexing the same positions. Larger than the target if the error limit was hit first.
+     */
+    static std::vector<uint32_t> Simplify(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices,
+                                          size_t targetIndexCount, float maxError, float* resultError = nullptr);
+
+    /**
+     * @brief Replaces the LOD chain of a mesh, appending each new level to its index buffer.
+     *
+     * Each level is simplified from the previous one; its error is the sum of
+     * the errors along the chain, so it bounds the deviation from LOD 0.
+     *
+     * @param mesh The mesh; its first level (or, without levels, all indices) is kept as LOD 0.
+     * @param settings How the chain is built.
+     */
+    static void GenerateLods(MeshData& mesh, const LodSettings& settings = {});
+};
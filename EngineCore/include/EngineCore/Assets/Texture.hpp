@@ -0,0 +1,117 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct TextureFormatInfo
+ * @brief How the texels of a format are laid out in memory.
+ *
+ * Block-compressed formats store blocks of 4x4 texels; every other format
+ * is treated as 1x1 blocks of blockBytes bytes.
+ */
+struct TextureFormatInfo
+{
+    uint32_t blockWidth = 1;
+    uint32_t blockHeight = 1;
+    uint32_t blockBytes = 0; ///< 0 for formats the texture pipeline does not handle.
+
+    bool IsCompressed() const { return blockWidth > 1; }
+    bool IsSupported() const { return blockBytes > 0; }
+
+    /**
+     * @brief Gets the number of bytes of one tightly packed level.
+     */
+    VkDeviceSize GetLevelSize(uint32_t width, uint32_t height) const
+    {
+        VkDeviceSize blocksWide = (width + blockWidth - 1) / blockWidth;
+        VkDeviceSize blocksHigh = (height + blockHeight - 1) / blockHeight;
+        return blocksWide * blocksHigh * blockBytes;
+    }
+
+    /**
+     * @brief Gets the layout of a format.
+     */
+    static TextureFormatInfo Get(VkFormat format)
+    {
+        switch (format) {
+        case VK_FORMAT_R8_UNORM:
+            return { 1, 1, 1 };
+        case VK_FORMAT_R8G8_UNORM:
+            return { 1, 1, 2 };
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_R8G8B8A8_SNORM:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            return { 1, 1, 4 };
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            return { 1, 1, 8 };
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return { 1, 1, 16 };
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+        case VK_FORMAT_BC4_SNORM_BLOCK:
+            return { 4, 4, 8 };
+        case VK_FORMAT_BC2_UNORM_BLOCK:
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+        case VK_FORMAT_BC5_SNORM_BLOCK:
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+            return { 4, 4, 16 };
+        default:
+            return {};
+        }
+    }
+};
+
+/**
+ * @struct TextureLevel
+ * @brief One mip level of a texture file, and its texels once they have been read.
+ */
+struct TextureLevel
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint64_t fileOffset = 0;   ///< Where the level starts in the file.
+    VkDeviceSize size = 0;     ///< The size of the level in bytes.
+    std::vector<uint8_t> data; ///< The texels, empty until the level has been read.
+};
+
+/**
+ * @struct TextureData
+ * @brief A 2D texture: its format, its mip chain and whichever levels are in memory.
+ */
+struct TextureData
+{
+    std::string path;                 ///< The file the levels are read from.
+    std::string name;
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<TextureLevel> levels; ///< Most detailed first; only the levels the file contains.
+
+    /**
+     * @brief Gets the number of levels of a complete mip chain down to 1x1.
+     */
+    uint32_t GetFullMipCount() const
+    {
+        uint32_t count = 1;
+        for (uint32_t size = std::max(width, height); size > 1; size /= 2) {
+            count++;
+        }
+        return count;
+    }
+};
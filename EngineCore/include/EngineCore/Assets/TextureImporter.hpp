@@ -0,0 +1,56 @@
+#pragma once
+
+#include "EngineCore/Assets/Texture.hpp"
+
+#include <string>
+
+/**
+ * @class TextureImporter
+ * @brief Reads 2D textures with pre-built mip chains from KTX2 and DDS files.
+ *
+ * Reading is split in two so textures can be streamed: ReadHeader() parses
+ * the format, size and where each mip level lives in the file, and
+ * ReadLevels() loads the texels of a range of levels later, possibly only
+ * the small ones at first. KTX2 files must not be supercompressed (no Basis
+ * or Zstandard); DDS files may use the legacy or the DX10 header. Cube maps,
+ * arrays and volume textures are rejected.
+ *
+ * Everything here only touches CPU memory and files, so it is safe to call from worker threads.
+ */
+class TextureImporter
+{
+public:
+    /**
+     * @brief Checks whether a file has one of the supported extensions.
+     * @param path The file path.
+     * @return True for .ktx2 and .dds files.
+     */
+    static bool IsSupported(const std::string& path);
+
+    /**
+     * @brief Reads the header and level index of a texture file.
+     * @param path The file path.
+     * @return The texture with every level described but none read. Throws std::runtime_error if the file is invalid or unsupported.
+     */
+    static TextureData ReadHeader(const std::string& path);
+
+    /**
+     * @brief Reads the texels of a range of levels from the texture's file.
+     * @param texture A texture returned by ReadHeader().
+     * @param firstLevel The most detailed level to read.
+     * @param levelCount The number of levels to read.
+     */
+    static void ReadLevels(TextureData& texture, uint32_t firstLevel, uint32_t levelCount);
+
+    /**
+     * @brief Decodes a BC1-BC5 texture to 8-bit RGBA, for devices without block compression support.
+     *
+     * Only the levels that have been read are decoded; the others are
+     * dropped, as their file data no longer matches the format. sRGB and
+     * SNORM formats decode to R8G8B8A8_SRGB and R8G8B8A8_SNORM.
+     *
+     * @param texture The texture, changed in place.
+     * @return False if the format cannot be decoded on the CPU (BC6H and BC7).
+     */
+    static bool Decompress(TextureData& texture);
+};
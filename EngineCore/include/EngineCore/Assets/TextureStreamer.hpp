@@ -0,0 +1,288 @@
+#pragma once
+
+#include "EngineCore/Assets/Texture.hpp"
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+class BindlessTable;
+class DeletionQueue;
+class ThreadPool;
+class UploadQueue;
+
+/// @brief Identifies a texture loaded by a TextureStreamer. 0 is never a valid handle.
+using TextureHandle = uint32_t;
+
+/**
+ * @enum TextureState
+ * @brief Where a requested texture is in the loading pipeline.
+ */
+enum class TextureState
+{
+    Invalid, ///< The handle was never returned by the streamer.
+    Loading, ///< The header and the smallest levels are being read and uploaded.
+    Ready,   ///< At least the mip tail is resident; more detail streams in on request.
+    Failed   ///< Loading failed; see TextureStreamer::GetError().
+};
+
+/**
+ * @struct TextureStreamerCreateInfo
+ * @brief The device objects and settings a TextureStreamer is created with.
+ */
+struct TextureStreamerCreateInfo
+{
+    VkDevice device = VK_NULL_HANDLE;
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
+    GpuAllocator* allocator = nullptr;
+    UploadQueue* uploadQueue = nullptr;           ///< Stages the texels read from disk.
+    ThreadPool* threadPool = nullptr;             ///< Reads and decodes files.
+    VkQueue graphicsQueue = VK_NULL_HANDLE;       ///< Runs mip generation and residency copies.
+    uint32_t graphicsFamily = 0;
+    DeletionQueue* deletionQueue = nullptr;       ///< Replaced images are retired here until no frame can use them.
+    bool textureCompressionBC = false;            ///< Whether BC formats were enabled on the device.
+    VkDeviceSize budget = 256ull * 1024 * 1024;   ///< The device memory all texture images may use.
+    BindlessTable* bindless = nullptr;            ///< Optional table Ready textures are registered in; must outlive the streamer.
+};
+
+/**
+ * @struct TextureInfo
+ * @brief A snapshot of one texture, for display.
+ */
+struct TextureInfo
+{
+    std::string name;
+    TextureState state = TextureState::Invalid;
+    VkFormat format = VK_FORMAT_UNDEFINED;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t levelCount = 0;    ///< Levels of the full chain on the GPU.
+    uint32_t residentLevel = 0; ///< The most detailed resident level.
+    uint32_t tailLevel = 0;     ///< Levels from here on are never evicted.
+    bool streamable = false;    ///< False when every level must stay resident (decoded or generated mips).
+    VkDeviceSize residentBytes = 0;
+};
+
+/**
+ * @struct TextureStreamerStats
+ * @brief Residency totals across every texture.
+ */
+struct TextureStreamerStats
+{
+    uint32_t textureCount = 0;
+    uint32_t streamingCount = 0;    ///< Residency changes in flight.
+    VkDeviceSize residentBytes = 0; ///< Device memory of the resident images.
+    VkDeviceSize budget = 0;
+    uint64_t streamedLevels = 0;    ///< Levels read from disk after the initial load.
+    uint64_t evictedLevels = 0;     ///< Levels dropped to stay within the budget.
+};
+
+/**
+ * @class TextureStreamer
+ * @brief Loads textures in the background and keeps the most useful mip levels resident within a memory budget.
+ *
+ * LoadAsync() reads only the mip tail on a worker: the levels of TailSize
+ * texels and smaller, which then stay resident. Callers ask for more detail
+ * with Request(), each frame they use a texture; Update() reads the missing
+ * levels from disk, uploads them through the UploadQueue into a new image and
+ * copies the already resident levels over from the old one on the graphics
+ * queue. When a request would go over the budget, the levels of the least
+ * recently used textures are evicted first, the same way in reverse; if that
+ * is not enough, the request gets fewer levels. Replaced images live on until
+ * no frame in flight can still use them.
+ *
+ * Formats come from the files. Block-compressed formats are used as they are
+ * when the device supports them; otherwise BC1-BC5 are decoded to RGBA8 on
+ * the worker. Uncompressed files without mips get their chain generated
+ * with blits. Both kinds keep all their levels resident, as they cannot be
+ * re-read from the file.
+ *
+ * With a BindlessTable, each Ready texture holds a slot pointing at its
+ * current view; a residency change moves it to a new slot, and the old one is
+ * released along with the replaced image.
+ *
+ * Not thread-safe: all calls must come from the render thread.
+ */
+class TextureStreamer
+{
+public:
+    /// @brief Levels this large and smaller are loaded with the texture and never evicted.
+    static constexpr uint32_t TailSize = 64;
+
+    /// @brief The most residency changes that can be in flight at once.
+    static constexpr uint32_t MaxConcurrentStreams = 4;
+
+    /**
+     * @brief Creates the sampler and the command pool for the graphics queue work.
+     * @param createInfo The device objects and settings.
+     */
+    explicit TextureStreamer(const TextureStreamerCreateInfo& createInfo);
+
+    /**
+     * @brief Destroys every texture, abandoning unfinished reads. The device must be idle.
+     */
+    ~TextureStreamer();
+
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    /**
+     * @brief Starts loading a texture file (see TextureImporter for the formats).
+     * @param path The file path.
+     * @return The handle to poll; errors are reported through GetState() and GetError().
+     */
+    TextureHandle LoadAsync(const std::string& path);
+
+    /**
+     * @brief Marks a texture as used this frame and asks for a level of detail.
+     * @param handle The texture.
+     * @param level The most detailed level needed, e.g. from the texture's size on screen.
+     */
+    void Request(TextureHandle handle, uint32_t level);
+
+    /**
+     * @brief Finishes loads and residency changes and starts new ones for this frame's requests. Call once per frame.
+     */
+    void Update();
+
+    /**
+     * @brief Gets the state of a texture.
+     */
+    TextureState GetState(TextureHandle handle) const;
+
+    /**
+     * @brief Gets the view of a texture's resident levels.
+     * @return The view, or VK_NULL_HANDLE unless the texture is Ready. Changes whenever the residency does.
+     */
+    VkImageView GetImageView(TextureHandle handle) const;
+
+    /**
+     * @brief Gets the BindlessTable slot of a texture's resident levels.
+     * @return The slot, or BindlessTable::DefaultTexture unless the texture is Ready. Changes whenever the residency does.
+     */
+    uint32_t GetBindlessIndex(TextureHandle handle) const;
+
+    /**
+     * @brief Gets the trilinear sampler every texture is meant to be sampled with.
+     */
+    VkSampler GetSampler() const { return m_sampler; }
+
+    /**
+     * @brief Gets a snapshot of a texture.
+     */
+    TextureInfo GetInfo(TextureHandle handle) const;
+
+    /**
+     * @brief Gets why a texture failed to load.
+     * @return The error message, empty unless the texture Failed.
+     */
+    const std::string& GetError(TextureHandle handle) const;
+
+    /**
+     * @brief Gets the number of handles returned so far; valid handles run from 1 to this count.
+     */
+    uint32_t GetTextureCount() const { return static_cast<uint32_t>(m_textures.size()); }
+
+    /**
+     * @brief Gets the residency totals.
+     */
+    TextureStreamerStats GetStats() const;
+
+    /**
+     * @brief Changes the memory budget; textures are evicted on the next Update() if it is exceeded.
+     */
+    void SetBudget(VkDeviceSize bytes) { m_budget = bytes; }
+
+private:
+    /**
+     * @struct LoadedLevels
+     * @brief What a worker read: the texture's header and the texels of some levels.
+     */
+    struct LoadedLevels
+    {
+        TextureData data;
+        uint32_t firstLevel = 0;   ///< The most detailed level read.
+        bool generateMips = false; ///< Only level 0 exists; the rest must be blitted.
+    };
+
+    /**
+     * @struct Texture
+     * @brief One texture with its resident image and the residency change in flight, if any.
+     */
+    struct Texture
+    {
+        TextureData data;                   ///< The level index; texels are dropped once uploaded.
+        TextureState state = TextureState::Loading;
+        std::string error;
+        bool streamable = false;
+        bool generateMips = false;
+        uint32_t levelCount = 0;            ///< Levels of the full chain on the GPU.
+        uint32_t tailLevel = 0;
+        uint32_t residentLevel = 0;         ///< The image holds levels [residentLevel, levelCount).
+        uint32_t requestedLevel = UINT32_MAX; ///< The most detailed level requested since the last Update().
+        uint64_t lastUsedFrame = 0;
+
+        VkImage image = VK_NULL_HANDLE;
+        GpuAllocation memory;
+        VkImageView view = VK_NULL_HANDLE;
+        uint32_t bindlessIndex = 0;         ///< The slot of view, 0 (the default texture) if there is none.
+
+        // --- Residency change in flight ---
+        bool changing = false;
+        std::future<LoadedLevels> reading;  ///< Valid while a worker reads levels.
+        uint32_t pendingLevel = 0;
+        VkImage pendingImage = VK_NULL_HANDLE;
+        GpuAllocation pendingMemory;
+        uint64_t uploadBatch = 0;
+    };
+
+    /**
+     * @struct CommandBatch
+     * @brief A graphics command buffer of copies and blits and the fence of its submission.
+     */
+    struct CommandBatch
+    {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkFence fence = VK_NULL_HANDLE;
+    };
+
+    static LoadedLevels readInitialLevels(const std::string& path, VkPhysicalDevice physicalDevice, bool textureCompressionBC);
+
+    Texture* find(TextureHandle handle) const;
+    void finishReading(Texture& texture);
+    void startChange(Texture& texture, uint32_t level);
+    void finishChange(Texture& texture);
+    void updateResidency();
+    VkDeviceSize evictFor(VkDeviceSize bytes, const Texture* requester);
+    VkDeviceSize estimateBytes(const Texture& texture, uint32_t level) const;
+    VkCommandBuffer getCommandBuffer();
+    void submitCommands();
+
+    VkDevice m_device;
+    VkPhysicalDevice m_physicalDevice;
+    GpuAllocator& m_allocator;
+    UploadQueue& m_uploads;
+    ThreadPool& m_threadPool;
+    VkQueue m_graphicsQueue;
+    DeletionQueue& m_deletionQueue;
+    bool m_textureCompressionBC;
+    VkDeviceSize m_budget;
+    BindlessTable* m_bindless;
+    VkSampler m_sampler = VK_NULL_HANDLE;
+    VkCommandPool m_commandPool = VK_NULL_HANDLE;
+
+    std::vector<std::unique_ptr<Texture>> m_textures; ///< Indexed by handle - 1.
+    CommandBatch m_recording;                         ///< Commands of the current Update(), null until needed.
+    std::deque<CommandBatch> m_submitted;
+    std::vector<CommandBatch> m_freeBatches;
+    uint64_t m_frame = 1;
+    uint64_t m_streamedLevels = 0;
+    uint64_t m_evictedLevels = 0;
+    bool m_staged = false;                            ///< Something was staged for upload in this Update().
+};
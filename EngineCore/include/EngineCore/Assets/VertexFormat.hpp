@@ -0,0 +1,105 @@
+#pragma once
+
+#include "EngineCore/Assets/Mesh.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum VertexLayout
+ * @brief How a mesh's vertices are stored in its vertex buffer.
+ */
+enum class VertexLayout : uint32_t
+{
+    Float,   ///< Vertex as is: float position and color, 24 bytes.
+    Half,    ///< Half-float position relative to the bounds center and unorm8 color, 12 bytes.
+    Snorm16, ///< snorm16 position scaled to the bounds and unorm8 color, 12 bytes.
+};
+
+/// @brief The number of VertexLayout values, for tables indexed by layout.
+constexpr uint32_t VertexLayoutCount = 3;
+
+/**
+ * @struct PackedVertex
+ * @brief A vertex in the Half or Snorm16 layout.
+ *
+ * The fourth position lane only pads the attribute to a format every device
+ * can fetch; the shader reads three components.
+ */
+struct PackedVertex {
+    uint16_t position[4]; ///< Half floats or snorm16, depending on the layout.
+    uint8_t color[4];     ///< unorm8 RGB, alpha unused.
+};
+
+/**
+ * @struct VertexQuantization
+ * @brief Maps a packed position back to object space: position = decoded * scale + offset.
+ *
+ * The vertex shader applies it, so culling, picking and LOD selection keep
+ * working on the unquantized bounds.
+ */
+struct VertexQuantization {
+    glm::vec4 scale{ 1.0f };  ///< Per-axis scale (xyz); w unused.
+    glm::vec4 offset{ 0.0f }; ///< Per-axis offset (xyz); w unused.
+};
+
+/**
+ * @class VertexFormat
+ * @brief Describes the vertex layouts to the pipeline and packs vertices into them.
+ *
+ * Every layout uses formats the shaders read as floats, so one vertex shader
+ * serves them all: the pipeline's vertex input description is generated from
+ * the layout, and the fetch converts half, snorm and unorm values for free.
+ */
+class VertexFormat
+{
+public:
+    /**
+     * @brief Gets the size of one vertex in bytes.
+     */
+    static uint32_t GetStride(VertexLayout layout);
+
+    /**
+     * @brief Gets the name of a layout as used in the config ("float", "half", "snorm16").
+     */
+    static const char* GetName(VertexLayout layout);
+
+    /**
+     * @brief Parses a layout name.
+     * @param name The name, as returned by GetName().
+     * @param layout Receives the layout if the name is known.
+     * @return True if the name is known.
+     */
+    static bool Parse(const std::string& name, VertexLayout& layout);
+
+    /**
+     * @brief Appends the vertex binding and its position (location 0) and color (location 1) attributes.
+     * @param layout The layout the vertex buffer holds.
+     * @param binding The binding the vertex buffer is bound to.
+     * @param bindings The binding descriptions to append to.
+     * @param attributes The attribute descriptions to append to.
+     */
+    static void GetInputDescription(VertexLayout layout, uint32_t binding, std::vector<VkVertexInputBindingDescription>& bindings,
+                                    std::vector<VkVertexInputAttributeDescription>& attributes);
+
+    /**
+     * @brief Packs vertices into a compact layout.
+     * @param layout The Half or Snorm16 layout.
+     * @param vertices The vertices to pack.
+     * @param count The number of vertices.
+     * @param bounds The bounds of the vertices, which the positions are quantized to.
+     * @param packed Receives the packed vertices.
+     * @return How the shader recovers object-space positions.
+     */
+    static VertexQuantization Pack(VertexLayout layout, const Vertex* vertices, size_t count, const Aabb& bounds,
+                                   std::vector<PackedVertex>& packed);
+
+    /**
+     * @brief Converts a float to the nearest half float, rounding ties to even.
+     */
+    static uint16_t FloatToHalf(float value);
+};
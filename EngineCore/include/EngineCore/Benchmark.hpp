@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct TimingSummary
+ * @brief Summary statistics of a series of timing samples (in milliseconds).
+ */
+struct TimingSummary
+{
+    size_t count = 0;     ///< The number of samples.
+    double average = 0.0; ///< The arithmetic mean.
+    double minimum = 0.0; ///< The smallest sample.
+    double maximum = 0.0; ///< The largest sample.
+    double median = 0.0;  ///< The 50th percentile.
+    double p95 = 0.0;     ///< The 95th percentile.
+    double p99 = 0.0;     ///< The 99th percentile.
+
+    /**
+     * @brief Computes the summary of a set of samples.
+     * @param samples The samples. Taken by value because they are sorted internally.
+     * @return The summary; all fields are zero if there are no samples.
+     */
+    static TimingSummary FromSamples(std::vector<double> samples);
+};
+
+/**
+ * @class BenchmarkReport
+ * @brief Collects named results of a benchmark run for logging and machine-readable output.
+ *
+ * Headless runs and micro-benchmarks fill a report and then either log it,
+ * write it as JSON for automated performance tracking, or both.
+ */
+class BenchmarkReport
+{
+public:
+    /**
+     * @brief Constructs an empty report.
+     * @param name The name of the benchmark, written into the output.
+     */
+    explicit BenchmarkReport(std::string name);
+
+    /**
+     * @brief Adds a single scalar result (a count, a rate, a total time, ...).
+     * @param key The result name.
+     * @param value The result value.
+     */
+    void AddValue(const std::string& key, double value);
+
+    /**
+     * @brief Adds a timing summary.
+     * @param key The name of the timed quantity, e.g. "frame_ms".
+     * @param summary The summary statistics.
+     */
+    void AddTiming(const std::string& key, const TimingSummary& summary);
+
+    /**
+     * @brief Prints all results through the core logger.
+     */
+    void Log() const;
+
+    /**
+     * @brief Writes all results to a JSON file.
+     * @param path The output file path.
+     * @return True on success, false if the file could not be written.
+     */
+    bool WriteJson(const std::string& path) const;
+
+private:
+    std::string m_name;                                          ///< The benchmark name.
+    std::vector<std::pair<std::string, double>> m_values;        ///< Scalar results in insertion order.
+    std::vector<std::pair<std::string, TimingSummary>> m_timings; ///< Timing summaries in insertion order.
+};
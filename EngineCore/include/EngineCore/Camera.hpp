@@ -2,6 +2,7 @@
 
 #include "EngineCore/Events/Event.hpp"
 #include "EngineCore/Events/MouseEvent.hpp"
+#include "EngineCore/Scene/Frustum.hpp"
 
 #include <glm/glm.hpp>
 
@@ -61,6 +62,19 @@ public:
      * @param delta The scroll wheel offset.
      */
     void ProcessMouseZoom(float delta);
+
+    /**
+     * @brief Points the camera at a target from a given distance, keeping its orbit angles.
+     * @param target The point to orbit around.
+     * @param distance The distance from the target.
+     */
+    void Focus(const glm::vec3& target, float distance);
+
+    /**
+     * @brief Matches the projection to the shape of the image it is displayed in.
+     * @param aspectRatio The width divided by the height; ignored if not positive.
+     */
+    void SetAspectRatio(float aspectRatio);
     
     /**
      * @brief Handles incoming events, specifically mouse scroll events.
@@ -80,6 +94,12 @@ public:
      */
     const glm::mat4& GetProjectionMatrix() const { return m_projectionMatrix; }
 
+    /**
+     * @brief Gets the world-space view frustum.
+     * @return The frustum planes extracted from the view-projection matrix.
+     */
+    Frustum GetFrustum() const { return Frustum::FromMatrix(m_projectionMatrix * m_viewMatrix); }
+
 private:
     /**
      * @brief Recalculates the view and projection matrices based on current camera parameters.
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @struct EngineConfig
+ * @brief Startup settings for the engine.
+ *
+ * Values are read from a simple `key = value` config file and can then be
+ * overridden from the command line (`--key=value` or `--key value`).
+ * Keys use the same names in both places, e.g. `frames-in-flight`. Boolean
+ * options may be given without a value on the command line, e.g. `--headless`.
+ */
+struct EngineConfig
+{
+    /// @brief The smallest supported number of frames in flight.
+    static constexpr uint32_t MinFramesInFlight = 1;
+    /// @brief The largest supported number of frames in flight.
+    static constexpr uint32_t MaxFramesInFlight = 4;
+
+    /// @brief How many frames the CPU may record ahead of the GPU. Sizes every per-frame resource.
+    uint32_t framesInFlight = 2;
+
+    /// @brief The size in MiB of each frame's partition of the per-frame data ring buffer.
+    uint32_t frameDataMegabytes = 8;
+
+    /// @brief The file the Vulkan pipeline cache is persisted to. Empty disables persistence.
+    std::string pipelineCachePath = "pipeline_cache.bin";
+
+    /// @brief The directory imported assets are cooked into, so re-importing unchanged files is skipped. Empty disables it.
+    std::string assetCachePath = "asset_cache";
+
+    /// @brief The size in MiB of the staging ring all buffer uploads go through.
+    uint32_t stagingRingMegabytes = 32;
+
+    /// @brief The most mesh data in MiB the background loader stages per frame.
+    uint32_t uploadBudgetMegabytes = 8;
+
+    /// @brief Copy uploads on a dedicated transfer queue where the device has one (and timeline semaphores).
+    bool transferQueue = true;
+
+    /// @brief The device memory in MiB streamed textures may use before unused mip levels are evicted.
+    uint32_t textureBudgetMegabytes = 256;
+
+    /// @brief Use descriptor indexing for the global texture and buffer table where supported, instead of per-frame sets.
+    bool bindless = true;
+
+    // --- Scene ---
+    /// @brief A mesh file (.obj or .glb) loaded in the background and drawn in place of the cube once uploaded.
+    std::string meshPath;
+    /// @brief A texture file (.ktx2 or .dds) loaded in the background, shown in the texture panel and mapped onto the scene.
+    std::string texturePath;
+    /// @brief Spawns an N x N x N grid of instanced cubes instead of the single cube. 0 disables it.
+    uint32_t instanceGrid = 0;
+    /// @brief Cull instances in a compute pass and draw them with indirect draws, where supported.
+    bool gpuCulling = true;
+    /// @brief Cull instances on the CPU (SIMD, multithreaded) whenever GPU culling is not used.
+    bool cpuCulling = true;
+    /// @brief Let CPU culling traverse a BVH over the instances instead of testing each one.
+    bool bvhCulling = true;
+    /// @brief The mesh the instance grid draws: "cube" or "sphere" (a tessellated sphere with a generated LOD chain).
+    std::string instanceMesh = "cube";
+    /// @brief Draw meshes with a LOD chain at the coarsest level whose error stays below lodPixelError.
+    bool lods = true;
+    /// @brief The largest projected simplification error, in pixels, a level of detail may have.
+    float lodPixelError = 1.0f;
+    /// @brief The vertex buffer layout of loaded meshes: "float" (24 bytes), "half" or "snorm16" (12 bytes each).
+    std::string vertexLayout = "float";
+    /// @brief Reorder imported meshes for the post-transform vertex cache, overdraw and vertex fetch.
+    bool meshOptimization = true;
+
+    // --- Resolution ---
+    /// @brief Lower the resolution the scene is shaded at when the GPU frame time exceeds targetFrameMs, and upsample it.
+    bool dynamicResolution = false;
+    /// @brief The GPU frame time in milliseconds dynamic resolution aims for.
+    float targetFrameMs = 16.0f;
+    /// @brief The lowest fraction of the viewport size, per axis, dynamic resolution may render at.
+    float minRenderScale = 0.5f;
+    /// @brief Render below the viewport's resolution and upscale in compute: "off", "ultra-quality", "quality", "balanced" or "performance".
+    std::string upscalePreset = "off";
+
+    // --- Headless Benchmarking ---
+    /// @brief Run without a window, swapchain or UI, rendering only the offscreen scene.
+    bool headless = false;
+    /// @brief The number of frames to render in headless mode before exiting.
+    uint32_t benchmarkFrames = 1000;
+    /// @brief The number of initial frames excluded from the headless timing statistics.
+    uint32_t benchmarkWarmupFrames = 16;
+    /// @brief Optional path of a JSON file the headless timing statistics are written to.
+    std::string benchmarkOutput;
+    /// @brief The width of the offscreen scene image in headless mode.
+    uint32_t sceneWidth = 1280;
+    /// @brief The height of the offscreen scene image in headless mode.
+    uint32_t sceneHeight = 720;
+    /// @brief Run the CPU culling micro-benchmark instead of starting the engine.
+    bool cullBenchmark = false;
+
+    // --- Profiling ---
+    /// @brief Optional path of a Chrome trace JSON file written at shutdown.
+    std::string cpuTraceOutput;
+
+    /**
+     * @brief Loads settings from a config file.
+     *
+     * Missing files are not an error; the defaults are simply kept.
+     * Lines starting with '#' are treated as comments.
+     *
+     * @param path The path to the config file.
+     * @return True if the file was found and read, false otherwise.
+     */
+    bool LoadFromFile(const std::string& path);
+
+    /**
+     * @brief Applies overrides passed on the command line.
+     * @param argc The argument count from main().
+     * @param argv The argument vector from main().
+     */
+    void ApplyCommandLine(int argc, char** argv);
+
+    /**
+     * @brief Clamps all settings to their supported ranges, logging any adjustment.
+     */
+    void Validate();
+
+private:
+    /**
+     * @brief Applies a single setting.
+     * @param key The setting name.
+     * @param value The setting value as text.
+     * @return True if the key was recognized and the value parsed, false otherwise.
+     */
+    bool set(const std::string& key, const std::string& value);
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Computes the 64-bit FNV-1a hash of a block of bytes.
+ *
+ * Fast and dependency-free; suitable for cache keys and file integrity checks,
+ * not for security purposes. Hashes can be chained by passing a previous
+ * result as the seed.
+ *
+ * @param data The bytes to hash.
+ * @param size The number of bytes.
+ * @param seed The starting value, the FNV offset basis by default.
+ * @return The hash value.
+ */
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Computes the 64-bit FNV-1a hash of a string.
+ * @param text The string to hash.
+ * @param seed The starting value, the FNV offset basis by default.
+ * @return The hash value.
+ */
+inline uint64_t HashString(const std::string& text, uint64_t seed = 0xcbf29ce484222325ull)
+{
+    return HashBytes(text.data(), text.size(), seed);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief A read-only view of a whole file mapped into memory.
+ *
+ * The file's pages are loaded by the OS as they are touched instead of being
+ * copied into a buffer first, so reading a file straight into another place
+ * (e.g. a staging buffer) costs one copy. Prefetch() touches every page ahead
+ * of time, so a worker can take the disk reads off the thread that copies.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Maps a file.
+     * @param path The file path. Throws std::runtime_error if it cannot be opened or is empty.
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Gets the first byte of the file.
+     */
+    const uint8_t* GetData() const { return m_data; }
+
+    /**
+     * @brief Gets the size of the file in bytes.
+     */
+    size_t GetSize() const { return m_size; }
+
+    /**
+     * @brief Reads one byte of every page, so later reads do not wait for the disk.
+     */
+    void Prefetch() const;
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;    ///< The file HANDLE.
+    void* m_mapping = nullptr; ///< The file mapping HANDLE.
+#else
+    int m_descriptor = -1;
+#endif
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+/**
+ * @brief Gets the lower-case extension of a path, including the dot.
+ *
+ * Both '/' and '\' separate directories, so a dot in a directory name is not
+ * taken for an extension.
+ *
+ * @param path The file path.
+ * @return The extension, e.g. ".glb", or an empty string if the file name has none.
+ */
+inline std::string GetPathExtension(const std::string& path)
+{
+    size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos || path.find_first_of("/\\", dot) != std::string::npos) {
+        return {};
+    }
+    std::string extension = path.substr(dot);
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension;
+}
+
+/**
+ * @brief Gets the file name of a path without its directories and extension.
+ * @param path The file path.
+ * @return The stem, e.g. "sponza" for "assets/sponza.glb".
+ */
+inline std::string GetPathStem(const std::string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    size_t dot = name.find_last_of('.');
+    return dot == std::string::npos ? name : name.substr(0, dot);
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Profiling zones are compiled in unless the build sets ENGINE_ENABLE_PROFILING=0
+// (CMake option ENGINE_ENABLE_PROFILING).
+#ifndef ENGINE_ENABLE_PROFILING
+#define ENGINE_ENABLE_PROFILING 1
+#endif
+
+/**
+ * @class CpuProfiler
+ * @brief A low-overhead scoped-zone CPU profiler with Chrome trace export.
+ *
+ * Every thread records completed zones into its own fixed-size ring buffer, so
+ * recording never allocates and threads never contend with each other. The
+ * most recent events of all threads can be written at any time as a
+ * Chrome/Perfetto-compatible JSON trace (load it in chrome://tracing or
+ * ui.perfetto.dev).
+ *
+ * Zones are normally created with the ENGINE_PROFILE_SCOPE / ENGINE_PROFILE_FUNCTION
+ * macros, which compile to nothing when profiling is disabled.
+ */
+class CpuProfiler
+{
+public:
+    /// @brief The number of most recent events kept per thread.
+    static constexpr size_t EventsPerThread = 1 << 16;
+
+    /**
+     * @brief Gets the current time of the profiler clock.
+     * @return A monotonic timestamp in nanoseconds.
+     */
+    static uint64_t Now();
+
+    /**
+     * @brief Records a completed zone on the calling thread.
+     * @param name The zone name. Must outlive the profiler (normally a string literal).
+     * @param startNs The start timestamp from Now().
+     * @param endNs The end timestamp from Now().
+     */
+    static void Record(const char* name, uint64_t startNs, uint64_t endNs);
+
+    /**
+     * @brief Sets the name the calling thread is shown with in traces.
+     * @param name The thread name.
+     */
+    static void SetThreadName(const std::string& name);
+
+    /**
+     * @brief Writes the buffered events of all threads as a Chrome trace JSON file.
+     * @param path The output file path.
+     * @return True on success, false if the file could not be written.
+     */
+    static bool WriteChromeTrace(const std::string& path);
+};
+
+/**
+ * @class CpuProfileScope
+ * @brief RAII helper that records a zone from its construction to its destruction.
+ */
+class CpuProfileScope
+{
+public:
+    explicit CpuProfileScope(const char* name)
+        : m_name(name), m_start(CpuProfiler::Now())
+    {
+    }
+
+    ~CpuProfileScope()
+    {
+        CpuProfiler::Record(m_name, m_start, CpuProfiler::Now());
+    }
+
+    CpuProfileScope(const CpuProfileScope&) = delete;
+    CpuProfileScope& operator=(const CpuProfileScope&) = delete;
+
+private:
+    const char* m_name; ///< The zone name.
+    uint64_t m_start;   ///< The zone start timestamp in nanoseconds.
+};
+
+#if ENGINE_ENABLE_PROFILING
+    #define ENGINE_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_IMPL(a, b)
+    #if defined(_MSC_VER)
+        #define ENGINE_PROFILE_FUNCTION_NAME __FUNCTION__
+    #else
+        #define ENGINE_PROFILE_FUNCTION_NAME __PRETTY_FUNCTION__
+    #endif
+
+    /// @brief Profiles the enclosing scope under the given name (a string literal).
+    #define ENGINE_PROFILE_SCOPE(name) CpuProfileScope ENGINE_PROFILE_CONCAT(profileScope, __LINE__)(name)
+    /// @brief Profiles the enclosing function under its own name.
+    #define ENGINE_PROFILE_FUNCTION() ENGINE_PROFILE_SCOPE(ENGINE_PROFILE_FUNCTION_NAME)
+#else
+    #define ENGINE_PROFILE_SCOPE(name) ((void)0)
+    #define ENGINE_PROFILE_FUNCTION() ((void)0)
+#endif
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * @struct GpuScopeStats
+ * @brief Timing history of one named GPU scope (e.g. "Scene" or "ImGui").
+ */
+struct GpuScopeStats
+{
+    std::string name;             ///< The scope name passed to BeginScope().
+    double lastMilliseconds = 0.0; ///< The most recent resolved duration.
+    std::vector<float> history;   ///< Rolling window of recent durations in milliseconds, oldest first.
+    std::vector<double> recorded; ///< Every resolved duration, only filled while recording is enabled.
+};
+
+/**
+ * @class GpuProfiler
+ * @brief Measures GPU execution time of named command buffer scopes with timestamp queries.
+ *
+ * Each frame in flight owns a slice of one timestamp query pool. Scopes write a
+ * timestamp at their start and end; the results of a frame slot are read back in
+ * BeginFrame() the next time that slot is used, i.e. after its fence has been
+ * waited on. Reading therefore never stalls, at the cost of a latency of
+ * `framesInFlight` frames.
+ *
+ * If the queue does not support timestamps, every method is a no-op and
+ * IsSupported() returns false.
+ */
+class GpuProfiler
+{
+public:
+    /// @brief The maximum number of scopes that can be recorded in one frame.
+    static constexpr uint32_t MaxScopesPerFrame = 32;
+    /// @brief The number of samples kept in the rolling history of each scope.
+    static constexpr size_t HistoryLength = 240;
+
+    /**
+     * @brief Creates the timestamp query pool.
+     * @param device The logical Vulkan device.
+     * @param physicalDevice The physical device, used to query timestamp support and period.
+     * @param queueFamilyIndex The queue family the profiled command buffers are submitted to.
+     * @param framesInFlight The number of frames in flight, one query slice is created per frame.
+     */
+    GpuProfiler(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, uint32_t framesInFlight);
+
+    /**
+     * @brief Destroys the query pool.
+     */
+    ~GpuProfiler();
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    /**
+     * @brief Starts a new frame on a frame slot and resolves that slot's previous results.
+     *
+     * Must be called after the fence of the frame slot has been waited on and
+     * before any scope of the frame is recorded.
+     *
+     * @param frameIndex The index of the current frame in flight.
+     */
+    void BeginFrame(uint32_t frameIndex);
+
+    /**
+     * @brief Opens a named scope. Must be recorded outside of a render pass.
+     *
+     * The first scope of a frame also records the reset of the frame's queries, so
+     * the first profiled command buffer of a frame must be submitted first.
+     *
+     * @param commandBuffer The command buffer being recorded.
+     * @param name The scope name. Scopes with equal names share one history.
+     */
+    void BeginScope(VkCommandBuffer commandBuffer, const std::string& name);
+
+    /**
+     * @brief Closes the most recently opened scope.
+     * @param commandBuffer The command buffer being recorded.
+     */
+    void EndScope(VkCommandBuffer commandBuffer);
+
+    /**
+     * @brief Resolves the results of all frame slots. Only valid once the device is idle.
+     *
+     * Used at the end of a headless run so the last frames are not lost.
+     */
+    void CollectAll();
+
+    /**
+     * @brief Enables or disables keeping every sample (for benchmark reports).
+     * @param enabled True to record every resolved duration in GpuScopeStats::recorded.
+     */
+    void SetRecording(bool enabled) { m_recording = enabled; }
+
+    /**
+     * @brief Checks whether the queue supports timestamps.
+     * @return True if timings are being measured.
+     */
+    bool IsSupported() const { return m_queryPool != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Gets the statistics of every scope seen so far, in first-seen order.
+     * @return The per-scope statistics.
+     */
+    const std::vector<GpuScopeStats>& GetScopes() const { return m_scopes; }
+
+    /**
+     * @brief Gets the statistics of the whole GPU frame (first scope start to last scope end).
+     * @return The frame statistics, named "Frame".
+     */
+    const GpuScopeStats& GetFrameStats() const { return m_frameStats; }
+
+private:
+    /// @brief The queries written during one use of a frame slot.
+    struct FrameQueries {
+        std::vector<uint32_t> scopeIndices; ///< Index into m_scopes of each recorded scope, in query order.
+        std::vector<uint32_t> openScopes;   ///< Query pairs that have been opened but not yet closed.
+        bool needsReset = true;             ///< The slot's queries must be reset before the first write.
+    };
+
+    /**
+     * @brief Reads back and accumulates the results of one frame slot, then clears it.
+     * @param frameIndex The frame slot to resolve.
+     */
+    void resolveFrame(uint32_t frameIndex);
+
+    /**
+     * @brief Adds a sample to a scope's rolling history (and recorded samples, if enabled).
+     * @param stats The scope statistics to update.
+     * @param milliseconds The resolved duration.
+     */
+    void addSample(GpuScopeStats& stats, double milliseconds);
+
+    /**
+     * @brief Finds the statistics entry for a scope name, creating it if needed.
+     * @param name The scope name.
+     * @return The index of the entry in m_scopes.
+     */
+    uint32_t findOrAddScope(const std::string& name);
+
+    VkDevice m_device;
+    VkQueryPool m_queryPool = VK_NULL_HANDLE;
+    double m_timestampPeriodNs = 1.0; ///< Nanoseconds per timestamp tick.
+    uint64_t m_timestampMask = ~0ull; ///< Mask of the valid timestamp bits.
+    bool m_recording = false;
+
+    std::vector<FrameQueries> m_frames;
+    uint32_t m_currentFrame = 0;
+
+    std::vector<GpuScopeStats> m_scopes;
+    GpuScopeStats m_frameStats;
+};
@@ -1,32 +1,100 @@
 #pragma once
 
+#include "EngineCore/Assets/MeshLoader.hpp"
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+#include "EngineCore/Vulkan/FrameRingBuffer.hpp"
+#include "EngineCore/Vulkan/DeviceFeatures.hpp"
+#include "EngineCore/Vulkan/BindlessTable.hpp"
+#include "EngineCore/Vulkan/DeletionQueue.hpp"
+#include "EngineCore/Vulkan/DescriptorAllocator.hpp"
+#include "EngineCore/Rendering/DynamicResolution.hpp"
+#include "EngineCore/Rendering/Upscaler.hpp"
+#include "EngineCore/Scene/CullingSystem.hpp"
+#include "EngineCore/Scene/Bvh.hpp"
+#include "EngineCore/Scene/LodSelector.hpp"
+
 #include <vulkan/vulkan.h>
 #include <glm/glm.hpp>
 #include "imgui.h"
 
+#include <array>
 #include <vector>
 #include <memory>
 #include <string>
 
+class GpuProfiler;
+class GpuCulling;
+class ThreadPool;
+class UploadQueue;
+
 /**
  * @struct UniformBufferObject
  * @brief Defines the structure of the uniform buffer that will be sent to the vertex shader.
- * It contains the model, view, and projection matrices for 3D transformation.
+ * It contains the model, view, and projection matrices for 3D transformation, and
+ * the drawn mesh's dequantization of packed vertex positions.
  */
 struct UniformBufferObject {
     glm::mat4 model;
     glm::mat4 view;
     glm::mat4 proj;
+    glm::vec4 positionScale;  ///< See VertexQuantization.
+    glm::vec4 positionOffset;
+};
+
+/**
+ * @struct InstanceData
+ * @brief Per-instance attributes of the instanced path, read through an instance-rate vertex binding.
+ */
+struct InstanceData {
+    glm::mat4 model; ///< The instance's model matrix, applied before the scene transform.
+    glm::vec4 color; ///< Multiplied with the vertex color.
 };
 
 /**
- * @struct Vertex
- * @brief Defines the structure of a single vertex.
- * It contains the position and color attributes.
+ * @struct MaterialConstants
+ * @brief The push constants of the scene pipelines: the bindless slots and parameters of the drawn material.
+ *
+ * Meshes have no texture coordinates, so the albedo texture is projected
+ * along the object-space axes, blended by the surface orientation.
  */
-struct Vertex {
-    glm::vec3 pos;
-    glm::vec3 color;
+struct MaterialConstants {
+    uint32_t albedoTexture = BindlessTable::DefaultTexture; ///< A texture slot of the BindlessTable, multiplied with the vertex color.
+    float textureScale = 1.0f;                              ///< Texture repeats per object-space unit.
+};
+
+/**
+ * @struct RendererCreateInfo
+ * @brief Everything the Renderer needs from its owner at construction time.
+ *
+ * The Vulkan handles are owned by the Application and must outlive the Renderer.
+ */
+struct RendererCreateInfo {
+    VkDevice device = VK_NULL_HANDLE;                 ///< The logical Vulkan device.
+    VkPhysicalDevice physicalDevice = VK_NULL_HANDLE; ///< The physical Vulkan device (GPU).
+    VkCommandPool commandPool = VK_NULL_HANDLE;       ///< The command pool for creating command buffers.
+    VkQueue graphicsQueue = VK_NULL_HANDLE;           ///< The queue for submitting graphics commands.
+    GpuAllocator* allocator = nullptr;                ///< The allocator all buffer and image memory comes from.
+    UploadQueue* uploadQueue = nullptr;               ///< The staging ring buffer uploads go through; its graphics queue must be graphicsQueue.
+    BindlessTable* bindless = nullptr;                ///< The texture and buffer table the scene shaders index; BeginFrame() is called by Render().
+    DescriptorAllocator* descriptorAllocator = nullptr; ///< Layouts and sets come from here; its BeginFrame() is called by the owner.
+    DeletionQueue* deletionQueue = nullptr;           ///< Replaced resources are retired here; its BeginFrame() is called by the owner.
+    uint32_t framesInFlight = 2;                      ///< The number of frames to be processed concurrently.
+    VkDeviceSize frameDataBytes = 8 * 1024 * 1024;    ///< Per-frame capacity of the dynamic data ring buffer.
+    VkExtent2D sceneExtent = { 0, 0 };                ///< The initial extent (size) of the scene.
+    bool enableDynamicResolution = false;             ///< Scale the rendered part of the scene image to hold the target GPU frame time.
+    float targetFrameMilliseconds = 16.0f;            ///< The GPU frame time dynamic resolution aims for.
+    float minRenderScale = 0.5f;                      ///< The lowest render scale dynamic resolution may use.
+    UpscalePreset upscalePreset = UpscalePreset::Off; ///< Render below the viewport's resolution and upscale in compute passes.
+    bool enableImGui = true;                          ///< Expose the scene image as an ImGui texture (off in headless mode).
+    GpuProfiler* profiler = nullptr;                  ///< Optional GPU profiler the scene pass is timed with.
+    VkPipelineCache pipelineCache = VK_NULL_HANDLE;   ///< Optional pipeline cache shared by all pipeline creation.
+    DeviceFeatures features;                          ///< The optional features enabled on the device.
+    bool enableGpuCulling = true;                     ///< Cull instances in a compute pass and draw them indirectly, if supported.
+    bool enableCpuCulling = true;                     ///< Cull instances on the CPU when GPU culling is inactive.
+    bool enableBvhCulling = true;                     ///< Cull hierarchically through the instance BVH instead of testing every instance.
+    bool enableLods = true;                           ///< Pick a level of detail per culled instance from its projected error.
+    float lodPixelError = 1.0f;                       ///< The largest projected simplification error, in pixels, a level may have.
+    ThreadPool* threadPool = nullptr;                 ///< Optional workers CPU culling and BVH builds are split across.
 };
 
 /**
@@ -43,14 +111,9 @@ class Renderer
 public:
     /**
      * @brief Constructs the Renderer object.
-     * @param device The logical Vulkan device.
-     * @param physicalDevice The physical Vulkan device (GPU).
-     * @param commandPool The command pool for creating command buffers.
-     * @param graphicsQueue The queue for submitting graphics commands.
-     * @param framesInFlight The number of frames to be processed concurrently.
-     * @param swapChainExtent The initial extent (size) of the scene.
-     */
-    Renderer(VkDevice device, VkPhysicalDevice physicalDevice, VkCommandPool commandPool, VkQueue graphicsQueue, uint32_t framesInFlight, VkExtent2D swapChainExtent);
+     * @param createInfo The device handles and settings the renderer is created with.
+     */
+    explicit Renderer(const RendererCreateInfo& createInfo);
     
     /**
      * @brief Destroys the Renderer object and cleans up all Vulkan resources.
@@ -62,10 +125,18 @@ public:
     Renderer& operator=(const Renderer&) = delete;
 
     /**
-     * @brief Renders the scene for a specific frame.
+     * @brief Records the scene pass for a specific frame.
+     *
+     * The commands are recorded into a command buffer owned by the Renderer
+     * (one per frame in flight). Nothing is submitted here: the caller must
+     * submit the returned buffer ahead of any work that samples the scene
+     * texture, in the same batch or ordered by a semaphore. The caller is also
+     * responsible for waiting on the fence of this frame slot beforehand.
+     *
      * @param currentFrame The index of the current frame in flight.
+     * @return The recorded command buffer for this frame.
      */
-    void Render(uint32_t currentFrame);
+    VkCommandBuffer Render(uint32_t currentFrame);
 
     /**
      * @brief Updates the view and projection matrices from the camera.
@@ -74,18 +145,219 @@ public:
      */
     void SetViewProjection(const glm::mat4& view, const glm::mat4& projection);
 
+    /**
+     * @brief Replaces the instances drawn by the instanced path.
+     *
+     * The instances are uploaded to a device-local buffer and drawn with a single
+     * instanced draw call, or frustum-culled on the GPU and drawn indirectly when
+     * GPU culling is active, or culled on the CPU with only the visible ones copied
+     * to the frame ring buffer; the inspector transform applies to all of them. A
+     * BVH over their boxes is rebuilt for hierarchical culling and picking. An
+     * empty list switches back to drawing the single cube. The old buffers are
+     * retired to the deletion queue, so frames in flight keep drawing them, but
+     * the upload and the BVH build make this too costly to call every frame.
+     *
+     * @param instances The per-instance data.
+     */
+    void SetInstances(const std::vector<InstanceData>& instances);
+
+    /**
+     * @brief Replaces the mesh drawn by both the single-object and the instanced path.
+     *
+     * The mesh's LOD chain is kept as index ranges of one index buffer. When
+     * instances are culled, on the GPU or the CPU, each visible instance is
+     * drawn with the coarsest level whose error projects below the configured
+     * pixel error; without culling, the finest level is drawn. If instances
+     * are drawn, their bounds are derived from the mesh and rebuilt, which
+     * waits for the device to be idle.
+     *
+     * @param mesh A Ready mesh from a MeshLoader, or null for the built-in cube. It is not
+     *             owned and must outlive its use, including frames in flight that draw it.
+     */
+    void SetMesh(const GpuMesh* mesh);
+
+    /**
+     * @brief Sets the material the scene is drawn with, pushed as constants with every frame.
+     * @param material The bindless slots and parameters; slots must stay registered while frames in flight use them.
+     */
+    void SetMaterial(const MaterialConstants& material) { m_material = material; }
+
+    /**
+     * @brief Gets the material the scene is drawn with.
+     */
+    const MaterialConstants& GetMaterial() const { return m_material; }
+
+    /**
+     * @brief Gets the drawn mesh.
+     * @return The mesh set with SetMesh(), or the built-in cube.
+     */
+    const GpuMesh& GetMesh() const { return *m_mesh; }
+
+    /**
+     * @brief Gets the levels of detail of the drawn mesh.
+     * @return The index ranges and errors, finest first.
+     */
+    const std::vector<MeshLod>& GetMeshLods() const { return m_mesh->lods; }
+
+    /**
+     * @brief Checks whether culled instances are drawn with a level of detail selected per instance.
+     */
+    bool IsLodEnabled() const { return m_lodEnabled; }
+
+    /**
+     * @brief Toggles level-of-detail selection; disabled, every instance uses the finest level.
+     */
+    void SetLodEnabled(bool enabled) { m_lodEnabled = enabled; }
+
+    /**
+     * @brief Gets the number of instances drawn with each level of detail in the last recorded frame.
+     * @return One count per level; all zero while GPU culling selects the levels.
+     */
+    const std::vector<uint32_t>& GetLodInstanceCounts() const { return m_lodInstanceCounts; }
+
+    /**
+     * @brief Gets the number of instances drawn by the instanced path.
+     * @return The instance count, 0 if the single cube is drawn.
+     */
+    uint32_t GetInstanceCount() const { return m_instanceCount; }
+
+    /**
+     * @brief Checks whether instances are currently culled on the GPU.
+     * @return True if the culling pass exists and is enabled.
+     */
+    bool IsGpuCullingActive() const { return m_gpuCulling && m_gpuCullingEnabled; }
+
+    /**
+     * @brief Toggles GPU culling. Has no effect if the device does not support it.
+     * @param enabled Whether to cull instances on the GPU.
+     */
+    void SetGpuCullingEnabled(bool enabled) { m_gpuCullingEnabled = enabled; }
+
+    /**
+     * @brief Checks whether instances are culled on the CPU, which happens while GPU culling is inactive.
+     * @return True if CPU culling is enabled and GPU culling is not active.
+     */
+    bool IsCpuCullingActive() const { return m_cpuCullingEnabled && !IsGpuCullingActive(); }
+
+    /**
+     * @brief Toggles CPU culling. Only available if it was enabled at creation.
+     * @param enabled Whether to cull instances on the CPU when GPU culling is inactive.
+     */
+    void SetCpuCullingEnabled(bool enabled) { m_cpuCullingEnabled = enabled && !m_instances.empty(); }
+
+    /**
+     * @brief Gets the number of instances that passed culling.
+     * @return The visible instance count (a few frames old with GPU culling), or the instance count when nothing was
+     *         culled: without culling, or when the CPU survivors did not fit into the per-frame ring buffer.
+     */
+    uint32_t GetVisibleCount() const;
+
+    /**
+     * @brief Checks whether CPU culling traverses the instance BVH instead of testing every instance.
+     * @return True if BVH culling is enabled.
+     */
+    bool IsBvhCullingEnabled() const { return m_bvhCullingEnabled; }
+
+    /**
+     * @brief Toggles hierarchical culling through the instance BVH. Only affects CPU culling.
+     * @param enabled Whether to query the BVH.
+     */
+    void SetBvhCullingEnabled(bool enabled) { m_bvhCullingEnabled = enabled; }
+
+    /**
+     * @brief Finds the instance under a world-space ray, e.g. one through the mouse cursor.
+     *
+     * The ray is moved into instance space by the inverse of the inspector
+     * transform and cast against the instance BVH.
+     *
+     * @param origin The ray origin in world space.
+     * @param direction The ray direction in world space.
+     * @return The index of the closest instance whose bounding box is hit, or -1 if none.
+     */
+    int PickInstance(const glm::vec3& origin, const glm::vec3& direction) const;
+
+    /**
+     * @brief Gets the BVH over the instances' bounding boxes, before the scene transform.
+     * @return The instance BVH, empty if the single cube is drawn.
+     */
+    const Bvh& GetInstanceBvh() const { return m_instanceBvh; }
+
     /**
      * @brief Gets the ImGui texture ID for the rendered scene.
+     *
+     * The ID is a transient descriptor set allocated by Render(), so it is only
+     * valid for the UI of the frame just rendered and never has to be
+     * unregistered when the scene image is recreated. Only the part given by
+     * GetSceneUvScale() holds the frame; while the upscaler is active, the
+     * texture is its output, which fills the whole extent.
+     *
      * @return The ImTextureID that can be used with ImGui::Image().
      */
     ImTextureID GetImGuiTextureId() const { return m_sceneTextureId; }
 
     /**
-     * @brief Handles window resize events.
-     * @param newSize The new size of the viewport.
+     * @brief Resizes the scene image, typically to the viewport it is displayed in.
+     *
+     * Recreates the scene image, depth buffer and framebuffer at the new size
+     * and retires the old ones to the deletion queue, without waiting for the
+     * frames in flight that still use them. Each call allocates new targets,
+     * so callers should wait for a size to settle before passing it on.
+     *
+     * @param newSize The new size of the scene image.
      */
     void OnResize(VkExtent2D newSize);
 
+    /**
+     * @brief Gets the number of frames in flight the renderer's per-frame resources are sized for.
+     * @return The number of frames in flight.
+     */
+    uint32_t GetFramesInFlight() const { return m_framesInFlight; }
+
+    /**
+     * @brief Gets the current resolution of the offscreen scene image.
+     * @return The scene extent in pixels.
+     */
+    VkExtent2D GetSceneExtent() const { return m_sceneExtent; }
+
+    /**
+     * @brief Gets the part of the scene image the last frame was rendered to, from its top-left corner.
+     * @return The render extent in pixels; the scene extent unless dynamic resolution lowered it.
+     */
+    VkExtent2D GetRenderExtent() const { return m_renderExtent; }
+
+    /**
+     * @brief Gets the texture coordinates of the bottom-right corner of the rendered part of the scene image.
+     * @return The render extent divided by the scene extent along each axis, or 1 while the upscaler is active.
+     */
+    glm::vec2 GetSceneUvScale() const;
+
+    /**
+     * @brief Gets the controller that scales the render extent to the GPU frame time, for the UI to adjust.
+     */
+    DynamicResolution& GetDynamicResolution() { return m_dynamicResolution; }
+    const DynamicResolution& GetDynamicResolution() const { return m_dynamicResolution; }
+
+    /**
+     * @brief Gets the compute upscaler the scene is shown through, for the UI to pick a preset.
+     *
+     * The preset's render scale applies while dynamic resolution is off; with
+     * dynamic resolution on, the upscaler stretches whatever extent it picked.
+     */
+    Upscaler& GetUpscaler() { return *m_upscaler; }
+    const Upscaler& GetUpscaler() const { return *m_upscaler; }
+
+    /**
+     * @brief Gets the allocator the renderer's resources live in.
+     * @return The GPU memory allocator.
+     */
+    const GpuAllocator& GetAllocator() const { return *m_allocator; }
+
+    /**
+     * @brief Gets the ring buffer per-frame uniforms and dynamic data are written to.
+     * @return The per-frame data ring buffer.
+     */
+    const FrameRingBuffer& GetFrameData() const { return *m_frameData; }
+
     // --- Scene Object Getters (for UI manipulation) ---
     glm::vec3& GetCubePosition() { return m_cubePosition; }
     glm::vec3& GetCubeRotation() { return m_cubeRotation; }
@@ -96,66 +368,148 @@ private:
     void createRenderPass();
     void createDescriptorSetLayout();
     void createGraphicsPipeline();
+    VkPipeline createScenePipeline(const std::string& vertexShaderPath, bool instanced, VertexLayout layout);
     void createFramebuffer();
     void createCubeBuffers();
-    void createUniformBuffers();
-    void createDescriptorPool();
+    void createFrameData();
     void createDescriptorSets();
+    void createCommandBuffers();
+    void createGpuCulling();
+    void createUpscaler(UpscalePreset preset);
 
     /**
-     * @brief Updates the uniform buffer for the current frame with the latest matrices.
-     * @param currentFrame The index of the current frame in flight.
+     * @brief Writes the latest matrices to the current frame's partition of the ring buffer.
+     * @return The dynamic offset of the uniform data.
+     */
+    uint32_t updateUniformBuffer();
+
+    /**
+     * @brief Writes this frame's culling parameters to the ring buffer.
+     * @return The dynamic offset of the parameters.
+     */
+    uint32_t updateCullParams();
+
+    /**
+     * @brief Culls the instances on the CPU and copies the visible ones to the frame ring buffer, grouped by level of detail.
+     *
+     * The number of instances per level is written to m_lodInstanceCounts.
+     *
+     * @param buffer Receives the buffer to bind as the instance vertex buffer.
+     * @param offset Receives the offset of the visible instances in it.
+     */
+    void cullInstancesOnCpu(VkBuffer& buffer, VkDeviceSize& offset);
+
+    /**
+     * @brief Updates the level of detail of each visible instance in m_instanceLods.
      */
-    void updateUniformBuffer(uint32_t currentFrame);
+    void selectInstanceLods();
+
+    /**
+     * @brief Builds the inspector transform applied on top of every object.
+     */
+    glm::mat4 getSceneTransform() const;
+
+    /**
+     * @brief Gets the fraction of the scene extent to render along each axis.
+     * @return The dynamic resolution scale if it is on, otherwise the upscaler preset's.
+     */
+    float getRenderScale() const;
 
     // --- Vulkan Helper Functions ---
-    void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory);
-    void copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
-    uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+    void uploadBuffer(const void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer& buffer, GpuAllocation& allocation);
     VkFormat findDepthFormat();
-    VkShaderModule createShaderModule(const std::vector<char>& code);
-    static std::vector<char> ReadFile(const std::string& filename);
 
     // --- Core Vulkan Handles (owned by Application, used by Renderer) ---
     VkDevice m_device;
     VkPhysicalDevice m_physicalDevice;
     VkCommandPool m_commandPool;
     VkQueue m_graphicsQueue;
+    GpuAllocator* m_allocator;
+    UploadQueue* m_uploadQueue;
+    BindlessTable* m_bindless;
+    DescriptorAllocator* m_descriptorAllocator;
+    DeletionQueue* m_deletionQueue;
+    uint64_t m_uploadBatch = 0; ///< The upload batch holding the renderer's latest buffer copies.
     
     // --- State ---
-    VkExtent2D m_sceneExtent;
     uint32_t m_framesInFlight;
+    VkDeviceSize m_frameDataBytes;
+    VkExtent2D m_sceneExtent;
+    VkExtent2D m_renderExtent; ///< The part of the scene image shaded this frame.
+    DynamicResolution m_dynamicResolution;
+    bool m_imGuiEnabled;
+    GpuProfiler* m_profiler; ///< Optional, owned by Application.
+    ThreadPool* m_threadPool; ///< Optional, owned by Application.
+    VkPipelineCache m_pipelineCache; ///< Optional, owned by Application.
+    DeviceFeatures m_features;
+    bool m_gpuCullingEnabled;
+    bool m_cpuCullingAvailable; ///< Whether the bounding spheres for CPU culling are kept.
+    bool m_cpuCullingEnabled;
+    bool m_bvhCullingEnabled;
+    bool m_lodEnabled;
 
     // --- Offscreen Rendering Resources ---
     VkImage m_sceneImage = VK_NULL_HANDLE;
-    VkDeviceMemory m_sceneImageMemory = VK_NULL_HANDLE;
+    GpuAllocation m_sceneImageMemory;
     VkImageView m_sceneImageView = VK_NULL_HANDLE;
     VkSampler m_sceneSampler = VK_NULL_HANDLE;
     VkFramebuffer m_sceneFramebuffer = VK_NULL_HANDLE;
     VkRenderPass m_sceneRenderPass = VK_NULL_HANDLE;
     ImTextureID m_sceneTextureId = 0;
+    std::unique_ptr<Upscaler> m_upscaler; ///< Shows the scene at the viewport's resolution when rendered below it.
 
     // --- Depth Buffer Resources ---
     VkImage m_depthImage = VK_NULL_HANDLE;
-    VkDeviceMemory m_depthImageMemory = VK_NULL_HANDLE;
+    GpuAllocation m_depthImageMemory;
     VkImageView m_depthImageView = VK_NULL_HANDLE;
     
+    // --- Per-Frame Command Buffers ---
+    std::vector<VkCommandBuffer> m_commandBuffers; ///< One scene command buffer per frame in flight.
+
     // --- Graphics Pipeline ---
     VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
-    VkPipeline m_graphicsPipeline = VK_NULL_HANDLE;
+    std::array<VkPipeline, VertexLayoutCount> m_graphicsPipelines{};  ///< Indexed by the drawn mesh's VertexLayout.
+    std::array<VkPipeline, VertexLayoutCount> m_instancedPipelines{};
+
+    MaterialConstants m_material;
+
+    // --- Mesh (drawn with all its levels of detail) ---
+    GpuMesh m_cubeMesh;                         ///< The built-in cube, owned by the renderer.
+    const GpuMesh* m_mesh = &m_cubeMesh;        ///< The drawn mesh, not owned unless it is the cube.
+
+    // --- Instance Buffer (for the instanced path) ---
+    VkBuffer m_instanceBuffer = VK_NULL_HANDLE;
+    GpuAllocation m_instanceBufferMemory;
+    uint32_t m_instanceCount = 0;
+
+    // --- GPU Culling (for the instanced path) ---
+    std::unique_ptr<GpuCulling> m_gpuCulling;      ///< Null if disabled or unsupported.
+    VkBuffer m_boundsBuffer = VK_NULL_HANDLE;      ///< One ObjectBounds per instance.
+    GpuAllocation m_boundsBufferMemory;
+    VkBuffer m_meshBuffer = VK_NULL_HANDLE;        ///< MeshDrawInfo table, one entry per level of detail.
+    GpuAllocation m_meshBufferMemory;
+    VkBuffer m_lodStateBuffer = VK_NULL_HANDLE;    ///< Last selected level per instance, for hysteresis.
+    GpuAllocation m_lodStateBufferMemory;
+
+    // --- CPU Culling (for the instanced path) ---
+    CullingSystem m_cpuCulling;
+    std::vector<InstanceData> m_instances;       ///< CPU copy the visible instances are gathered from and bounds are rebuilt from.
+    SphereBoundsSoA m_instanceBounds;            ///< Bounding spheres before the scene transform.
+    Bvh m_instanceBvh;                           ///< Instance boxes before the scene transform, for culling and picking.
+    std::vector<uint32_t> m_visibleInstances;
+    uint32_t m_cpuVisibleCount = 0;
+    bool m_cullingOverflowLogged = false;        ///< The ring buffer overflow is only reported once.
 
-    // --- Mesh Buffers (for the cube) ---
-    VkBuffer m_vertexBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_vertexBufferMemory = VK_NULL_HANDLE;
-    VkBuffer m_indexBuffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_indexBufferMemory = VK_NULL_HANDLE;
+    // --- Level of Detail ---
+    LodSelector m_lodSelector;
+    std::vector<uint8_t> m_instanceLods;         ///< Level each instance was last drawn with, for hysteresis.
+    std::vector<uint32_t> m_lodInstanceCounts;   ///< Instances drawn per level in the last recorded frame.
+    std::vector<uint32_t> m_lodOffsets;          ///< Scratch: first gathered instance of each level.
 
     // --- Uniform Buffer Resources ---
-    VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE;
-    VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
-    std::vector<VkDescriptorSet> m_descriptorSets;
-    std::vector<VkBuffer> m_uniformBuffers;
-    std::vector<VkDeviceMemory> m_uniformBuffersMemory;
+    VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE; ///< Cached by the descriptor allocator.
+    VkDescriptorSet m_descriptorSet = VK_NULL_HANDLE; ///< Points at the ring buffer, offset per draw.
+    std::unique_ptr<FrameRingBuffer> m_frameData;      ///< Per-frame uniforms and dynamic data.
 
     // --- Matrices ---
     glm::mat4 m_viewMatrix;
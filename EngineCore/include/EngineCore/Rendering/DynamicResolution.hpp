@@ -0,0 +1,82 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+/**
+ * @class DynamicResolution
+ * @brief Scales the resolution the scene is rendered at so the GPU frame time stays near a target.
+ *
+ * The scene is shaded into the top-left part of its render target, render
+ * scale times its size along each axis, and stretched over the whole target
+ * when it is composited. Changing the scale is free: only the viewport moves,
+ * nothing is reallocated.
+ *
+ * Update() is fed one GPU frame time per frame. The times are smoothed, and
+ * the scale only moves once they leave a band around the target, by the
+ * square root of target over measured time (shading cost follows the pixel
+ * count, the square of the scale), at most MaxStep per frame. The timings
+ * arrive framesInFlight frames late, so the damping is what keeps the scale
+ * from oscillating.
+ */
+class DynamicResolution
+{
+public:
+    /// @brief The smallest render scale that may be configured.
+    static constexpr float MinScaleLimit = 0.25f;
+    /// @brief Relative distance from the target within which the scale is left alone.
+    static constexpr float Tolerance = 0.05f;
+    /// @brief The largest relative change of the scale in one frame.
+    static constexpr float MaxStep = 0.05f;
+    /// @brief Weight of the newest frame time in the smoothed time.
+    static constexpr float Smoothing = 0.1f;
+
+    /**
+     * @brief Enables or disables scaling; disabled, the scale returns to 1.
+     */
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return m_enabled; }
+
+    /**
+     * @brief Sets the GPU frame time to aim for, in milliseconds.
+     */
+    void SetTargetMilliseconds(float milliseconds) { m_targetMilliseconds = milliseconds; }
+    float GetTargetMilliseconds() const { return m_targetMilliseconds; }
+
+    /**
+     * @brief Sets the lowest scale the resolution may drop to, clamped to [MinScaleLimit, 1].
+     */
+    void SetMinScale(float scale);
+    float GetMinScale() const { return m_minScale; }
+
+    /**
+     * @brief Adjusts the scale to the latest GPU frame time.
+     * @param gpuMilliseconds The GPU time of the most recently resolved frame; ignored if not positive.
+     * @return The render scale to use for the next frame.
+     */
+    float Update(double gpuMilliseconds);
+
+    /**
+     * @brief Gets the current render scale, in [GetMinScale(), 1].
+     */
+    float GetScale() const { return m_scale; }
+
+    /**
+     * @brief Gets the smoothed GPU frame time the scale is adjusted to, in milliseconds.
+     */
+    float GetSmoothedMilliseconds() const { return m_smoothedMilliseconds; }
+
+    /**
+     * @brief Computes the part of a render target a scale covers.
+     * @param targetExtent The size of the render target.
+     * @param scale The render scale.
+     * @return The scaled size, at least one pixel along each axis.
+     */
+    static VkExtent2D ScaleExtent(VkExtent2D targetExtent, float scale);
+
+private:
+    bool m_enabled = false;
+    float m_targetMilliseconds = 16.0f;
+    float m_minScale = 0.5f;
+    float m_scale = 1.0f;
+    float m_smoothedMilliseconds = 0.0f; ///< 0 until the first sample.
+};
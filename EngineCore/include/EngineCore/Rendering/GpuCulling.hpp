@@ -0,0 +1,192 @@
+#pragma once
+
+#include "EngineCore/Vulkan/DeletionQueue.hpp"
+#include "EngineCore/Vulkan/DescriptorAllocator.hpp"
+#include "EngineCore/Vulkan/DeviceFeatures.hpp"
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+/**
+ * @struct ObjectBounds
+ * @brief The culling data of one object, parallel to the renderer's instance buffer.
+ *
+ * Matches the `ObjectBounds` struct in shaders/cull.comp (std430).
+ */
+struct ObjectBounds
+{
+    glm::vec4 sphere;        ///< Bounding sphere in object space: center xyz, radius w.
+    uint32_t meshIndex = 0;  ///< Index of the mesh's finest level in the mesh table.
+    uint32_t lodCount = 1;   ///< Number of consecutive mesh table entries, finest first.
+    uint32_t padding[2] = { 0, 0 };
+};
+
+/**
+ * @struct MeshDrawInfo
+ * @brief Where one level of detail of a mesh lives in the shared index/vertex buffers. Matches `MeshInfo` in shaders/cull.comp.
+ */
+struct MeshDrawInfo
+{
+    uint32_t indexCount = 0;
+    uint32_t firstIndex = 0;
+    int32_t vertexOffset = 0;
+    float error = 0.0f;      ///< Simplification error of the level in object units (MeshLod::error).
+};
+
+/**
+ * @struct CullParams
+ * @brief Per-frame culling inputs, written to the frame ring buffer. Matches `CullParams` in shaders/cull.comp (std140).
+ */
+struct CullParams
+{
+    glm::mat4 sceneTransform;  ///< Applied on top of every instance's model matrix.
+    glm::vec4 planes[6];       ///< World-space frustum planes, facing inwards.
+    uint32_t objectCount = 0;
+    uint32_t compact = 0;      ///< 1: append visible draws and count them; 0: one slot per object.
+    float lodPixelError = 0.0f; ///< Largest projected error of a level in pixels (LodSelector); 0 forces the finest level.
+    float lodHysteresis = 0.0f; ///< Fraction the error must drop below the threshold before coarsening.
+    glm::vec4 lodCamera{ 0.0f }; ///< World-space camera position (xyz) and pixels per unit at distance 1 (w).
+};
+
+/**
+ * @class GpuCulling
+ * @brief Frustum-culls the scene in a compute pass and draws the survivors with indirect draws.
+ *
+ * The compute shader reads the persistent instance and bounds buffers and
+ * writes one VkDrawIndexedIndirectCommand per visible object, with
+ * firstInstance set to the object's index so the instance-rate vertex
+ * attributes fetch the right transform. With drawIndirectCount the commands
+ * are compacted and their number written to a count buffer consumed by
+ * vkCmdDrawIndexedIndirectCount; otherwise every object keeps its slot and
+ * culled ones get an instanceCount of 0. Either way the CPU cost per frame
+ * does not depend on the number of objects.
+ *
+ * Visible objects also get their level of detail picked the way LodSelector
+ * does on the CPU, with each object's last level kept in a persistent buffer
+ * for the hysteresis.
+ *
+ * Each frame in flight owns its command and count buffers. The count buffer
+ * is host-visible, so the number of visible objects can be read back once the
+ * frame's fence has been waited on.
+ */
+class GpuCulling
+{
+public:
+    /// @brief Threads per workgroup, must match local_size_x in shaders/cull.comp.
+    static constexpr uint32_t WorkgroupSize = 64;
+
+    /**
+     * @brief Checks whether the device supports the features the culling pass relies on.
+     * @param features The enabled device features.
+     * @return True if indirect draws with firstInstance and multiple draws are available.
+     */
+    static bool IsSupported(const DeviceFeatures& features);
+
+    /**
+     * @brief Creates the compute pipeline and descriptor layout.
+     * @param device The logical Vulkan device.
+     * @param allocator The allocator the per-frame buffers come from.
+     * @param descriptorAllocator The allocator the descriptor layout and per-frame sets come from.
+     * @param deletionQueue The queue replaced per-frame buffers are retired to.
+     * @param features The enabled device features.
+     * @param framesInFlight The number of frames in flight.
+     * @param pipelineCache The pipeline cache used to create the compute pipeline.
+     */
+    GpuCulling(VkDevice device, GpuAllocator& allocator, DescriptorAllocator& descriptorAllocator, DeletionQueue& deletionQueue,
+        const DeviceFeatures& features, uint32_t framesInFlight, VkPipelineCache pipelineCache);
+
+    /**
+     * @brief Destroys the pipeline and all per-frame buffers.
+     */
+    ~GpuCulling();
+
+    GpuCulling(const GpuCulling&) = delete;
+    GpuCulling& operator=(const GpuCulling&) = delete;
+
+    /**
+     * @brief Points the pass at a new scene.
+     *
+     * The buffers of the old scene are retired to the deletion queue by their
+     * owner; frames in flight keep drawing with them, as the descriptor sets
+     * are written per frame.
+     *
+     * @param instanceBuffer The per-instance transforms (InstanceData), also used as a storage buffer.
+     * @param boundsBuffer One ObjectBounds per instance.
+     * @param meshBuffer The MeshDrawInfo table, one entry per level of detail.
+     * @param lodStateBuffer One uint32_t per instance holding its last level of detail, zero-initialized.
+     *                       Shared by all frame slots; Dispatch() orders it after the previous frame's writes.
+     * @param objectCount The number of instances.
+     * @param paramsBuffer The buffer CullParams are written to (bound with a dynamic offset).
+     */
+    void SetScene(VkBuffer instanceBuffer, VkBuffer boundsBuffer, VkBuffer meshBuffer, VkBuffer lodStateBuffer, uint32_t objectCount, VkBuffer paramsBuffer);
+
+    /**
+     * @brief Reads back the visible count of a frame slot. Call after waiting on the slot's fence.
+     * @param frameIndex The index of the current frame in flight.
+     */
+    void BeginFrame(uint32_t frameIndex);
+
+    /**
+     * @brief Records the culling dispatch. Must be recorded outside of a render pass.
+     * @param commandBuffer The command buffer being recorded.
+     * @param frameIndex The index of the current frame in flight.
+     * @param paramsOffset The dynamic offset of this frame's CullParams.
+     */
+    void Dispatch(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint32_t paramsOffset);
+
+    /**
+     * @brief Records the indirect draws. The pipeline, vertex and index buffers must be bound.
+     * @param commandBuffer The command buffer being recorded.
+     * @param frameIndex The index of the current frame in flight.
+     */
+    void Draw(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+    /**
+     * @brief Whether commands are compacted and drawn with vkCmdDrawIndexedIndirectCount.
+     *
+     * False without drawIndirectCount, or if the scene has more objects than one
+     * indirect draw call may issue. Written to CullParams::compact each frame.
+     */
+    bool UsesDrawCount() const { return m_compact; }
+
+    /**
+     * @brief Gets the number of objects that passed culling, `framesInFlight` frames ago.
+     */
+    uint32_t GetVisibleCount() const { return m_visibleCount; }
+
+private:
+    void createPipeline(VkPipelineCache pipelineCache);
+    void destroyFrameBuffers();
+    VkDescriptorSet writeDescriptorSet(uint32_t frameIndex);
+
+    VkDevice m_device;
+    GpuAllocator& m_allocator;
+    DescriptorAllocator& m_descriptorAllocator;
+    DeletionQueue& m_deletionQueue;
+    DeviceFeatures m_features;
+    uint32_t m_framesInFlight;
+
+    VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE; ///< Cached by the descriptor allocator; sets are transient.
+    VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline m_pipeline = VK_NULL_HANDLE;
+
+    // --- Per-Frame Outputs ---
+    std::vector<VkBuffer> m_commandBuffers;       ///< VkDrawIndexedIndirectCommand per object.
+    std::vector<GpuAllocation> m_commandMemory;
+    std::vector<VkBuffer> m_countBuffers;         ///< Number of visible objects (host-visible).
+    std::vector<GpuAllocation> m_countMemory;
+
+    // --- Scene Inputs (owned by the renderer) ---
+    VkBuffer m_instanceBuffer = VK_NULL_HANDLE;
+    VkBuffer m_boundsBuffer = VK_NULL_HANDLE;
+    VkBuffer m_meshBuffer = VK_NULL_HANDLE;
+    VkBuffer m_lodStateBuffer = VK_NULL_HANDLE;
+    VkBuffer m_paramsBuffer = VK_NULL_HANDLE;
+
+    uint32_t m_objectCount = 0;
+    bool m_compact = false;
+    uint32_t m_visibleCount = 0;
+};
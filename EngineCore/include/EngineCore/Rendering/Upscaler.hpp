@@ -0,0 +1,183 @@
+#pragma once
+
+#include "EngineCore/Vulkan/DeletionQueue.hpp"
+#include "EngineCore/Vulkan/DescriptorAllocator.hpp"
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @enum UpscalePreset
+ * @brief The resolution the scene is rendered at below the viewport's, and how much it is sharpened.
+ */
+enum class UpscalePreset : uint32_t
+{
+    Off,          ///< Rendered at full resolution (or the dynamic resolution) and shown without the pass.
+    UltraQuality, ///< 77% per axis.
+    Quality,      ///< 67% per axis.
+    Balanced,     ///< 59% per axis.
+    Performance,  ///< 50% per axis, a quarter of the pixels.
+};
+
+/// @brief The number of UpscalePreset values.
+constexpr uint32_t UpscalePresetCount = 5;
+
+/**
+ * @struct UpscalePresetInfo
+ * @brief The settings a preset stands for.
+ */
+struct UpscalePresetInfo
+{
+    const char* name;  ///< As used in the config, e.g. "ultra-quality".
+    const char* label; ///< As shown in the UI, e.g. "Ultra Quality".
+    float renderScale; ///< The render scale used while dynamic resolution is off.
+    float sharpness;   ///< The default sharpening strength, in [0, 1].
+};
+
+/**
+ * @struct UpscaleConstants
+ * @brief The push constants of both passes. Matches `Params` in shaders/upscale.comp and shaders/sharpen.comp.
+ */
+struct UpscaleConstants
+{
+    uint32_t inputWidth = 0;   ///< The rendered part of the scene image, from its top-left corner.
+    uint32_t inputHeight = 0;
+    uint32_t outputWidth = 0;
+    uint32_t outputHeight = 0;
+    float sharpness = 0.0f;
+};
+
+/**
+ * @class Upscaler
+ * @brief Upscales the rendered part of the scene image to the viewport's size in compute passes, and sharpens it.
+ *
+ * The first pass is an edge-adaptive spatial upscale in the spirit of FSR 1's
+ * EASU: twelve texels around each output pixel are filtered with a Lanczos
+ * kernel stretched along the local edge, which keeps edges straight where
+ * a bilinear stretch blurs and staircases them. The second pass is
+ * contrast-adaptive sharpening (CAS) at output resolution, restoring the
+ * detail the filter softened; a sharpness of 0 skips it.
+ *
+ * The output image has the size of the scene image and stays in
+ * VK_IMAGE_LAYOUT_GENERAL, written by the passes and sampled by the UI.
+ * There is one output per renderer rather than per frame in flight: the
+ * barriers recorded by Dispatch() order each frame's writes after the
+ * previous frame's reads on the same queue. Images are only allocated
+ * while a preset other than Off is selected.
+ */
+class Upscaler
+{
+public:
+    /// @brief Threads per workgroup along each axis, must match local_size_x/y in both shaders.
+    static constexpr uint32_t WorkgroupSize = 8;
+    /// @brief The layout the output image is in when the UI samples it.
+    static constexpr VkImageLayout OutputLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    /**
+     * @brief Gets the settings of a preset.
+     */
+    static const UpscalePresetInfo& GetPresetInfo(UpscalePreset preset);
+
+    /**
+     * @brief Parses a preset name.
+     * @param name The name, as in UpscalePresetInfo::name.
+     * @param preset Receives the preset if the name is known.
+     * @return True if the name is known.
+     */
+    static bool ParsePreset(const std::string& name, UpscalePreset& preset);
+
+    /**
+     * @brief Creates the compute pipelines; the output images follow with the first preset other than Off.
+     * @param device The logical Vulkan device.
+     * @param allocator The allocator the output images come from.
+     * @param descriptorAllocator The allocator the descriptor layout and per-frame sets come from.
+     * @param deletionQueue The queue replaced images are retired to.
+     * @param outputExtent The size of the scene image, and of the output.
+     * @param pipelineCache The pipeline cache used to create the compute pipelines.
+     */
+    Upscaler(VkDevice device, GpuAllocator& allocator, DescriptorAllocator& descriptorAllocator, DeletionQueue& deletionQueue,
+        VkExtent2D outputExtent, VkPipelineCache pipelineCache);
+
+    /**
+     * @brief Destroys the pipelines, the sampler and the images.
+     */
+    ~Upscaler();
+
+    Upscaler(const Upscaler&) = delete;
+    Upscaler& operator=(const Upscaler&) = delete;
+
+    /**
+     * @brief Selects a preset and its default sharpness, allocating or retiring the images as needed.
+     */
+    void SetPreset(UpscalePreset preset);
+    UpscalePreset GetPreset() const { return m_preset; }
+
+    /**
+     * @brief Checks whether the passes run, i.e. a preset other than Off is selected.
+     */
+    bool IsActive() const { return m_preset != UpscalePreset::Off; }
+
+    /**
+     * @brief Gets the render scale of the selected preset.
+     */
+    float GetRenderScale() const { return GetPresetInfo(m_preset).renderScale; }
+
+    /**
+     * @brief Overrides the sharpening strength of the preset, in [0, 1]; 0 skips the sharpening pass.
+     */
+    void SetSharpness(float sharpness);
+    float GetSharpness() const { return m_sharpness; }
+
+    /**
+     * @brief Recreates the images at a new size, retiring the old ones to the deletion queue.
+     * @param outputExtent The new size of the scene image.
+     */
+    void Resize(VkExtent2D outputExtent);
+
+    /**
+     * @brief Records both passes. Must be recorded outside of a render pass, after the scene pass.
+     * @param commandBuffer The command buffer being recorded.
+     * @param inputImage The scene image, in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+     * @param inputView A view of the scene image.
+     * @param inputExtent The part of the scene image that was rendered.
+     */
+    void Dispatch(VkCommandBuffer commandBuffer, VkImage inputImage, VkImageView inputView, VkExtent2D inputExtent);
+
+    /**
+     * @brief Gets the view of the upscaled image, in OutputLayout once Dispatch() has been recorded.
+     */
+    VkImageView GetOutputView() const { return m_outputView; }
+
+private:
+    void createPipelines(VkPipelineCache pipelineCache);
+    VkPipeline createPipeline(const char* shaderPath, VkPipelineCache pipelineCache);
+    void createImages();
+    void destroyImages();
+    VkDescriptorSet writeDescriptorSet(VkImageView inputView, VkImageLayout inputLayout, VkImageView outputView);
+
+    VkDevice m_device;
+    GpuAllocator& m_allocator;
+    DescriptorAllocator& m_descriptorAllocator;
+    DeletionQueue& m_deletionQueue;
+    VkExtent2D m_extent;
+
+    UpscalePreset m_preset = UpscalePreset::Off;
+    float m_sharpness = 0.0f;
+
+    VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE; ///< Cached by the descriptor allocator; sets are transient.
+    VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline m_upscalePipeline = VK_NULL_HANDLE;
+    VkPipeline m_sharpenPipeline = VK_NULL_HANDLE;
+    VkSampler m_sampler = VK_NULL_HANDLE; ///< Required by the descriptors; the shaders only use texelFetch.
+
+    // --- Images (output size) ---
+    VkImage m_upscaledImage = VK_NULL_HANDLE;    ///< Written by the upscale pass, read by the sharpening pass.
+    GpuAllocation m_upscaledMemory;
+    VkImageView m_upscaledView = VK_NULL_HANDLE;
+    VkImage m_outputImage = VK_NULL_HANDLE;
+    GpuAllocation m_outputMemory;
+    VkImageView m_outputView = VK_NULL_HANDLE;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <limits>
+
+/**
+ * @struct Aabb
+ * @brief An axis-aligned bounding box. An empty box has min > max, so growing it by a point yields that point.
+ */
+struct Aabb
+{
+    glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 max = glm::vec3(-std::numeric_limits<float>::max());
+
+    /**
+     * @brief Computes the box around this box transformed by a matrix.
+     * @param transform An affine transform.
+     * @return The smallest axis-aligned box containing the transformed box.
+     */
+    Aabb Transformed(const glm::mat4& transform) const
+    {
+        // Each new axis extends by the absolute projections of the three transformed half-size axes
+        glm::vec3 center = glm::vec3(transform * glm::vec4(Center(), 1.0f));
+        glm::vec3 halfSize = Extent() * 0.5f;
+        glm::vec3 halfExtent = glm::abs(glm::vec3(transform[0])) * halfSize.x + glm::abs(glm::vec3(transform[1])) * halfSize.y + glm::abs(glm::vec3(transform[2])) * halfSize.z;
+        return { center - halfExtent, center + halfExtent };
+    }
+
+    bool IsEmpty() const { return min.x > max.x || min.y > max.y || min.z > max.z; }
+    glm::vec3 Center() const { return (min + max) * 0.5f; }
+    glm::vec3 Extent() const { return max - min; }
+
+    void Grow(const glm::vec3& point)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    void Grow(const Aabb& other)
+    {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    /**
+     * @brief Gets the surface area, the cost metric of the surface area heuristic. 0 for empty boxes.
+     */
+    float SurfaceArea() const
+    {
+        if (IsEmpty()) {
+            return 0.0f;
+        }
+        glm::vec3 extent = Extent();
+        return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+    }
+
+    bool Overlaps(const Aabb& other) const
+    {
+        return min.x <= other.max.x && max.x >= other.min.x &&
+               min.y <= other.max.y && max.y >= other.min.y &&
+               min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    bool Contains(const Aabb& other) const
+    {
+        return min.x <= other.min.x && max.x >= other.max.x &&
+               min.y <= other.min.y && max.y >= other.max.y &&
+               min.z <= other.min.z && max.z >= other.max.z;
+    }
+
+    bool operator==(const Aabb& other) const { return min == other.min && max == other.max; }
+    bool operator!=(const Aabb& other) const { return !(*this == other); }
+};
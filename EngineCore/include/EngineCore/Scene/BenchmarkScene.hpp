@@ -0,0 +1,48 @@
+#pragma once
+
+#include "EngineCore/Renderer.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+/**
+ * @class BenchmarkScene
+ * @brief Generates synthetic scenes used to stress the renderer.
+ */
+class BenchmarkScene
+{
+public:
+    /// @brief The distance between the centers of neighbouring cubes.
+    static constexpr float GridSpacing = 2.0f;
+
+    /**
+     * @brief Creates a cube of N x N x N unit cubes centered on the origin.
+     *
+     * Each instance gets a color derived from its position in the grid so that
+     * the individual cubes remain distinguishable.
+     *
+     * @param gridSize The number of cubes along each axis.
+     * @return The instances, ordered x-fastest.
+     */
+    static std::vector<InstanceData> CreateCubeGrid(uint32_t gridSize);
+
+    /**
+     * @brief Gets the radius of a sphere enclosing the whole grid.
+     * @param gridSize The number of cubes along each axis.
+     * @return The bounding radius in world units.
+     */
+    static float GetGridRadius(uint32_t gridSize);
+
+    /**
+     * @brief Creates a dense UV sphere of diameter 1, so it fits the grid cells like the unit cube.
+     *
+     * Used to exercise the LOD chain: unlike the cube, its triangles can be
+     * simplified with a small, distance-dependent error. The vertex colors
+     * follow the normals. No LODs are generated here.
+     *
+     * @param segments The number of segments around the equator (the rings are half as many).
+     * @return The mesh with a single level of detail.
+     */
+    static MeshData CreateSphereMesh(uint32_t segments);
+};
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "EngineCore/Scene/Aabb.hpp"
+#include "EngineCore/Scene/Frustum.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * @struct BvhNode
+ * @brief A node of the BVH. The two children of an inner node are stored next to each other.
+ *
+ * Every node, inner or leaf, covers a contiguous range of the object order,
+ * so all objects below a node can be emitted without visiting its children.
+ */
+struct BvhNode
+{
+    Aabb bounds;
+    uint32_t leftChild = 0;   ///< Index of the left child, the right one is leftChild + 1. 0 for leaves.
+    uint32_t firstSlot = 0;   ///< First entry of the node's objects in the object order.
+    uint32_t objectCount = 0; ///< Number of objects in the subtree.
+
+    bool IsLeaf() const { return leftChild == 0; }
+};
+
+/**
+ * @struct Ray
+ * @brief A ray for picking. The direction does not have to be normalized; hit distances are in its units.
+ */
+struct Ray
+{
+    glm::vec3 origin;
+    glm::vec3 direction;
+};
+
+/**
+ * @struct RayHit
+ * @brief The closest object a ray hits.
+ */
+struct RayHit
+{
+    uint32_t objectIndex = std::numeric_limits<uint32_t>::max();
+    float distance = std::numeric_limits<float>::max(); ///< Ray parameter of the entry point into the object's box.
+};
+
+/**
+ * @struct BvhQueryStats
+ * @brief Work done by a query, to verify that traversal stays sublinear.
+ */
+struct BvhQueryStats
+{
+    size_t visitedNodes = 0;
+    size_t testedObjects = 0;
+};
+
+/**
+ * @class Bvh
+ * @brief A bounding volume hierarchy over object AABBs for culling, picking and overlap queries.
+ *
+ * Built top-down with the surface area heuristic evaluated over BinCount
+ * centroid bins per axis. With a thread pool, the binning of large nodes is
+ * split across workers, and once nodes drop below SubtreeSize objects their
+ * subtrees are built as independent jobs.
+ *
+ * When objects move, UpdateObject refits the path from the object's leaf to
+ * the root, stopping as soon as a node's bounds do not change; Refit updates
+ * every node at once. Refitting keeps queries correct but not optimal, so
+ * large changes are better handled by a rebuild.
+ */
+class Bvh
+{
+public:
+    /// @brief The number of centroid bins the SAH is evaluated over, per axis.
+    static constexpr uint32_t BinCount = 16;
+    /// @brief Nodes with more objects are always split.
+    static constexpr uint32_t MaxLeafSize = 8;
+    /// @brief Below this depth the SAH is used; deeper nodes are split at the median to bound the depth.
+    static constexpr uint32_t MaxSahDepth = 48;
+    /// @brief Subtrees smaller than this are built by a single job.
+    static constexpr size_t SubtreeSize = 8 * 1024;
+
+    /**
+     * @brief Builds the hierarchy, replacing any previous one.
+     * @param bounds The bounds of each object; the object index is the position in this list.
+     * @param threadPool Optional pool the build is parallelized on.
+     */
+    void Build(const std::vector<Aabb>& bounds, ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Changes the bounds of one object and refits its ancestors.
+     * @param objectIndex The object to update.
+     * @param bounds Its new bounds.
+     */
+    void UpdateObject(uint32_t objectIndex, const Aabb& bounds);
+
+    /**
+     * @brief Replaces the bounds of all objects and refits every node, keeping the topology.
+     * @param bounds The new bounds, in the same order and count as in Build.
+     */
+    void Refit(const std::vector<Aabb>& bounds);
+
+    /**
+     * @brief Collects the objects whose boxes are at least partially inside a frustum.
+     * @param frustum The frustum, in the space of the object bounds.
+     * @param visible Receives the visible object indices, in traversal order.
+     * @param stats Optional counters of the work done.
+     * @return The number of visible objects.
+     */
+    size_t QueryFrustum(const Frustum& frustum, std::vector<uint32_t>& visible, BvhQueryStats* stats = nullptr) const;
+
+    /**
+     * @brief Collects the objects whose boxes overlap a box.
+     * @param box The query box.
+     * @param overlapping Receives the overlapping object indices, in traversal order.
+     * @param stats Optional counters of the work done.
+     * @return The number of overlapping objects.
+     */
+    size_t QueryAabb(const Aabb& box, std::vector<uint32_t>& overlapping, BvhQueryStats* stats = nullptr) const;
+
+    /**
+     * @brief Finds the closest object box hit by a ray.
+     * @param ray The ray.
+     * @param hit Receives the closest hit.
+     * @param maxDistance Hits further along the ray are ignored.
+     * @param stats Optional counters of the work done.
+     * @return True if an object was hit.
+     */
+    bool Raycast(const Ray& ray, RayHit& hit, float maxDistance = std::numeric_limits<float>::max(), BvhQueryStats* stats = nullptr) const;
+
+    bool IsEmpty() const { return m_nodes.empty(); }
+    size_t GetObjectCount() const { return m_slotObjects.size(); }
+    size_t GetNodeCount() const { return m_nodes.size(); }
+    uint32_t GetDepth() const { return m_depth; }
+    const std::vector<BvhNode>& GetNodes() const { return m_nodes; }
+
+private:
+    struct Subtree
+    {
+        uint32_t node;
+        uint32_t begin;
+        uint32_t end;
+        uint32_t depth;
+    };
+
+    /**
+     * @brief Splits the objects of a node into two halves.
+     * @return The first slot of the right half, or `end` if the node should stay a leaf.
+     */
+    uint32_t partition(const Aabb& nodeBounds, uint32_t begin, uint32_t end, uint32_t depth, ThreadPool* threadPool);
+
+    /**
+     * @brief Builds a complete subtree into its own node list, whose first node is the subtree root.
+     */
+    std::vector<BvhNode> buildSubtree(uint32_t begin, uint32_t end, uint32_t depth, uint32_t& maxDepth);
+
+    Aabb computeBounds(uint32_t begin, uint32_t end) const;
+    void refitNode(BvhNode& node);
+    void linkParents();
+
+    std::vector<BvhNode> m_nodes;
+    std::vector<Aabb> m_slotBounds;       ///< Object bounds in leaf order, so leaves read contiguous memory.
+    std::vector<uint32_t> m_slotObjects;  ///< Object index of each slot.
+    std::vector<uint32_t> m_objectSlots;  ///< Slot of each object.
+    std::vector<uint32_t> m_slotLeaves;   ///< Leaf node of each slot.
+    std::vector<uint32_t> m_parents;      ///< Parent of each node, the root's is itself.
+    std::vector<glm::vec3> m_centroids;   ///< Build-time only: object box centers, indexed by object.
+    const std::vector<Aabb>* m_buildBounds = nullptr; ///< Build-time only: the bounds passed to Build.
+    uint32_t m_depth = 0;
+};
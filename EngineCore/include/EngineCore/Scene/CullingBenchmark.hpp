@@ -0,0 +1,32 @@
+#pragma once
+
+#include "EngineCore/Benchmark.hpp"
+
+#include <cstdint>
+
+/**
+ * @class CullingBenchmark
+ * @brief Measures CPU frustum culling and BVH throughput without creating a Vulkan device.
+ *
+ * Random spheres and boxes are scattered around a camera and culled with
+ * every SIMD level the CPU supports, on one thread and on the thread pool,
+ * for 10K, 100K and 1M objects. Results are reported as objects per second
+ * under keys like `spheres_avx2_mt_1000000_objects_per_sec`, so they can be
+ * compared with the GPU culling pass of a `--headless --instance-grid=N` run.
+ *
+ * The same boxes are then put into a Bvh: build times (`bvh_build_st_ms_N`,
+ * `bvh_build_mt_ms_N`), hierarchical frustum culling in objects per second
+ * with the number of visited nodes, and ray casts and box overlap queries per second.
+ */
+class CullingBenchmark
+{
+public:
+    /// @brief The number of timed culling passes per configuration.
+    static constexpr uint32_t Iterations = 32;
+
+    /**
+     * @brief Runs every configuration and collects the results.
+     * @return The report, named "culling".
+     */
+    static BenchmarkReport Run();
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "EngineCore/Scene/Frustum.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * @struct SphereBoundsSoA
+ * @brief Bounding spheres stored as structure-of-arrays, so SIMD kernels load one component of several spheres at once.
+ */
+struct SphereBoundsSoA
+{
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> centerZ;
+    std::vector<float> radius;
+
+    size_t Size() const { return radius.size(); }
+    void Reserve(size_t count);
+    void Clear();
+    void Add(const glm::vec3& center, float sphereRadius);
+};
+
+/**
+ * @struct AabbBoundsSoA
+ * @brief Axis-aligned bounding boxes stored as structure-of-arrays.
+ */
+struct AabbBoundsSoA
+{
+    std::vector<float> minX;
+    std::vector<float> minY;
+    std::vector<float> minZ;
+    std::vector<float> maxX;
+    std::vector<float> maxY;
+    std::vector<float> maxZ;
+
+    size_t Size() const { return minX.size(); }
+    void Reserve(size_t count);
+    void Clear();
+    void Add(const glm::vec3& min, const glm::vec3& max);
+};
+
+/**
+ * @enum SimdLevel
+ * @brief The instruction set a culling kernel is written for.
+ */
+enum class SimdLevel
+{
+    Scalar, ///< Plain C++, one object at a time.
+    SSE,    ///< 4 objects per iteration.
+    AVX2    ///< 8 objects per iteration, with FMA.
+};
+
+/**
+ * @brief Gets the display name of a SIMD level, e.g. "avx2".
+ */
+const char* ToString(SimdLevel level);
+
+/**
+ * @class CullingSystem
+ * @brief Frustum-culls bounding volumes on the CPU and outputs the indices of the visible ones.
+ *
+ * The kernel is chosen at runtime: the widest instruction set the CPU
+ * supports is used unless a lower level is requested. With a thread pool,
+ * sets larger than MinBatchSize are split into contiguous batches culled in
+ * parallel. The output is always in ascending index order, the same as a
+ * single-threaded scalar pass.
+ *
+ * A CullingSystem keeps per-batch scratch memory and must not be used from
+ * several threads at once; create one per caller instead.
+ */
+class CullingSystem
+{
+public:
+    /// @brief The smallest number of objects handed to a worker thread.
+    static constexpr size_t MinBatchSize = 16 * 1024;
+
+    /**
+     * @brief Detects the widest SIMD level the CPU and OS support.
+     * @return The detected level; Scalar on non-x86 targets.
+     */
+    static SimdLevel GetSupportedSimdLevel();
+
+    /**
+     * @brief Creates a culling system using the widest supported kernel.
+     * @param threadPool Optional pool large sets are split across. Null culls on the calling thread only.
+     */
+    explicit CullingSystem(ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Selects the kernel. Levels above the supported one are lowered to it.
+     * @param level The requested SIMD level.
+     */
+    void SetSimdLevel(SimdLevel level);
+
+    SimdLevel GetSimdLevel() const { return m_simdLevel; }
+
+    /**
+     * @brief Culls bounding spheres.
+     * @param frustum The frustum, in the same space as the spheres.
+     * @param bounds The spheres.
+     * @param visible Receives the indices of the spheres at least partially inside, in ascending order.
+     * @return The number of visible spheres.
+     */
+    size_t CullSpheres(const Frustum& frustum, const SphereBoundsSoA& bounds, std::vector<uint32_t>& visible);
+
+    /**
+     * @brief Culls axis-aligned bounding boxes.
+     * @param frustum The frustum, in the same space as the boxes.
+     * @param bounds The boxes.
+     * @param visible Receives the indices of the boxes at least partially inside, in ascending order.
+     * @return The number of visible boxes.
+     */
+    size_t CullAabbs(const Frustum& frustum, const AabbBoundsSoA& bounds, std::vector<uint32_t>& visible);
+
+private:
+    /**
+     * @brief Runs a kernel over [0, count), in parallel batches if worthwhile, and gathers the results.
+     * @param kernel Called as kernel(begin, end, out) and returns the number of indices written to out.
+     */
+    template<typename Kernel>
+    size_t run(size_t count, std::vector<uint32_t>& visible, const Kernel& kernel);
+
+    ThreadPool* m_threadPool;
+    SimdLevel m_simdLevel;
+
+    // --- Scratch ---
+    std::vector<uint32_t> m_scratch;     ///< Batch b writes its indices starting at its first object's slot.
+    std::vector<size_t> m_batchBegins;
+    std::vector<size_t> m_batchCounts;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <array>
+
+/**
+ * @struct Frustum
+ * @brief The six planes of a view frustum, facing inwards.
+ *
+ * Each plane is stored as (normal.xyz, distance) with a normalized normal, so
+ * `dot(normal, p) + distance` is the signed distance of point p to the plane,
+ * positive on the inside.
+ */
+struct Frustum
+{
+    /// @brief The plane order: left, right, bottom, top, near, far.
+    enum Plane { Left = 0, Right, Bottom, Top, Near, Far, PlaneCount };
+
+    /// @brief How a volume relates to the frustum.
+    enum Containment { Outside = 0, Intersecting, Inside };
+
+    std::array<glm::vec4, PlaneCount> planes;
+
+    /**
+     * @brief Extracts the planes from a view-projection matrix (Gribb-Hartmann).
+     *
+     * The planes are in the space the matrix transforms from, e.g. world space
+     * for projection * view. The near plane assumes a [-1, 1] depth range, which
+     * is conservative for [0, 1] projections.
+     *
+     * @param viewProjection The combined view-projection matrix.
+     * @return The normalized frustum planes.
+     */
+    static Frustum FromMatrix(const glm::mat4& viewProjection);
+
+    /**
+     * @brief Tests whether a sphere is at least partially inside the frustum.
+     * @param center The sphere center.
+     * @param radius The sphere radius.
+     * @return False only if the sphere is fully outside one of the planes.
+     */
+    bool IntersectsSphere(const glm::vec3& center, float radius) const;
+
+    /**
+     * @brief Tests whether an axis-aligned box is at least partially inside the frustum.
+     * @param min The minimum corner of the box.
+     * @param max The maximum corner of the box.
+     * @return False only if the box is fully outside one of the planes.
+     */
+    bool IntersectsAabb(const glm::vec3& min, const glm::vec3& max) const;
+
+    /**
+     * @brief Classifies an axis-aligned box as fully outside, fully inside or crossing the frustum.
+     *
+     * Used by hierarchical culling: everything below a node that is fully
+     * inside is visible without further tests.
+     *
+     * @param min The minimum corner of the box.
+     * @param max The maximum corner of the box.
+     * @return The containment of the box.
+     */
+    Containment ClassifyAabb(const glm::vec3& min, const glm::vec3& max) const;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "EngineCore/Assets/Mesh.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class LodSelector
+ * @brief Picks a mesh level of detail from how large its simplification error appears on screen.
+ *
+ * The error of each level is projected with the camera's vertical field of
+ * view and the distance to the object's bounding sphere; the coarsest level
+ * whose error stays below PixelError pixels is chosen. To avoid popping back
+ * and forth at a boundary, a coarser level is only taken once its projected
+ * error has dropped below PixelError * (1 - Hysteresis), while a finer level
+ * is taken as soon as the current one exceeds PixelError.
+ */
+class LodSelector
+{
+public:
+    /**
+     * @brief Updates the camera the projected sizes are computed for.
+     * @param view The view matrix, mapping from the space the object bounds are given in.
+     * @param projection The projection matrix; its vertical scale encodes the field of view.
+     * @param viewportHeight The height of the render target in pixels.
+     */
+    void SetCamera(const glm::mat4& view, const glm::mat4& projection, float viewportHeight);
+
+    /**
+     * @brief Sets the largest projected error, in pixels, a level may have.
+     */
+    void SetPixelError(float pixels) { m_pixelError = pixels; }
+    float GetPixelError() const { return m_pixelError; }
+
+    /**
+     * @brief Sets the fraction the projected error must drop below the threshold before a coarser level is used.
+     */
+    void SetHysteresis(float hysteresis) { m_hysteresis = hysteresis; }
+    float GetHysteresis() const { return m_hysteresis; }
+
+    /**
+     * @brief Gets the camera position in the space of the view matrix's input.
+     */
+    const glm::vec3& GetCameraPosition() const { return m_cameraPosition; }
+
+    /**
+     * @brief Gets the number of pixels one unit covers at distance 1 (the projection's focal length in pixels).
+     */
+    float GetPixelsPerUnit() const { return m_pixelsPerUnit; }
+
+    /**
+     * @brief Selects the level of detail of one object.
+     * @param lods The mesh's levels, finest first.
+     * @param center The center of the object's bounding sphere.
+     * @param radius The radius of the object's bounding sphere.
+     * @param scale How much the object's transform scales the mesh, applied to the level errors.
+     * @param currentLod The level the object used last frame.
+     * @return The level to draw.
+     */
+    uint32_t Select(const std::vector<MeshLod>& lods, const glm::vec3& center, float radius, float scale, uint32_t currentLod) const;
+
+private:
+    glm::vec3 m_cameraPosition{ 0.0f };
+    float m_pixelsPerUnit = 1.0f;
+    float m_pixelError = 1.0f;
+    float m_hysteresis = 0.25f;
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * @enum JobPriority
+ * @brief Which queue of the ThreadPool a job goes to.
+ */
+enum class JobPriority
+{
+    Normal,     ///< Work a thread is waiting for, e.g. ParallelFor batches. Runs before any background job.
+    Background  ///< Long-running work nobody blocks on, e.g. asset import. Runs when no normal job is queued.
+};
+
+/**
+ * @class ThreadPool
+ * @brief A fixed set of worker threads that run submitted jobs in FIFO order per priority.
+ *
+ * Used for data-parallel CPU work (ParallelFor) and for background jobs whose
+ * result is collected later through a std::future (Submit). Workers always
+ * take normal jobs before background ones, and ParallelFor never waits for a
+ * batch no worker has started, so seconds of queued asset imports cannot
+ * stall the render thread. Workers are named "Worker N" in CPU profiler traces.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threadCount The number of workers. 0 uses one less than the hardware concurrency (at least 1).
+     */
+    explicit ThreadPool(uint32_t threadCount = 0);
+
+    /**
+     * @brief Finishes all queued jobs and joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Queues a job.
+     * @param job The callable to run on a worker.
+     * @param priority Background for long jobs whose result is polled rather than waited on.
+     * @return A future for the job's result; exceptions thrown by the job are rethrown by get().
+     */
+    template<typename F>
+    auto Submit(F&& job, JobPriority priority = JobPriority::Normal) -> std::future<decltype(job())>
+    {
+        using Result = decltype(job());
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(job));
+        std::future<Result> future = task->get_future();
+        enqueue([task]() { (*task)(); }, priority);
+        return future;
+    }
+
+    /**
+     * @brief Runs a function over [0, count) in batches, blocking until all batches are done.
+     *
+     * The range is split into at most one batch per worker plus one for the
+     * calling thread. Batches are claimed by the calling thread and by helper
+     * jobs alike; the calling thread keeps claiming until none are left, so it
+     * only ever waits for batches a worker has already started, never for
+     * helpers still queued behind other work. Small ranges run entirely on the
+     * calling thread. An exception thrown by a batch is rethrown once all
+     * started batches have finished.
+     *
+     * @param count The number of items.
+     * @param minBatchSize The smallest number of items worth handing to another thread.
+     * @param function Called as function(batchIndex, begin, end) for each batch.
+     * @return The number of batches the range was split into.
+     */
+    uint32_t ParallelFor(size_t count, size_t minBatchSize, const std::function<void(uint32_t, size_t, size_t)>& function);
+
+    /**
+     * @brief Gets the number of worker threads.
+     */
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+private:
+    void enqueue(std::function<void()> job, JobPriority priority);
+    void workerLoop(uint32_t index);
+
+    std::vector<std::thread> m_workers;
+    std::queue<std::function<void()>> m_jobs;           ///< JobPriority::Normal.
+    std::queue<std::function<void()>> m_backgroundJobs; ///< JobPriority::Background.
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stopping = false;
+};
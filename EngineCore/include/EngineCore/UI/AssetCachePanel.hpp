@@ -0,0 +1,30 @@
+#pragma once
+#include "EngineCore/UI/UIPanel.hpp"
+
+class AssetCache;
+
+/**
+ * @class AssetCachePanel
+ * @brief A UI panel that shows how well the asset cache avoids re-importing.
+ *
+ * Shows the hit and miss counts since startup, the time spent hashing
+ * sources and the size of the cache directory, which can be cleared here.
+ */
+class AssetCachePanel : public UIPanel
+{
+public:
+    /**
+     * @brief Constructs an AssetCachePanel.
+     * @param cache A reference to the asset cache whose stats are displayed.
+     */
+    AssetCachePanel(AssetCache& cache);
+
+    /**
+     * @brief Renders the asset cache window using ImGui.
+     */
+    void OnImGuiRender() override;
+
+private:
+    /// @brief A reference to the asset cache.
+    AssetCache& m_cache;
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include "EngineCore/UI/UIPanel.hpp"
+
+// Forward declaration of GpuProfiler to avoid including Vulkan headers.
+class GpuProfiler;
+
+/**
+ * @class GpuProfilerPanel
+ * @brief A UI panel that displays GPU timings measured by the GpuProfiler.
+ *
+ * Shows a graph of the total GPU frame time and, for every profiled pass,
+ * its latest, average and peak duration together with a rolling graph.
+ */
+class GpuProfilerPanel : public UIPanel
+{
+public:
+    /**
+     * @brief Constructs a GpuProfilerPanel.
+     * @param profiler A reference to the GPU profiler whose results are displayed.
+     */
+    GpuProfilerPanel(GpuProfiler& profiler);
+
+    /**
+     * @brief Renders the GPU profiler window using ImGui.
+     */
+    void OnImGuiRender() override;
+
+private:
+    /// @brief A reference to the GPU profiler.
+    GpuProfiler& m_profiler;
+};
@@ -29,4 +29,16 @@ public:
 private:
     /// @brief A pointer to the Application instance.
     Application* m_app;
+
+    /// @brief Set by the "Open Mesh..." item; the popup is opened outside the menu.
+    bool m_openMeshRequested = false;
+
+    /// @brief The path typed into the "Open Mesh" popup.
+    char m_meshPath[260] = "";
+
+    /// @brief Set by the "Open Texture..." item; the popup is opened outside the menu.
+    bool m_openTextureRequested = false;
+
+    /// @brief The path typed into the "Open Texture" popup.
+    char m_texturePath[260] = "";
 };
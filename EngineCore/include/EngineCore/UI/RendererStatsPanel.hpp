@@ -0,0 +1,35 @@
+#pragma once
+#include "EngineCore/UI/UIPanel.hpp"
+#include <vector>
+
+// Forward declaration of Renderer to avoid including the full header.
+class Renderer;
+
+/**
+ * @class RendererStatsPanel
+ * @brief A UI panel that displays frame timing and renderer configuration.
+ *
+ * Shows the frame rate, a frame-time history graph, and the settings that
+ * size the renderer's per-frame resources, such as the number of frames in flight.
+ */
+class RendererStatsPanel : public UIPanel
+{
+public:
+    /**
+     * @brief Constructs a RendererStatsPanel.
+     * @param renderer A reference to the renderer whose statistics are displayed.
+     */
+    RendererStatsPanel(Renderer& renderer);
+
+    /**
+     * @brief Renders the renderer stats window using ImGui.
+     */
+    void OnImGuiRender() override;
+
+private:
+    /// @brief A reference to the renderer to query its statistics.
+    Renderer& m_renderer;
+
+    /// @brief Stores a history of frame times in milliseconds for plotting.
+    std::vector<float> m_frameTimeHistory;
+};
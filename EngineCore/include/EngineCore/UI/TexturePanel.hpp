@@ -0,0 +1,47 @@
+#pragma once
+#include "EngineCore/UI/UIPanel.hpp"
+#include "EngineCore/Assets/TextureStreamer.hpp"
+#include "EngineCore/Vulkan/DescriptorAllocator.hpp"
+
+/**
+ * @class TexturePanel
+ * @brief A UI panel that lists the streamed textures and previews one of them.
+ *
+ * Shows the memory used against the streaming budget, which can be changed
+ * here, and the resident levels of every texture. The selected texture is
+ * drawn at an adjustable size and requests the mip level that size needs,
+ * so raising it streams detail in and lowering it lets the level be evicted.
+ * The preview's descriptor set is a transient one allocated every frame, so
+ * a view replaced by a residency change never has to be unregistered.
+ */
+class TexturePanel : public UIPanel
+{
+public:
+    /**
+     * @brief Constructs a TexturePanel.
+     * @param streamer The texture streamer whose textures are displayed.
+     * @param descriptorAllocator The allocator the preview's transient descriptor sets come from.
+     */
+    TexturePanel(TextureStreamer& streamer, DescriptorAllocator& descriptorAllocator);
+
+    /**
+     * @brief Renders the texture window using ImGui.
+     */
+    void OnImGuiRender() override;
+
+private:
+    /// @brief A reference to the texture streamer.
+    TextureStreamer& m_streamer;
+
+    /// @brief A reference to the descriptor allocator.
+    DescriptorAllocator& m_descriptorAllocator;
+
+    /// @brief The previewed texture, 0 if none.
+    TextureHandle m_selected = 0;
+
+    /// @brief The texture count last seen; newly loaded textures are selected.
+    uint32_t m_knownCount = 0;
+
+    /// @brief The on-screen size of the preview's longer side, in pixels.
+    float m_previewSize = 256.0f;
+};
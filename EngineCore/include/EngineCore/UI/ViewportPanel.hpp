@@ -1,6 +1,8 @@
 #pragma once
 #include "EngineCore/UI/UIPanel.hpp"
 
+#include <glm/glm.hpp>
+
 // Forward declaration of Renderer to avoid including the full header.
 class Renderer;
 
@@ -9,8 +11,10 @@ class Renderer;
  * @brief A UI panel that displays the rendered 3D scene.
  *
  * This panel gets the rendered scene as a texture from the Renderer and
- * displays it within an ImGui window. It also tracks user interactions
- * like hovering, which can be used to control camera movement.
+ * displays it within an ImGui window, stretching the rendered part of the
+ * image over the window's content region. It also tracks user interactions
+ * like hovering, which can be used to control camera movement, and the size
+ * of the content region, which the scene image is resized to.
  */
 class ViewportPanel : public UIPanel
 {
@@ -33,10 +37,28 @@ public:
      */
     bool IsHovered() const { return m_isHovered; }
 
+    /**
+     * @brief Gets the mouse position over the scene image as of the last rendered frame.
+     * @return The position in [0, 1], with (0, 0) at the top-left corner of the image; outside that range if the mouse is not over it.
+     */
+    glm::vec2 GetMouseImagePosition() const { return m_mouseImagePosition; }
+
+    /**
+     * @brief Gets the size of the region the scene image was displayed in as of the last rendered frame.
+     * @return The size in pixels; zero while the window is hidden or collapsed.
+     */
+    glm::vec2 GetContentSize() const { return m_contentSize; }
+
 private:
     /// @brief A reference to the renderer to get the scene texture.
     Renderer& m_renderer;
     
     /// @brief A flag indicating if the mouse is currently over the viewport.
     bool m_isHovered = false;
+
+    /// @brief The normalized mouse position over the scene image, for picking.
+    glm::vec2 m_mouseImagePosition = { -1.0f, -1.0f };
+
+    /// @brief The size of the content region, which the scene image should match.
+    glm::vec2 m_contentSize = { 0.0f, 0.0f };
 };
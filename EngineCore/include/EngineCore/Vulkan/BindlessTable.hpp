@@ -0,0 +1,206 @@
+#pragma once
+
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+class UploadQueue;
+
+/**
+ * @struct BindlessTableCreateInfo
+ * @brief The device objects and settings a BindlessTable is created with.
+ */
+struct BindlessTableCreateInfo
+{
+    VkDevice device = VK_NULL_HANDLE;
+    GpuAllocator* allocator = nullptr;
+    UploadQueue* uploadQueue = nullptr;  ///< Fills the default texture and buffer.
+    uint32_t framesInFlight = 2;         ///< Released slots are reused once no frame can still read them.
+    bool descriptorIndexing = false;     ///< Whether the descriptor indexing features were enabled on the device.
+    uint32_t textureCapacity = 4096;     ///< Texture slots with descriptor indexing.
+    uint32_t bufferCapacity = 1024;      ///< Storage buffer slots with descriptor indexing.
+};
+
+/**
+ * @class BindlessTable
+ * @brief One global descriptor set of texture and storage buffer arrays, indexed by shaders through push constants.
+ *
+ * Resources are registered once and get a slot index, which draws pass to
+ * their shaders instead of binding a descriptor set of their own; the set is
+ * bound once per pipeline layout. Binding 0 is an array of combined image
+ * samplers, binding 1 an array of storage buffers, both visible to every
+ * stage. Shaders size the arrays with specialization constant 0 (textures)
+ * and 1 (buffers) set to GetTextureCapacity() and GetBufferCapacity().
+ * Slot 0 of each array holds a 1x1 white texture and a zeroed buffer, so
+ * index 0 is always safe to read.
+ *
+ * With descriptor indexing the arrays are large, partially bound and
+ * update-after-bind: there is a single set, and a slot is written when it is
+ * registered, which is allowed while frames using other slots are in
+ * flight. Without it, the arrays are small enough for the minimum limits
+ * every device supports, every slot must hold a valid descriptor, and a set
+ * cannot change while a frame uses it; there is one set per frame in flight
+ * instead, and changes reach each set in BeginFrame() once its frame slot is
+ * free again. Unused slots point at the defaults. On devices without dynamic
+ * array indexing the fallback arrays may only be indexed with constants, so
+ * shaders branch on the slot and read each one with a literal index.
+ *
+ * In both modes a released slot is only handed out again once every frame
+ * that could have read it has completed, so a resource may be released and
+ * replaced (e.g. when a streamed texture gets a new view) without waiting.
+ *
+ * Not thread-safe: all calls must come from the render thread.
+ */
+class BindlessTable
+{
+public:
+    /// @brief The slot of the 1x1 white texture.
+    static constexpr uint32_t DefaultTexture = 0;
+
+    /// @brief The slot of the zeroed storage buffer.
+    static constexpr uint32_t DefaultBuffer = 0;
+
+    /// @brief Texture slots without descriptor indexing, within the minimum maxPerStageDescriptorSamplers.
+    static constexpr uint32_t FallbackTextureCapacity = 16;
+
+    /// @brief Storage buffer slots without descriptor indexing, within the minimum maxPerStageDescriptorStorageBuffers.
+    static constexpr uint32_t FallbackBufferCapacity = 4;
+
+    /**
+     * @brief Creates the layout, the pool, the sets and the default resources.
+     * @param createInfo The device objects and settings.
+     */
+    explicit BindlessTable(const BindlessTableCreateInfo& createInfo);
+
+    /**
+     * @brief Destroys the sets and the default resources. The device must be idle.
+     */
+    ~BindlessTable();
+
+    BindlessTable(const BindlessTable&) = delete;
+    BindlessTable& operator=(const BindlessTable&) = delete;
+
+    /**
+     * @brief Puts a texture into a free slot.
+     * @param view The view, in SHADER_READ_ONLY_OPTIMAL whenever a frame samples it.
+     * @param sampler The sampler to read it with.
+     * @return The slot, or DefaultTexture if the table is full.
+     */
+    uint32_t RegisterTexture(VkImageView view, VkSampler sampler);
+
+    /**
+     * @brief Frees the slot of a texture. The view must stay alive until frames in flight have completed.
+     * @param index The slot from RegisterTexture(); DefaultTexture is ignored.
+     */
+    void ReleaseTexture(uint32_t index);
+
+    /**
+     * @brief Puts a range of a storage buffer into a free slot.
+     * @param buffer The buffer, created with VK_BUFFER_USAGE_STORAGE_BUFFER_BIT.
+     * @param offset The start of the range, a multiple of minStorageBufferOffsetAlignment.
+     * @param range The size of the range.
+     * @return The slot, or DefaultBuffer if the table is full.
+     */
+    uint32_t RegisterBuffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+
+    /**
+     * @brief Frees the slot of a buffer. The buffer must stay alive until frames in flight have completed.
+     * @param index The slot from RegisterBuffer(); DefaultBuffer is ignored.
+     */
+    void ReleaseBuffer(uint32_t index);
+
+    /**
+     * @brief Brings a frame slot's set up to date and recycles slots no frame can read anymore.
+     * @param frameIndex The index of the current frame in flight; its fence must have been waited on.
+     */
+    void BeginFrame(uint32_t frameIndex);
+
+    /**
+     * @brief Gets the layout pipeline layouts include the table with.
+     */
+    VkDescriptorSetLayout GetLayout() const { return m_layout; }
+
+    /**
+     * @brief Gets the set to bind for a frame slot.
+     * @param frameIndex The index of the current frame in flight.
+     */
+    VkDescriptorSet GetDescriptorSet(uint32_t frameIndex) const { return m_sets[m_sets.size() > 1 ? frameIndex : 0]; }
+
+    /**
+     * @brief Checks whether the table uses descriptor indexing or the per-frame fallback.
+     */
+    bool IsBindless() const { return m_bindless; }
+
+    /**
+     * @brief Gets the length of the texture array, the value of specialization constant 0.
+     */
+    uint32_t GetTextureCapacity() const { return static_cast<uint32_t>(m_textures.size()); }
+
+    /**
+     * @brief Gets the length of the storage buffer array, the value of specialization constant 1.
+     */
+    uint32_t GetBufferCapacity() const { return static_cast<uint32_t>(m_buffers.size()); }
+
+    /**
+     * @brief Gets the number of registered textures, not counting the default.
+     */
+    uint32_t GetTextureCount() const { return m_textureCount; }
+
+    /**
+     * @brief Gets the number of registered buffers, not counting the default.
+     */
+    uint32_t GetBufferCount() const { return m_bufferCount; }
+
+private:
+    /**
+     * @struct RetiredSlot
+     * @brief A released slot, free again once the frame counter has passed frame + framesInFlight.
+     */
+    struct RetiredSlot
+    {
+        uint32_t binding = 0;
+        uint32_t index = 0;
+        uint64_t frame = 0;
+    };
+
+    void createDefaults(UploadQueue& uploads);
+    void createSets();
+    uint32_t allocateSlot(std::vector<uint32_t>& freeSlots, const char* kind);
+    void markDirty(uint32_t binding, uint32_t index);
+    void writeSlots(VkDescriptorSet set, const std::vector<uint32_t>& textureSlots, const std::vector<uint32_t>& bufferSlots) const;
+
+    VkDevice m_device;
+    GpuAllocator& m_allocator;
+    uint32_t m_framesInFlight;
+    bool m_bindless;
+
+    VkDescriptorSetLayout m_layout = VK_NULL_HANDLE;
+    VkDescriptorPool m_pool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> m_sets;              ///< One with descriptor indexing, one per frame in flight without.
+
+    // --- Defaults (slot 0) ---
+    VkImage m_defaultImage = VK_NULL_HANDLE;
+    GpuAllocation m_defaultImageMemory;
+    VkImageView m_defaultView = VK_NULL_HANDLE;
+    VkSampler m_defaultSampler = VK_NULL_HANDLE;
+    VkBuffer m_defaultBuffer = VK_NULL_HANDLE;
+    GpuAllocation m_defaultBufferMemory;
+
+    // --- Slots ---
+    std::vector<VkDescriptorImageInfo> m_textures;    ///< What each texture slot holds; the default when free.
+    std::vector<VkDescriptorBufferInfo> m_buffers;    ///< What each buffer slot holds; the default when free.
+    std::vector<uint32_t> m_freeTextures;
+    std::vector<uint32_t> m_freeBuffers;
+    std::deque<RetiredSlot> m_retired;
+    uint32_t m_textureCount = 0;
+    uint32_t m_bufferCount = 0;
+    uint64_t m_frame = 0;
+
+    // --- Fallback: slots each frame slot's set has not seen yet ---
+    std::vector<std::vector<uint32_t>> m_dirtyTextures; ///< Per frame in flight.
+    std::vector<std::vector<uint32_t>> m_dirtyBuffers;
+};
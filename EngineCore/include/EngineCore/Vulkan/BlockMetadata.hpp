@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+/**
+ * @class BlockMetadata
+ * @brief Tracks which byte ranges of one memory block are in use.
+ *
+ * This is the CPU-side bookkeeping of a GPU memory block and knows nothing
+ * about Vulkan, so it can be exercised without a device. Two algorithms exist:
+ *
+ * - FreeList: a best-fit search over the free ranges, sorted by offset, with
+ *   neighbouring ranges merged on Free(). Suited to long-lived resources.
+ * - Linear: a bump pointer. Freed space is only reclaimed once every
+ *   allocation of the block has been freed. Suited to short-lived resources
+ *   such as staging buffers.
+ */
+class BlockMetadata
+{
+public:
+    /// @brief The sub-allocation strategy used inside a block.
+    enum class Algorithm
+    {
+        FreeList,
+        Linear
+    };
+
+    /**
+     * @brief Creates the metadata of an empty block.
+     * @param size The size of the block in bytes.
+     * @param algorithm The sub-allocation strategy.
+     */
+    BlockMetadata(uint64_t size, Algorithm algorithm);
+
+    /**
+     * @brief Reserves a range inside the block.
+     * @param size The number of bytes to reserve. Must be greater than zero.
+     * @param alignment The required alignment of the offset. Must be a power of two.
+     * @param offset Receives the offset of the reserved range on success.
+     * @return True on success, false if the block has no suitable free range.
+     */
+    bool Allocate(uint64_t size, uint64_t alignment, uint64_t& offset);
+
+    /**
+     * @brief Returns a range reserved by Allocate() to the block.
+     * @param offset The offset returned by Allocate().
+     * @param size The size passed to Allocate().
+     * @throws std::logic_error If the range lies outside the block or overlaps a free range (e.g. a double free).
+     */
+    void Free(uint64_t offset, uint64_t size);
+
+    uint64_t GetSize() const { return m_size; }
+    uint64_t GetUsedBytes() const { return m_usedBytes; }
+    uint64_t GetFreeBytes() const { return m_size - m_usedBytes; }
+    uint32_t GetAllocationCount() const { return m_allocationCount; }
+    bool IsEmpty() const { return m_allocationCount == 0; }
+    Algorithm GetAlgorithm() const { return m_algorithm; }
+
+    /**
+     * @brief Gets the size of the largest range a new allocation could use right now.
+     * @return The size in bytes, before any alignment padding.
+     */
+    uint64_t GetLargestFreeRange() const;
+
+    /**
+     * @brief Gets how scattered the free space of the block is.
+     * @return 1 - largestFreeRange / freeBytes, 0 when the free space is contiguous or the block is full.
+     */
+    float GetFragmentation() const { return ComputeFragmentation(GetLargestFreeRange(), GetFreeBytes()); }
+
+    /**
+     * @brief Computes the fragmentation of some free space, as reported by GetFragmentation().
+     * @param largestFreeRange The largest contiguous free range.
+     * @param freeBytes The total number of free bytes.
+     */
+    static float ComputeFragmentation(uint64_t largestFreeRange, uint64_t freeBytes);
+
+private:
+    uint64_t m_size;
+    Algorithm m_algorithm;
+    uint64_t m_usedBytes = 0;
+    uint32_t m_allocationCount = 0;
+
+    std::map<uint64_t, uint64_t> m_freeRanges; ///< FreeList: offset -> size of every free range.
+    uint64_t m_linearOffset = 0;               ///< Linear: the first byte not handed out yet.
+};
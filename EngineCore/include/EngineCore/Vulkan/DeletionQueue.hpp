@@ -0,0 +1,143 @@
+#pragma once
+
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+/**
+ * @struct DeletionQueueCreateInfo
+ * @brief The device objects and settings a DeletionQueue is created with.
+ */
+struct DeletionQueueCreateInfo
+{
+    VkDevice device = VK_NULL_HANDLE;
+    GpuAllocator* allocator = nullptr;
+    uint32_t framesInFlight = 2;    ///< Without a timeline, a frame is known complete this many frames later.
+    bool timelineSemaphore = false; ///< Whether timelineSemaphore was enabled on the device.
+};
+
+/**
+ * @class DeletionQueue
+ * @brief Destroys GPU objects once every frame that could have used them has completed.
+ *
+ * Frames are numbered by BeginFrame(). An object handed to the queue is
+ * stamped with the number of the frame after the current one and destroyed
+ * in a later BeginFrame() once that frame is known to be complete. The
+ * stamp covers the current frame as well as work submitted between its
+ * submission and the next frame's, such as streaming copies recorded before
+ * the next fence wait:
+ *  - With timeline semaphores, every frame's last submission signals
+ *    GetTimelineSemaphore() with GetFrame(), and the queue reads the
+ *    semaphore's counter, so objects go as soon as their frame is done.
+ *  - Without, BeginFrame() is called right after the frame slot's fence has
+ *    been waited on, which proves the frame framesInFlight earlier done.
+ *
+ * Signaling a semaphore or fence from vkQueueSubmit also waits for
+ * everything submitted to the queue before, so a frame's completion covers
+ * every earlier submission that may have used the object. Replacing a resource is
+ * therefore cheap at any time: create the new one, retire the old one, and
+ * never wait for the device. Only shutdown idles the device, after which
+ * Flush() destroys what is left.
+ *
+ * Not thread-safe: all calls must come from the render thread.
+ */
+class DeletionQueue
+{
+public:
+    /**
+     * @brief Creates the queue and, with timeline semaphores, the frame semaphore.
+     * @param createInfo The device objects and settings.
+     */
+    explicit DeletionQueue(const DeletionQueueCreateInfo& createInfo);
+
+    /**
+     * @brief Destroys everything still queued and the frame semaphore. The device must be idle.
+     */
+    ~DeletionQueue();
+
+    DeletionQueue(const DeletionQueue&) = delete;
+    DeletionQueue& operator=(const DeletionQueue&) = delete;
+
+    /**
+     * @brief Starts the next frame and destroys the objects of every completed frame.
+     *
+     * Call once per frame before recording, after waiting on the frame slot's fence.
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Queues a function that destroys objects the current or earlier submissions may use.
+     * @param destroy Called once the next frame has completed, or by Flush().
+     */
+    void Defer(std::function<void()> destroy);
+
+    /**
+     * @brief Queues a buffer and its memory; the handles are cleared.
+     */
+    void DestroyBuffer(VkBuffer& buffer, GpuAllocation& allocation);
+
+    /**
+     * @brief Queues an image and its memory; the handles are cleared.
+     */
+    void DestroyImage(VkImage& image, GpuAllocation& allocation);
+
+    /**
+     * @brief Queues an image view; the handle is cleared.
+     */
+    void DestroyImageView(VkImageView& view);
+
+    /**
+     * @brief Queues a sampler; the handle is cleared.
+     */
+    void DestroySampler(VkSampler& sampler);
+
+    /**
+     * @brief Queues a framebuffer; the handle is cleared.
+     */
+    void DestroyFramebuffer(VkFramebuffer& framebuffer);
+
+    /**
+     * @brief Destroys everything queued right away. The device must be idle.
+     */
+    void Flush();
+
+    /**
+     * @brief Gets the number of the current frame, the value its submission signals the timeline semaphore with.
+     */
+    uint64_t GetFrame() const { return m_frame; }
+
+    /**
+     * @brief Gets the semaphore the last submission of each frame signals, or VK_NULL_HANDLE without timeline semaphores.
+     */
+    VkSemaphore GetTimelineSemaphore() const { return m_timeline; }
+
+    /**
+     * @brief Gets the number of queued destructions.
+     */
+    size_t GetPendingCount() const { return m_pending.size(); }
+
+private:
+    /**
+     * @struct Entry
+     * @brief A queued destruction and the frame that has to complete first.
+     */
+    struct Entry
+    {
+        uint64_t frame = 0;
+        std::function<void()> destroy;
+    };
+
+    uint64_t getCompletedFrame() const;
+
+    VkDevice m_device;
+    GpuAllocator& m_allocator;
+    uint32_t m_framesInFlight;
+    VkSemaphore m_timeline = VK_NULL_HANDLE;
+
+    uint64_t m_frame = 0;
+    std::deque<Entry> m_pending; ///< In frame order.
+};
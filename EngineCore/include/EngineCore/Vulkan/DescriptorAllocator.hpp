@@ -0,0 +1,161 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct DescriptorAllocatorCreateInfo
+ * @brief The device and settings a DescriptorAllocator is created with.
+ */
+struct DescriptorAllocatorCreateInfo
+{
+    VkDevice device = VK_NULL_HANDLE;
+    uint32_t framesInFlight = 2;   ///< One list of transient pools per frame in flight.
+    uint32_t initialSetsPerPool = 64; ///< Sets in the first pool of each list; every new pool doubles it.
+    uint32_t maxSetsPerPool = 4096; ///< The size pools stop growing at.
+};
+
+/**
+ * @struct DescriptorAllocatorStats
+ * @brief The pools and layouts a DescriptorAllocator holds.
+ */
+struct DescriptorAllocatorStats
+{
+    uint32_t layoutCount = 0;
+    uint32_t persistentPools = 0;
+    uint32_t persistentSets = 0;   ///< Sets allocated over the allocator's lifetime.
+    uint32_t transientPools = 0;   ///< Over all frames in flight.
+    uint32_t transientSets = 0;    ///< Sets the current frame has allocated so far.
+};
+
+/**
+ * @class DescriptorAllocator
+ * @brief Hands out descriptor sets from lists of pools that grow on demand, and caches set layouts.
+ *
+ * Persistent sets live as long as the allocator and are meant for sets that
+ * are written once or whose bindings only change while the device is idle.
+ * Transient sets live for one frame: each frame in flight owns a list of
+ * pools that BeginFrame() resets with vkResetDescriptorPool() once the
+ * frame's fence has signaled, so descriptors for dynamic content (a texture
+ * shown this frame, a buffer range that moves) are allocated and written
+ * every frame without freeing anything individually. When a pool runs out,
+ * the next one in the list is used or a larger one is created, so after the
+ * first few frames the allocator stops creating pools altogether.
+ *
+ * Every pool holds a mix of the common descriptor types in proportion to its
+ * set count. Layouts whose bindings need more of a type than a pool holds,
+ * or update-after-bind layouts, need a pool of their own (see BindlessTable).
+ *
+ * Layouts are cached by their binding signature: asking for the same bindings
+ * twice returns the same layout, and the allocator destroys them all.
+ * Immutable samplers are not supported.
+ *
+ * Not thread-safe: all calls must come from the render thread.
+ */
+class DescriptorAllocator
+{
+public:
+    /**
+     * @brief Creates the allocator. Pools are created on first use.
+     * @param createInfo The device and settings.
+     */
+    explicit DescriptorAllocator(const DescriptorAllocatorCreateInfo& createInfo);
+
+    /**
+     * @brief Destroys every pool and cached layout. The device must be idle.
+     */
+    ~DescriptorAllocator();
+
+    DescriptorAllocator(const DescriptorAllocator&) = delete;
+    DescriptorAllocator& operator=(const DescriptorAllocator&) = delete;
+
+    /**
+     * @brief Gets the layout with the given bindings, creating it on first use.
+     * @param bindings The bindings, in any order.
+     * @param flags The layout creation flags.
+     * @return The layout, owned by the allocator.
+     */
+    VkDescriptorSetLayout GetLayout(const std::vector<VkDescriptorSetLayoutBinding>& bindings, VkDescriptorSetLayoutCreateFlags flags = 0);
+
+    /**
+     * @brief Gets the layout of a single combined image sampler at binding 0, visible to fragment shaders.
+     *
+     * This is the layout ImGui's Vulkan backend binds textures with, so a set
+     * of this layout can be passed to ImGui::Image() as the ImTextureID.
+     */
+    VkDescriptorSetLayout GetTextureLayout();
+
+    /**
+     * @brief Allocates a set that lives as long as the allocator.
+     * @param layout The set's layout.
+     * @return The set. Throws std::runtime_error if no pool can hold it.
+     */
+    VkDescriptorSet Allocate(VkDescriptorSetLayout layout);
+
+    /**
+     * @brief Allocates a set from the current frame's pools, valid until that frame slot comes around again.
+     * @param layout The set's layout.
+     * @return The set. Throws std::runtime_error if no pool can hold it.
+     */
+    VkDescriptorSet AllocateTransient(VkDescriptorSetLayout layout);
+
+    /**
+     * @brief Allocates and writes a transient set of GetTextureLayout().
+     * @param sampler The sampler.
+     * @param view The image view.
+     * @param imageLayout The layout the image is in when the set is read.
+     * @return The set, usable as an ImTextureID for this frame.
+     */
+    VkDescriptorSet AllocateTransientTexture(VkSampler sampler, VkImageView view, VkImageLayout imageLayout);
+
+    /**
+     * @brief Resets the transient pools of a frame slot and makes it current.
+     * @param frameIndex The index of the current frame in flight; its fence must have been waited on.
+     */
+    void BeginFrame(uint32_t frameIndex);
+
+    /**
+     * @brief Gets the number of pools, sets and layouts.
+     */
+    DescriptorAllocatorStats GetStats() const;
+
+private:
+    /**
+     * @struct PoolList
+     * @brief Pools allocated from in order; pools before `current` are full.
+     */
+    struct PoolList
+    {
+        std::vector<VkDescriptorPool> pools;
+        size_t current = 0;
+        uint32_t setCount = 0;
+    };
+
+    /**
+     * @struct CachedLayout
+     * @brief A layout together with the signature it was created from, to tell hash collisions apart.
+     */
+    struct CachedLayout
+    {
+        VkDescriptorSetLayoutCreateFlags flags = 0;
+        std::vector<VkDescriptorSetLayoutBinding> bindings;
+        VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+    };
+
+    VkDescriptorSet allocate(PoolList& list, VkDescriptorSetLayout layout);
+    VkDescriptorPool createPool(uint32_t setCount) const;
+
+    VkDevice m_device;
+    uint32_t m_initialSetsPerPool;
+    uint32_t m_maxSetsPerPool;
+
+    PoolList m_persistent;
+    std::vector<PoolList> m_transient; ///< Per frame in flight.
+    uint32_t m_currentFrame = 0;
+
+    std::unordered_map<uint64_t, std::vector<CachedLayout>> m_layouts; ///< By binding signature hash.
+    uint32_t m_layoutCount = 0;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+
+/**
+ * @struct DeviceFeatures
+ * @brief The optional device capabilities that were found and enabled at device creation.
+ *
+ * Systems check these instead of querying the physical device themselves, so
+ * a feature is only used if it was actually enabled on the logical device.
+ */
+struct DeviceFeatures
+{
+    uint32_t apiVersion = VK_API_VERSION_1_0; ///< The Vulkan version in use (lowest of instance and device).
+    bool multiDrawIndirect = false;           ///< More than one draw per vkCmdDraw*Indirect call.
+    bool drawIndirectFirstInstance = false;   ///< Non-zero firstInstance in indirect draw commands.
+    bool drawIndirectCount = false;           ///< vkCmdDrawIndexedIndirectCount (Vulkan 1.2).
+    uint32_t maxDrawIndirectCount = 1;        ///< The largest drawCount of a single indirect draw call.
+    bool timelineSemaphore = false;           ///< Semaphores with a 64-bit counter (Vulkan 1.2).
+    bool textureCompressionBC = false;        ///< BC1-BC7 block-compressed image formats.
+    bool dynamicArrayIndexing = false;        ///< Sampled image and storage buffer arrays indexed with dynamically uniform values.
+    bool descriptorIndexing = false;          ///< Partially bound, update-after-bind sampled image and storage buffer arrays (Vulkan 1.2).
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <cstring>
+#include <vector>
+
+/**
+ * @struct RingAllocation
+ * @brief A chunk of per-frame data handed out by a FrameRingBuffer.
+ */
+struct RingAllocation
+{
+    VkBuffer buffer = VK_NULL_HANDLE; ///< The ring's buffer, shared by every chunk.
+    uint32_t offset = 0;              ///< Offset into the buffer, usable as a dynamic descriptor offset.
+    void* data = nullptr;             ///< CPU pointer to write the chunk through.
+};
+
+/**
+ * @class FrameRingBuffer
+ * @brief A persistently mapped, host-visible buffer for data that changes every frame.
+ *
+ * The buffer is split into one partition per frame in flight. BeginFrame()
+ * rewinds the partition of a frame slot, after which Allocate() bump-allocates
+ * aligned chunks from it for uniforms, per-draw constants or dynamic vertices.
+ * Because a slot is only rewound once its fence has been waited on, the GPU
+ * never reads a chunk that is being overwritten, and nothing is ever mapped,
+ * unmapped or created in the hot path.
+ */
+class FrameRingBuffer
+{
+public:
+    /**
+     * @brief Creates and maps the buffer.
+     * @param allocator The allocator the buffer memory comes from.
+     * @param physicalDevice The physical device, used to query the offset alignment limits.
+     * @param bytesPerFrame The capacity of each frame's partition.
+     * @param framesInFlight The number of partitions.
+     */
+    FrameRingBuffer(GpuAllocator& allocator, VkPhysicalDevice physicalDevice, VkDeviceSize bytesPerFrame, uint32_t framesInFlight);
+
+    /**
+     * @brief Destroys the buffer.
+     */
+    ~FrameRingBuffer();
+
+    FrameRingBuffer(const FrameRingBuffer&) = delete;
+    FrameRingBuffer& operator=(const FrameRingBuffer&) = delete;
+
+    /**
+     * @brief Rewinds the partition of a frame slot. Call after waiting on the slot's fence.
+     * @param frameIndex The index of the current frame in flight.
+     */
+    void BeginFrame(uint32_t frameIndex);
+
+    /**
+     * @brief Reserves a chunk of the current frame's partition.
+     * @param size The size of the chunk in bytes.
+     * @param alignment The offset alignment. 0 uses the device's uniform/storage offset alignment.
+     * @return The chunk. Throws std::runtime_error if the partition is full.
+     */
+    RingAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment = 0);
+
+    /**
+     * @brief Copies a value into a new chunk of the current frame's partition.
+     * @param value The value to copy.
+     * @return The chunk holding the value.
+     */
+    template<typename T>
+    RingAllocation Push(const T& value)
+    {
+        RingAllocation allocation = Allocate(sizeof(T));
+        std::memcpy(allocation.data, &value, sizeof(T));
+        return allocation;
+    }
+
+    VkBuffer GetBuffer() const { return m_buffer; }
+    VkDeviceSize GetFrameCapacity() const { return m_bytesPerFrame; }
+
+    /**
+     * @brief Gets the bytes still free in the current frame's partition, before alignment padding.
+     */
+    VkDeviceSize GetFrameRemaining() const { return m_bytesPerFrame - m_head; }
+
+    /**
+     * @brief Gets the number of bytes used by the most recently completed frame.
+     * @return The used bytes, including alignment padding.
+     */
+    VkDeviceSize GetLastFrameUsage() const { return m_lastFrameUsage; }
+
+private:
+    GpuAllocator& m_allocator;
+    VkBuffer m_buffer = VK_NULL_HANDLE;
+    GpuAllocation m_memory;
+
+    VkDeviceSize m_bytesPerFrame;
+    VkDeviceSize m_defaultAlignment;
+    uint32_t m_frameIndex = 0;
+    VkDeviceSize m_head = 0;          ///< Next free byte of the current partition, relative to its start.
+    VkDeviceSize m_lastFrameUsage = 0;
+};
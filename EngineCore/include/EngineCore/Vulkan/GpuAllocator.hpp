@@ -0,0 +1,166 @@
+#pragma once
+
+#include "EngineCore/Vulkan/BlockMetadata.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct GpuMemoryBlock;
+
+/**
+ * @struct GpuAllocationInfo
+ * @brief Describes how the memory of a resource should be allocated.
+ */
+struct GpuAllocationInfo
+{
+    VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT; ///< Required memory properties.
+    bool dedicated = false; ///< Give the resource its own VkDeviceMemory (e.g. large, resizable render targets).
+    bool transient = false; ///< Memory for short-lived data (e.g. the staging and per-frame rings), served from linear blocks.
+};
+
+/**
+ * @struct GpuAllocation
+ * @brief A range of device memory bound to one resource.
+ */
+struct GpuAllocation
+{
+    VkDeviceMemory memory = VK_NULL_HANDLE; ///< The memory object the range lives in.
+    VkDeviceSize offset = 0;                ///< The offset of the range inside the memory object.
+    VkDeviceSize size = 0;                  ///< The size of the range.
+    void* mappedData = nullptr;             ///< Persistent CPU pointer to the range, null if not host-visible.
+    GpuMemoryBlock* block = nullptr;        ///< The owning block, null for a dedicated allocation.
+};
+
+/**
+ * @struct GpuAllocatorStats
+ * @brief A snapshot of the allocator's memory usage.
+ */
+struct GpuAllocatorStats
+{
+    uint32_t blockCount = 0;               ///< Number of shared memory blocks.
+    uint32_t dedicatedCount = 0;           ///< Number of dedicated allocations.
+    uint32_t allocationCount = 0;          ///< Number of live allocations, including dedicated ones.
+    uint32_t deviceMemoryCount = 0;        ///< Number of live VkDeviceMemory objects.
+    VkDeviceSize blockBytes = 0;           ///< Total size of all shared blocks.
+    VkDeviceSize usedBytes = 0;            ///< Bytes of the shared blocks in use.
+    VkDeviceSize freeBytes = 0;            ///< Bytes of the shared blocks not in use.
+    VkDeviceSize largestFreeRange = 0;     ///< The largest contiguous free range of any block.
+    VkDeviceSize dedicatedBytes = 0;       ///< Total size of all dedicated allocations.
+    float fragmentation = 0.0f;            ///< 1 - largestFreeRange / freeBytes, 0 when the free space is contiguous.
+};
+
+/**
+ * @class GpuAllocator
+ * @brief Sub-allocates buffers and images from a few large VkDeviceMemory blocks.
+ *
+ * Drivers limit the number of live allocations (often to 4096) and each
+ * vkAllocateMemory call is slow, so resources share blocks instead. Blocks
+ * are kept per memory type and per resource kind: buffers and optimally
+ * tiled images never share a block, which satisfies bufferImageGranularity
+ * without extra padding. Host-visible blocks are mapped once for their whole
+ * lifetime. Allocations larger than half a block, flagged as dedicated, or
+ * for which the driver prefers a dedicated allocation get their own
+ * VkDeviceMemory. On Vulkan 1.1+ CreateBuffer() and CreateImage() query that
+ * preference and chain VkMemoryDedicatedAllocateInfo, so the driver can
+ * optimize the memory for its resource.
+ *
+ * All methods are thread-safe.
+ */
+class GpuAllocator
+{
+public:
+    /// @brief The preferred size of a shared block.
+    static constexpr VkDeviceSize DefaultBlockSize = 64ull * 1024 * 1024;
+
+    /**
+     * @brief Creates the allocator. No memory is allocated until the first request.
+     * @param device The logical Vulkan device.
+     * @param physicalDevice The physical device, used to query memory types and limits.
+     * @param apiVersion The Vulkan version of the device; 1.1+ enables the dedicated allocation queries.
+     */
+    GpuAllocator(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t apiVersion);
+
+    /**
+     * @brief Frees every block. All allocations must have been freed by then.
+     */
+    ~GpuAllocator();
+
+    GpuAllocator(const GpuAllocator&) = delete;
+    GpuAllocator& operator=(const GpuAllocator&) = delete;
+
+    /**
+     * @brief Allocates memory that satisfies the given requirements.
+     * @param requirements The requirements reported by Vulkan for the resource.
+     * @param info The requested properties and placement.
+     * @param isImage True for optimally tiled images, false for buffers and linear images.
+     * @return The allocation. Throws std::runtime_error if no memory is available.
+     */
+    GpuAllocation Allocate(const VkMemoryRequirements& requirements, const GpuAllocationInfo& info, bool isImage);
+
+    /**
+     * @brief Returns an allocation to its block. Freeing an empty allocation is a no-op.
+     * @param allocation The allocation to free. It is reset afterwards.
+     */
+    void Free(GpuAllocation& allocation);
+
+    /**
+     * @brief Creates a buffer and binds newly allocated memory to it.
+     * @param size The size of the buffer.
+     * @param usage The buffer usage flags.
+     * @param info The requested memory properties and placement.
+     * @param buffer Receives the buffer.
+     * @param allocation Receives the memory of the buffer.
+     */
+    void CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const GpuAllocationInfo& info, VkBuffer& buffer, GpuAllocation& allocation);
+
+    /**
+     * @brief Destroys a buffer created with CreateBuffer() and frees its memory.
+     */
+    void DestroyBuffer(VkBuffer& buffer, GpuAllocation& allocation);
+
+    /**
+     * @brief Creates an image and binds newly allocated memory to it.
+     * @param imageInfo The image description.
+     * @param info The requested memory properties and placement.
+     * @param image Receives the image.
+     * @param allocation Receives the memory of the image.
+     */
+    void CreateImage(const VkImageCreateInfo& imageInfo, const GpuAllocationInfo& info, VkImage& image, GpuAllocation& allocation);
+
+    /**
+     * @brief Destroys an image created with CreateImage() and frees its memory.
+     */
+    void DestroyImage(VkImage& image, GpuAllocation& allocation);
+
+    /**
+     * @brief Gathers the current memory usage.
+     * @return The statistics snapshot.
+     */
+    GpuAllocatorStats GetStats() const;
+
+private:
+    uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+    VkDeviceSize blockSizeFor(uint32_t memoryTypeIndex) const;
+    VkDeviceMemory allocateDeviceMemory(VkDeviceSize size, uint32_t memoryTypeIndex, const void* pNext, void** mappedData);
+
+    /**
+     * @brief Allocate(), with the resource a dedicated allocation would be bound to.
+     * @param dedicatedInfo The buffer or image to chain into a dedicated allocation, or null if unknown.
+     * @param prefersDedicated True if the driver asked for a dedicated allocation.
+     */
+    GpuAllocation allocate(const VkMemoryRequirements& requirements, const GpuAllocationInfo& info, bool isImage,
+        const VkMemoryDedicatedAllocateInfo* dedicatedInfo, bool prefersDedicated);
+
+    VkDevice m_device;
+    VkPhysicalDeviceMemoryProperties m_memoryProperties;
+    uint32_t m_maxAllocationCount;
+    bool m_dedicatedAllocation; ///< Whether VkMemoryDedicatedRequirements/AllocateInfo are available (Vulkan 1.1).
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<GpuMemoryBlock>> m_blocks;
+    uint32_t m_dedicatedCount = 0;
+    VkDeviceSize m_dedicatedBytes = 0;
+};
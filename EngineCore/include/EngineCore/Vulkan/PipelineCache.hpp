@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <string>
+
+/**
+ * @class PipelineCache
+ * @brief A VkPipelineCache that persists across runs in a file on disk.
+ *
+ * The file starts with a header identifying the device (vendor, device ID,
+ * driver version and pipeline cache UUID) plus a hash of the cache data.
+ * A file written by another GPU or driver, or a truncated/corrupt file, is
+ * ignored and the cache starts empty. Saving writes to a temporary file
+ * which is then renamed over the old one, so a crash mid-write never leaves
+ * a half-written cache behind.
+ */
+class PipelineCache
+{
+public:
+    /**
+     * @brief Creates the pipeline cache, seeded from the cache file if it is valid.
+     * @param device The logical Vulkan device.
+     * @param physicalDevice The physical device, used to validate the cache file.
+     * @param filePath The path of the cache file. If empty, nothing is loaded or saved.
+     */
+    PipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, std::string filePath);
+
+    /**
+     * @brief Destroys the pipeline cache. Does not save it; call Save() first.
+     */
+    ~PipelineCache();
+
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+
+    /**
+     * @brief Atomically writes the current cache contents to the cache file.
+     * @return True on success, false on failure (the old file is left untouched).
+     */
+    bool Save() const;
+
+    /**
+     * @brief Gets the Vulkan pipeline cache handle to pass to pipeline creation.
+     * @return The VkPipelineCache handle.
+     */
+    VkPipelineCache GetHandle() const { return m_cache; }
+
+private:
+    /**
+     * @brief Reads and validates the cache file.
+     * @param data Receives the cache data on success.
+     * @return True if a valid cache file was read.
+     */
+    bool load(std::string& data) const;
+
+    VkDevice m_device;
+    VkPhysicalDeviceProperties m_deviceProperties;
+    std::string m_filePath;
+    VkPipelineCache m_cache = VK_NULL_HANDLE;
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+
+/**
+ * @struct QueueFamilies
+ * @brief The queue families the engine submits to, picked from what a physical device offers.
+ *
+ * Graphics work always goes to a family with graphics and compute support.
+ * Copies prefer a dedicated transfer family (transfer only, usually backed
+ * by the DMA engines), and background compute prefers a compute family
+ * without graphics. Where no such family exists, the index is the graphics
+ * family, so callers can always use every field; HasDedicatedTransfer() and
+ * HasAsyncCompute() tell whether a separate queue is actually available.
+ */
+struct QueueFamilies
+{
+    static constexpr uint32_t None = UINT32_MAX;
+
+    uint32_t graphics = None; ///< Graphics and compute.
+    uint32_t present = None;  ///< Presentation to the surface; None when there is no surface.
+    uint32_t transfer = None; ///< Copies; the graphics family if there is no separate one.
+    uint32_t compute = None;  ///< Async compute; the graphics family if there is no separate one.
+
+    /**
+     * @brief Checks whether copies can run on a queue of their own.
+     */
+    bool HasDedicatedTransfer() const { return transfer != graphics; }
+
+    /**
+     * @brief Checks whether compute work can run on a queue of its own.
+     */
+    bool HasAsyncCompute() const { return compute != graphics; }
+
+    /**
+     * @brief Picks the queue families of a physical device.
+     * @param physicalDevice The device to inspect.
+     * @param surface The surface to present to, or VK_NULL_HANDLE when rendering headless.
+     * @return The families. Throws std::runtime_error if the device has no graphics family, or none that can present.
+     */
+    static QueueFamilies Find(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface);
+};
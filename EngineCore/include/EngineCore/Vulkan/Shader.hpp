@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * @class Shader
+ * @brief Helpers for loading compiled SPIR-V shaders into shader modules.
+ */
+class Shader
+{
+public:
+    /**
+     * @brief Reads a whole binary file.
+     * @param filename The path of the file.
+     * @return The file contents. Throws std::runtime_error if the file cannot be opened.
+     */
+    static std::vector<char> ReadFile(const std::string& filename);
+
+    /**
+     * @brief Creates a shader module from SPIR-V code.
+     * @param device The logical Vulkan device.
+     * @param code The SPIR-V code.
+     * @return The shader module. The caller destroys it once the pipeline is created.
+     */
+    static VkShaderModule CreateModule(VkDevice device, const std::vector<char>& code);
+
+    /**
+     * @brief Reads a SPIR-V file and creates a shader module from it.
+     * @param device The logical Vulkan device.
+     * @param filename The path of the .spv file.
+     * @return The shader module. The caller destroys it once the pipeline is created.
+     */
+    static VkShaderModule LoadModule(VkDevice device, const std::string& filename);
+};
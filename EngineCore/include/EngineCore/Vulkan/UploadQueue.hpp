@@ -0,0 +1,245 @@
+#pragma once
+
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/**
+ * @struct UploadQueueCreateInfo
+ * @brief The device, queues and ring size an UploadQueue is created with.
+ */
+struct UploadQueueCreateInfo
+{
+    VkDevice device = VK_NULL_HANDLE;
+    GpuAllocator* allocator = nullptr;
+    VkQueue graphicsQueue = VK_NULL_HANDLE;      ///< The queue that reads the uploaded data.
+    uint32_t graphicsFamily = 0;
+    VkQueue transferQueue = VK_NULL_HANDLE;      ///< A queue of a dedicated transfer family, or null to copy on the graphics queue.
+    uint32_t transferFamily = 0;                 ///< Needs timeline semaphores enabled when it differs from graphicsFamily.
+    VkDeviceSize capacity = 32ull * 1024 * 1024; ///< The size of the staging ring in bytes.
+};
+
+/**
+ * @class UploadQueue
+ * @brief Copies data into device-local buffers and images through a reusable staging ring, in batches tracked by fences.
+ *
+ * Data is written into a persistently mapped, host-visible ring buffer and a
+ * copy into the destination is recorded into the open batch. Submit() hands
+ * the batch to the queue; once it has finished, Update() releases the
+ * batch's part of the ring for reuse. Nothing waits for the queue to go
+ * idle: only when the ring is full does a call block, and then only until
+ * the oldest batch has finished.
+ *
+ * Without a dedicated transfer queue the copies run on the graphics queue
+ * and each batch ends with a barrier that makes them visible to any later
+ * submission, so data staged before a frame's command buffers are submitted
+ * can be read by them.
+ *
+ * With one, batches run on the transfer queue alongside the frames instead
+ * of between them, and signal a timeline semaphore with their id. A batch
+ * ends by releasing its destination ranges to the graphics family. Once the
+ * semaphore has reached the batch id, Update() submits the matching acquire
+ * barriers to the graphics queue, waiting on that value; the batch counts as
+ * complete from then on, since every later graphics submission sees the
+ * data. Destinations must then be resources the graphics queue has not used
+ * yet, as it would otherwise have to release them first.
+ *
+ * Images are uploaded level by level between BeginImage() and FinishImage(),
+ * which move the levels into TRANSFER_DST_OPTIMAL and then into their final
+ * layout (as part of the ownership transfer with a transfer queue).
+ *
+ * Uploads larger than the ring are split into several copies.
+ *
+ * Not thread-safe: all calls must come from the thread that submits to the queues.
+ */
+class UploadQueue
+{
+public:
+    /**
+     * @brief Creates the staging ring and the command pools the batches are recorded from.
+     * @param createInfo The device, allocator, queues and ring size.
+     */
+    explicit UploadQueue(const UploadQueueCreateInfo& createInfo);
+
+    /**
+     * @brief Waits for every submitted batch and destroys the ring, synchronization objects and command pools.
+     */
+    ~UploadQueue();
+
+    UploadQueue(const UploadQueue&) = delete;
+    UploadQueue& operator=(const UploadQueue&) = delete;
+
+    /**
+     * @brief Stages data and records its copy into a buffer.
+     *
+     * The data is copied into the ring right away, so it may be freed on
+     * return. The destination must stay alive until the batch has completed.
+     *
+     * @param data The bytes to upload.
+     * @param size The number of bytes.
+     * @param dstBuffer The destination, created with VK_BUFFER_USAGE_TRANSFER_DST_BIT.
+     * @param dstOffset The offset of the data in the destination.
+     */
+    void UploadBuffer(const void* data, VkDeviceSize size, VkBuffer dstBuffer, VkDeviceSize dstOffset = 0);
+
+    /**
+     * @brief Records the transition of a range of mip levels of a 2D color image to TRANSFER_DST_OPTIMAL, discarding their contents.
+     * @param image The destination image, created with VK_IMAGE_USAGE_TRANSFER_DST_BIT.
+     * @param baseLevel The first level to upload.
+     * @param levelCount The number of levels.
+     */
+    void BeginImage(VkImage image, uint32_t baseLevel, uint32_t levelCount);
+
+    /**
+     * @brief Stages one tightly packed mip level and records its copy into the image.
+     *
+     * Levels larger than a quarter of the ring are copied in bands of block
+     * rows. The level must have been passed to BeginImage() first.
+     *
+     * @param data The texels of the level.
+     * @param size The number of bytes.
+     * @param image The destination image.
+     * @param level The mip level.
+     * @param width The width of the level in texels.
+     * @param height The height of the level in texels.
+     * @param blockHeight The height of a compressed block of the format, 1 if uncompressed.
+     */
+    void UploadImage(const void* data, VkDeviceSize size, VkImage image, uint32_t level, uint32_t width, uint32_t height, uint32_t blockHeight = 1);
+
+    /**
+     * @brief Records the transition of uploaded levels to the layout the graphics queue reads them in.
+     * @param image The destination image.
+     * @param baseLevel The first level passed to BeginImage().
+     * @param levelCount The number of levels.
+     * @param finalLayout The layout the levels are used in, usually VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+     */
+    void FinishImage(VkImage image, uint32_t baseLevel, uint32_t levelCount, VkImageLayout finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    /**
+     * @brief Submits the copies recorded since the last submission. Does nothing if there are none.
+     * @return The id of the submitted batch, or of the last submitted one if nothing was recorded.
+     */
+    uint64_t Submit();
+
+    /**
+     * @brief Releases the ring space of every finished batch and hands it to the graphics queue. Never blocks.
+     */
+    void Update();
+
+    /**
+     * @brief Submits the open batch and blocks until every batch has completed.
+     */
+    void WaitIdle();
+
+    /**
+     * @brief Submits the open batch if needed and blocks until a batch is available to the graphics queue.
+     * @param batchId A batch id from Submit() or GetRecordingBatch().
+     */
+    void WaitAvailable(uint64_t batchId);
+
+    /**
+     * @brief Gets the id the open batch will be submitted with; copies recorded now complete with it.
+     */
+    uint64_t GetRecordingBatch() const { return m_nextBatchId; }
+
+    /**
+     * @brief Checks whether a batch and all batches before it have completed on the GPU.
+     *
+     * With a transfer queue this also means the batch's acquire barriers have
+     * been submitted to the graphics queue.
+     *
+     * @param batchId A batch id from Submit() or GetRecordingBatch().
+     */
+    bool IsComplete(uint64_t batchId) const { return batchId <= m_completedBatchId; }
+
+    /**
+     * @brief Checks whether graphics work submitted from now on can read the copies of a batch.
+     *
+     * On the graphics queue that is as soon as the batch is submitted; with a
+     * transfer queue, once it has completed.
+     *
+     * @param batchId A batch id from Submit() or GetRecordingBatch().
+     */
+    bool IsAvailable(uint64_t batchId) const { return m_dedicatedTransfer ? IsComplete(batchId) : batchId < m_nextBatchId; }
+
+    /**
+     * @brief Checks whether the copies run on a dedicated transfer queue.
+     */
+    bool UsesDedicatedTransfer() const { return m_dedicatedTransfer; }
+
+    /**
+     * @brief Gets the size of the staging ring.
+     */
+    VkDeviceSize GetCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Gets the bytes of the ring held by recorded or in-flight copies, including wrap-around padding.
+     */
+    VkDeviceSize GetUsedBytes() const { return m_usedBytes; }
+
+    /**
+     * @brief Gets the number of submitted batches that have not been released yet.
+     */
+    size_t GetPendingBatchCount() const { return m_pending.size(); }
+
+private:
+    /**
+     * @struct Batch
+     * @brief A command buffer of copies and the fence signaled when the batch is done.
+     *
+     * With a transfer queue the fence belongs to the acquire submission on the
+     * graphics queue, and the copies themselves are tracked by the timeline semaphore.
+     */
+    struct Batch
+    {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkCommandBuffer acquireCommandBuffer = VK_NULL_HANDLE; ///< Graphics family, transfer queue only.
+        VkFence fence = VK_NULL_HANDLE;
+        uint64_t id = 0;
+        VkDeviceSize ringEnd = 0;   ///< The ring head after the batch's last allocation.
+        VkDeviceSize ringBytes = 0; ///< Ring bytes the batch holds, including wrap-around padding.
+        std::vector<VkBufferMemoryBarrier> ownership; ///< Destination ranges handed to the graphics family.
+        std::vector<VkImageMemoryBarrier> imageOwnership; ///< Destination levels handed to the graphics family.
+    };
+
+    bool tryAllocate(VkDeviceSize size, VkDeviceSize& offset);
+    VkDeviceSize stage(const void* data, VkDeviceSize size);
+    void beginBatch();
+    void addOwnershipTransfer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size);
+    bool isTransferDone(const Batch& batch) const;
+    void retireOldest();
+    void submitAcquire(Batch& batch);
+    void recycleAcquired(bool wait);
+
+    VkDevice m_device;
+    GpuAllocator& m_allocator;
+    VkQueue m_graphicsQueue;
+    uint32_t m_graphicsFamily;
+    VkQueue m_transferQueue;
+    uint32_t m_transferFamily;
+    bool m_dedicatedTransfer;
+    VkCommandPool m_commandPool = VK_NULL_HANDLE;        ///< Transfer family; the copies are recorded from it.
+    VkCommandPool m_acquireCommandPool = VK_NULL_HANDLE; ///< Graphics family, transfer queue only.
+    VkSemaphore m_timeline = VK_NULL_HANDLE;             ///< Reaches a batch id once its copies are done, transfer queue only.
+
+    // --- Staging Ring ---
+    VkBuffer m_ringBuffer = VK_NULL_HANDLE;
+    GpuAllocation m_ringMemory;
+    VkDeviceSize m_capacity;
+    VkDeviceSize m_head = 0;      ///< Next free byte.
+    VkDeviceSize m_tail = 0;      ///< First byte still in use by a recorded or pending batch.
+    VkDeviceSize m_usedBytes = 0;
+
+    // --- Batches ---
+    Batch m_recording;                  ///< The open batch; its command buffer is null until the first copy.
+    VkDeviceSize m_recordingBytes = 0;
+    std::deque<Batch> m_pending;        ///< Submitted batches still holding ring space, oldest first.
+    std::deque<Batch> m_acquiring;      ///< Batches whose acquire barriers run on the graphics queue, oldest first.
+    std::vector<Batch> m_freeBatches;   ///< Finished batches whose command buffers and fence are reused.
+    uint64_t m_nextBatchId = 1;
+    uint64_t m_completedBatchId = 0;
+};
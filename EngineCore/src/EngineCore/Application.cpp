@@ -4,6 +4,9 @@
 #include <stdexcept>
 #include <vector>
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <ctime>
 
 // --- External Libraries ---
 #define GLFW_INCLUDE_VULKAN
@@ -14,8 +17,14 @@
 
 // --- EngineCore Includes ---
 #include "EngineCore/Logger.hpp"
+#include "EngineCore/Benchmark.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "EngineCore/Renderer.hpp"
 #include "EngineCore/Camera.hpp"
+#include "EngineCore/Assets/MeshImporter.hpp"
+#include "EngineCore/Assets/MeshFile.hpp"
+#include "EngineCore/Assets/TextureImporter.hpp"
+#include "EngineCore/Scene/BenchmarkScene.hpp"
 #include "EngineCore/Events/ApplicationEvent.hpp"
 #include "EngineCore/Events/KeyEvent.hpp"
 #include "EngineCore/Events/MouseEvent.hpp"
@@ -26,13 +35,26 @@
 #include "EngineCore/UI/ConsolePanel.hpp"
 #include "EngineCore/UI/ViewportPanel.hpp"
 #include "EngineCore/UI/SystemInfoPanel.hpp"
+#include "EngineCore/UI/RendererStatsPanel.hpp"
+#include "EngineCore/UI/GpuProfilerPanel.hpp"
+#include "EngineCore/UI/TexturePanel.hpp"
+#include "EngineCore/UI/AssetCachePanel.hpp"
+
+namespace
+{
+    /// Seconds the viewport size must hold still before the scene image follows it, so dragging a
+    /// splitter does not allocate new render targets every frame; meanwhile the old image is stretched
+    constexpr float SceneResizeDelay = 0.2f;
+}
 
 // =================================================================================
 // Constructor and Destructor
 // =================================================================================
 
-Application::Application()
+Application::Application(const EngineConfig& config)
+    : m_config(config)
 {
+    m_config.Validate();
     init();
 }
 
@@ -47,12 +69,18 @@ Application::~Application()
 
 void Application::run()
 {
-    mainLoop();
+    if (m_config.headless) {
+        runHeadless();
+    } else {
+        mainLoop();
+    }
 }
 
 void Application::close()
 {
-    glfwSetWindowShouldClose(m_window, true);
+    if (m_window) {
+        glfwSetWindowShouldClose(m_window, true);
+    }
 }
 
 void Application::OnEvent(Event& e)
@@ -78,27 +106,168 @@ void Application::OnEvent(Event& e)
 
 void Application::init()
 {
-    Log::GetCoreLogger()->info("Starting application initialization...");
-    initWindow();
+    ENGINE_PROFILE_FUNCTION();
+    CpuProfiler::SetThreadName("Main");
+    Log::GetCoreLogger()->info("Starting application initialization ({0} frames in flight{1})...",
+        m_config.framesInFlight, m_config.headless ? ", headless" : "");
+    if (!m_config.headless) {
+        initWindow();
+    }
     initVulkan();
-    initImGui();
+    if (!m_config.headless) {
+        initImGui();
+    }
+
+    // In headless mode there is no swapchain, so the scene is rendered at the configured size
+    VkExtent2D sceneExtent = m_config.headless ? VkExtent2D{ m_config.sceneWidth, m_config.sceneHeight } : m_swapChainExtent;
+
+    // Create the GPU profiler; headless runs keep every sample for the final report
+    m_gpuProfiler = std::make_unique<GpuProfiler>(m_device, m_physicalDevice, m_queueFamilies.graphics, m_config.framesInFlight);
+    m_gpuProfiler->SetRecording(m_config.headless);
+
+    // Worker threads shared by CPU-side systems
+    m_threadPool = std::make_unique<ThreadPool>();
+    Log::GetCoreLogger()->info("Thread pool started with {0} workers.", m_threadPool->GetThreadCount());
+
+    // Replaced GPU objects are destroyed once the frames that use them have completed, instead of idling the device
+    DeletionQueueCreateInfo deletionInfo{};
+    deletionInfo.device = m_device;
+    deletionInfo.allocator = m_allocator.get();
+    deletionInfo.framesInFlight = m_config.framesInFlight;
+    deletionInfo.timelineSemaphore = m_deviceFeatures.timelineSemaphore;
+    m_deletionQueue = std::make_unique<DeletionQueue>(deletionInfo);
+
+    // Every upload is staged through one ring and copied on the transfer queue, or on the graphics queue ahead of the frames
+    UploadQueueCreateInfo uploadInfo{};
+    uploadInfo.device = m_device;
+    uploadInfo.allocator = m_allocator.get();
+    uploadInfo.graphicsQueue = m_graphicsQueue;
+    uploadInfo.graphicsFamily = m_queueFamilies.graphics;
+    uploadInfo.transferQueue = m_transferQueue;
+    uploadInfo.transferFamily = m_queueFamilies.transfer;
+    uploadInfo.capacity = static_cast<VkDeviceSize>(m_config.stagingRingMegabytes) * 1024 * 1024;
+    m_uploadQueue = std::make_unique<UploadQueue>(uploadInfo);
+
+    // Descriptor sets come from pools that grow on demand; transient ones are reset per frame slot
+    DescriptorAllocatorCreateInfo descriptorInfo{};
+    descriptorInfo.device = m_device;
+    descriptorInfo.framesInFlight = m_config.framesInFlight;
+    m_descriptorAllocator = std::make_unique<DescriptorAllocator>(descriptorInfo);
+
+    // Textures and buffers are registered once and indexed from push constants, with per-frame sets as the fallback
+    BindlessTableCreateInfo bindlessInfo{};
+    bindlessInfo.device = m_device;
+    bindlessInfo.allocator = m_allocator.get();
+    bindlessInfo.uploadQueue = m_uploadQueue.get();
+    bindlessInfo.framesInFlight = m_config.framesInFlight;
+    bindlessInfo.descriptorIndexing = m_config.bindless && m_deviceFeatures.descriptorIndexing;
+    m_bindlessTable = std::make_unique<BindlessTable>(bindlessInfo);
 
     // Create the renderer AFTER Vulkan is initialized, passing it the necessary resources
-    m_renderer = std::make_unique<Renderer>(m_device, m_physicalDevice, m_commandPool, m_graphicsQueue, 2, m_swapChainExtent);
+    RendererCreateInfo rendererInfo{};
+    rendererInfo.device = m_device;
+    rendererInfo.physicalDevice = m_physicalDevice;
+    rendererInfo.commandPool = m_commandPool;
+    rendererInfo.graphicsQueue = m_graphicsQueue;
+    rendererInfo.framesInFlight = m_config.framesInFlight;
+    rendererInfo.sceneExtent = sceneExtent;
+    rendererInfo.enableDynamicResolution = m_config.dynamicResolution;
+    rendererInfo.targetFrameMilliseconds = m_config.targetFrameMs;
+    rendererInfo.minRenderScale = m_config.minRenderScale;
+    Upscaler::ParsePreset(m_config.upscalePreset, rendererInfo.upscalePreset);
+    rendererInfo.enableImGui = !m_config.headless;
+    rendererInfo.profiler = m_gpuProfiler.get();
+    rendererInfo.pipelineCache = m_pipelineCache->GetHandle();
+    rendererInfo.allocator = m_allocator.get();
+    rendererInfo.frameDataBytes = static_cast<VkDeviceSize>(m_config.frameDataMegabytes) * 1024 * 1024;
+    rendererInfo.features = m_deviceFeatures;
+    rendererInfo.enableGpuCulling = m_config.gpuCulling;
+    rendererInfo.enableCpuCulling = m_config.cpuCulling;
+    rendererInfo.enableBvhCulling = m_config.bvhCulling;
+    rendererInfo.enableLods = m_config.lods;
+    rendererInfo.lodPixelError = m_config.lodPixelError;
+    rendererInfo.threadPool = m_threadPool.get();
+    rendererInfo.uploadQueue = m_uploadQueue.get();
+    rendererInfo.bindless = m_bindlessTable.get();
+    rendererInfo.descriptorAllocator = m_descriptorAllocator.get();
+    rendererInfo.deletionQueue = m_deletionQueue.get();
+    m_renderer = std::make_unique<Renderer>(rendererInfo);
+
+    // A cache that cannot be opened only costs import time, so run without it
+    if (!m_config.assetCachePath.empty()) {
+        try {
+            m_assetCache = std::make_unique<AssetCache>(m_config.assetCachePath);
+        }
+        catch (const std::exception& e) {
+            Log::GetCoreLogger()->warn("Running without an asset cache: {0}", e.what());
+        }
+    }
+
+    m_meshLoader = std::make_unique<MeshLoader>(*m_allocator, *m_uploadQueue, *m_threadPool);
+    m_meshLoader->SetGenerateLods(m_config.lods);
+    m_meshLoader->SetUploadBudget(static_cast<VkDeviceSize>(m_config.uploadBudgetMegabytes) * 1024 * 1024);
+    m_meshLoader->SetAssetCache(m_assetCache.get());
+    VertexLayout vertexLayout = VertexLayout::Float;
+    VertexFormat::Parse(m_config.vertexLayout, vertexLayout);
+    m_meshLoader->SetVertexLayout(vertexLayout);
+    m_meshLoader->SetOptimizeMeshes(m_config.meshOptimization);
+
+    TextureStreamerCreateInfo textureInfo{};
+    textureInfo.device = m_device;
+    textureInfo.physicalDevice = m_physicalDevice;
+    textureInfo.allocator = m_allocator.get();
+    textureInfo.uploadQueue = m_uploadQueue.get();
+    textureInfo.threadPool = m_threadPool.get();
+    textureInfo.graphicsQueue = m_graphicsQueue;
+    textureInfo.graphicsFamily = m_queueFamilies.graphics;
+    textureInfo.deletionQueue = m_deletionQueue.get();
+    textureInfo.textureCompressionBC = m_deviceFeatures.textureCompressionBC;
+    textureInfo.budget = static_cast<VkDeviceSize>(m_config.textureBudgetMegabytes) * 1024 * 1024;
+    textureInfo.bindless = m_bindlessTable.get();
+    m_textureStreamer = std::make_unique<TextureStreamer>(textureInfo);
+
+    // Create the camera, with a far plane that fits the benchmark grid if one is requested
+    float sceneRadius = m_config.instanceGrid > 0 ? BenchmarkScene::GetGridRadius(m_config.instanceGrid) : 0.0f;
+    float farClip = std::max(100.0f, sceneRadius * 4.0f);
+    m_camera = std::make_unique<Camera>(45.0f, (float)sceneExtent.width / (float)sceneExtent.height, 0.1f, farClip);
+
+    if (m_config.instanceGrid > 0) {
+        if (m_config.instanceMesh == "sphere" && m_config.meshPath.empty()) {
+            m_pendingMesh = m_meshLoader->LoadAsync(BenchmarkScene::CreateSphereMesh(64));
+        }
+        m_renderer->SetInstances(BenchmarkScene::CreateCubeGrid(m_config.instanceGrid));
+        m_camera->Focus(glm::vec3(0.0f), sceneRadius * 2.0f);
+    }
+    if (!m_config.meshPath.empty()) {
+        loadMesh(m_config.meshPath);
+    }
 
-    // Create the camera
-    m_camera = std::make_unique<Camera>(45.0f, (float)m_width / (float)m_height, 0.1f, 100.0f);
+    if (m_config.headless) {
+        Log::GetCoreLogger()->info("Application initialized successfully (headless).");
+        return;
+    }
 
     // Create and add all UI panels to the list
     m_UIPanels.push_back(std::make_unique<MainMenuPanel>(this));
     m_UIPanels.push_back(std::make_unique<DeviceInfoPanel>(m_deviceProperties));
     m_UIPanels.push_back(std::make_unique<SystemInfoPanel>(m_physicalDevice));
+    m_UIPanels.push_back(std::make_unique<RendererStatsPanel>(*m_renderer));
+    m_UIPanels.push_back(std::make_unique<GpuProfilerPanel>(*m_gpuProfiler));
     auto viewportPanel = std::make_unique<ViewportPanel>(*m_renderer);
     m_viewportPanel = viewportPanel.get(); // Store a raw pointer for direct access
     m_UIPanels.push_back(std::move(viewportPanel));
     m_UIPanels.push_back(std::make_unique<SceneHierarchyPanel>());
     m_UIPanels.push_back(std::make_unique<InspectorPanel>(*m_renderer));
     m_UIPanels.push_back(std::make_unique<ConsolePanel>());
+    m_UIPanels.push_back(std::make_unique<TexturePanel>(*m_textureStreamer, *m_descriptorAllocator));
+    if (m_assetCache) {
+        m_UIPanels.push_back(std::make_unique<AssetCachePanel>(*m_assetCache));
+    }
+
+    // Headless runs benchmark the untextured scene, so they skip textures
+    if (!m_config.texturePath.empty()) {
+        loadTexture(m_config.texturePath);
+    }
     
     Log::GetCoreLogger()->info("Application initialized successfully.");
 }
@@ -161,9 +330,21 @@ void Application::initVulkan()
 {
     Log::GetCoreLogger()->info("--- Initializing Vulkan ---");
     createInstance();
+    if (m_config.headless) {
+        // Only the offscreen scene is rendered: no surface, swapchain or UI render targets
+        pickPhysicalDevice();
+        createLogicalDevice();
+        m_allocator = std::make_unique<GpuAllocator>(m_device, m_physicalDevice, m_deviceFeatures.apiVersion);
+        createPipelineCache();
+        createCommandPool();
+        createSyncObjects();
+        return;
+    }
     createSurface();
     pickPhysicalDevice();
     createLogicalDevice();
+    m_allocator = std::make_unique<GpuAllocator>(m_device, m_physicalDevice, m_deviceFeatures.apiVersion);
+    createPipelineCache();
     createSwapChain();
     createImageViews();
     createRenderPass();
@@ -177,24 +358,15 @@ void Application::initImGui()
 {
     Log::GetCoreLogger()->info("--- Initializing ImGui ---");
 
-    // 1. Create a descriptor pool for ImGui
+    // 1. Create a descriptor pool for ImGui. Only its font atlas lives here: the textures the panels
+    //    show are transient sets of the engine's descriptor allocator
     VkDescriptorPoolSize pool_sizes[] = {
-        { VK_DESCRIPTOR_TYPE_SAMPLER, 1000 },
-        { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1000 },
-        { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1000 },
-        { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1000 },
-        { VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1000 },
-        { VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 1000 },
-        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1000 },
-        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1000 },
-        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1000 },
-        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1000 },
-        { VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT, 1000 }
+        { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 16 }
     };
     VkDescriptorPoolCreateInfo pool_info = {};
     pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
-    pool_info.maxSets = 1000 * std::size(pool_sizes);
+    pool_info.maxSets = 16;
     pool_info.poolSizeCount = (uint32_t)std::size(pool_sizes);
     pool_info.pPoolSizes = pool_sizes;
     if (vkCreateDescriptorPool(m_device, &pool_info, nullptr, &m_descriptorPool) != VK_SUCCESS) {
@@ -217,13 +389,14 @@ void Application::initImGui()
     init_info.Instance = m_instance;
     init_info.PhysicalDevice = m_physicalDevice;
     init_info.Device = m_device;
-    init_info.QueueFamily = 0; // Assuming queue family 0 for graphics
+    init_info.QueueFamily = m_queueFamilies.graphics;
     init_info.Queue = m_graphicsQueue;
     init_info.DescriptorPool = m_descriptorPool;
     init_info.MinImageCount = 2; // Double buffering
     init_info.ImageCount = static_cast<uint32_t>(m_swapChainImages.size());
     init_info.MSAASamples = VK_SAMPLE_COUNT_1_BIT;
     init_info.RenderPass = m_renderPass;
+    init_info.PipelineCache = m_pipelineCache->GetHandle();
     
     ImGui_ImplVulkan_Init(&init_info);
 
@@ -243,33 +416,181 @@ void Application::mainLoop()
     vkDeviceWaitIdle(m_device);
 }
 
+void Application::runHeadless()
+{
+    using Clock = std::chrono::steady_clock;
+    Log::GetCoreLogger()->info("Rendering {0} headless frames at {1}x{2} ({3} warmup)...",
+        m_config.benchmarkFrames, m_config.sceneWidth, m_config.sceneHeight, m_config.benchmarkWarmupFrames);
+
+    std::vector<double> frameTimes; // Wall time between consecutive frames, bounded by max(CPU, GPU)
+    std::vector<double> cpuTimes;   // CPU time spent recording and submitting a frame
+    frameTimes.reserve(m_config.benchmarkFrames);
+    cpuTimes.reserve(m_config.benchmarkFrames);
+
+    // Every frame should draw the final mesh, so finish loading before measuring anything
+    m_meshLoader->Flush();
+    updateMeshes();
+
+    Clock::time_point runStart = Clock::now();
+    Clock::time_point measureStart = runStart;
+    Clock::time_point lastFrameEnd = runStart;
+    for (uint32_t frame = 0; frame < m_config.benchmarkFrames; frame++) {
+        ENGINE_PROFILE_SCOPE("Application::headlessFrame");
+
+        // Wait until the GPU has finished with this frame slot
+        vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+        vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
+        m_gpuProfiler->BeginFrame(m_currentFrame);
+        m_descriptorAllocator->BeginFrame(m_currentFrame);
+        m_deletionQueue->BeginFrame();
+
+        Clock::time_point cpuStart = Clock::now();
+        m_renderer->SetViewProjection(m_camera->GetViewMatrix(), m_camera->GetProjectionMatrix());
+        VkCommandBuffer sceneCommandBuffer = m_renderer->Render(m_currentFrame);
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &sceneCommandBuffer;
+        VkSemaphore timeline = m_deletionQueue->GetTimelineSemaphore();
+        uint64_t timelineValue = m_deletionQueue->GetFrame();
+        VkTimelineSemaphoreSubmitInfo timelineInfo{};
+        if (timeline != VK_NULL_HANDLE) {
+            timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineInfo.signalSemaphoreValueCount = 1;
+            timelineInfo.pSignalSemaphoreValues = &timelineValue;
+            submitInfo.pNext = &timelineInfo;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores = &timeline;
+        }
+        if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_inFlightFences[m_currentFrame]) != VK_SUCCESS) {
+            throw std::runtime_error("failed to submit headless scene command buffer!");
+        }
+        Clock::time_point frameEnd = Clock::now();
+
+        // Skip the warmup frames so pipeline and driver first-use costs don't skew the results
+        if (frame == m_config.benchmarkWarmupFrames) {
+            measureStart = frameEnd;
+        } else if (frame > m_config.benchmarkWarmupFrames) {
+            frameTimes.push_back(std::chrono::duration<double, std::milli>(frameEnd - lastFrameEnd).count());
+            cpuTimes.push_back(std::chrono::duration<double, std::milli>(frameEnd - cpuStart).count());
+        }
+        lastFrameEnd = frameEnd;
+        m_currentFrame = (m_currentFrame + 1) % m_config.framesInFlight;
+    }
+    vkDeviceWaitIdle(m_device);
+    Clock::time_point runEnd = Clock::now();
+    m_gpuProfiler->CollectAll();
+
+    // --- Report ---
+    double measuredSeconds = std::chrono::duration<double>(runEnd - measureStart).count();
+    BenchmarkReport report("headless");
+    report.AddValue("frames", static_cast<double>(m_config.benchmarkFrames));
+    report.AddValue("measured_frames", static_cast<double>(frameTimes.size()));
+    report.AddValue("frames_in_flight", static_cast<double>(m_config.framesInFlight));
+    report.AddValue("scene_width", static_cast<double>(m_config.sceneWidth));
+    report.AddValue("scene_height", static_cast<double>(m_config.sceneHeight));
+    report.AddValue("dynamic_resolution", m_renderer->GetDynamicResolution().IsEnabled() ? 1.0 : 0.0);
+    report.AddValue("render_scale", static_cast<double>(m_renderer->GetRenderExtent().width) / m_renderer->GetSceneExtent().width);
+    report.AddValue("upscale_preset", static_cast<double>(m_renderer->GetUpscaler().GetPreset()));
+    report.AddValue("upscale_sharpness", static_cast<double>(m_renderer->GetUpscaler().GetSharpness()));
+    report.AddValue("instances", static_cast<double>(m_renderer->GetInstanceCount()));
+    report.AddValue("gpu_culling", m_renderer->IsGpuCullingActive() ? 1.0 : 0.0);
+    report.AddValue("cpu_culling", m_renderer->IsCpuCullingActive() ? 1.0 : 0.0);
+    report.AddValue("bvh_culling", m_renderer->IsCpuCullingActive() && m_renderer->IsBvhCullingEnabled() ? 1.0 : 0.0);
+    report.AddValue("lods", m_renderer->IsLodEnabled() ? static_cast<double>(m_renderer->GetMeshLods().size()) : 1.0);
+    report.AddValue("mesh_triangles", static_cast<double>(m_renderer->GetMeshLods().front().indexCount / 3));
+    const GpuMesh& mesh = m_renderer->GetMesh();
+    report.AddValue("vertex_stride", static_cast<double>(VertexFormat::GetStride(mesh.vertexLayout)));
+    report.AddValue("vertex_buffer_bytes", static_cast<double>(VertexFormat::GetStride(mesh.vertexLayout)) * mesh.vertexCount);
+    report.AddValue("index_size", mesh.indexType == VK_INDEX_TYPE_UINT16 ? 2.0 : 4.0);
+    report.AddValue("visible_objects", static_cast<double>(m_renderer->GetVisibleCount()));
+    report.AddValue("total_seconds", std::chrono::duration<double>(runEnd - runStart).count());
+    report.AddValue("average_fps", measuredSeconds > 0.0 ? frameTimes.size() / measuredSeconds : 0.0);
+    report.AddTiming("frame_ms", TimingSummary::FromSamples(frameTimes));
+    report.AddTiming("cpu_record_ms", TimingSummary::FromSamples(cpuTimes));
+    GpuAllocatorStats memoryStats = m_allocator->GetStats();
+    report.AddValue("gpu_memory_objects", static_cast<double>(memoryStats.deviceMemoryCount));
+    report.AddValue("gpu_memory_allocations", static_cast<double>(memoryStats.allocationCount));
+    report.AddValue("gpu_memory_used_bytes", static_cast<double>(memoryStats.usedBytes + memoryStats.dedicatedBytes));
+    DescriptorAllocatorStats descriptorStats = m_descriptorAllocator->GetStats();
+    report.AddValue("descriptor_pools", static_cast<double>(descriptorStats.persistentPools + descriptorStats.transientPools));
+    report.AddValue("descriptor_layouts", static_cast<double>(descriptorStats.layoutCount));
+    report.AddValue("pending_deletions", static_cast<double>(m_deletionQueue->GetPendingCount()));
+    if (m_gpuProfiler->IsSupported()) {
+        // GPU samples include the warmup frames; drop them so both sets cover the same range
+        auto measured = [this](const std::vector<double>& samples) {
+            size_t skip = std::min<size_t>(m_config.benchmarkWarmupFrames + 1, samples.size());
+            return std::vector<double>(samples.begin() + skip, samples.end());
+        };
+        report.AddTiming("gpu_frame_ms", TimingSummary::FromSamples(measured(m_gpuProfiler->GetFrameStats().recorded)));
+        for (const GpuScopeStats& scope : m_gpuProfiler->GetScopes()) {
+            report.AddTiming("gpu_" + scope.name + "_ms", TimingSummary::FromSamples(measured(scope.recorded)));
+        }
+    }
+    report.Log();
+    if (!m_config.benchmarkOutput.empty()) {
+        report.WriteJson(m_config.benchmarkOutput);
+    }
+}
+
+void Application::captureCpuTrace()
+{
+    // Name the file after the wall-clock time so repeated captures don't overwrite each other
+    std::time_t now = std::time(nullptr);
+    char fileName[64];
+    std::strftime(fileName, sizeof(fileName), "cpu_trace_%Y%m%d_%H%M%S.json", std::localtime(&now));
+    if (CpuProfiler::WriteChromeTrace(fileName)) {
+        ConsolePanel::AddLog(std::string("CPU trace written to ") + fileName);
+    }
+}
+
 void Application::cleanup()
 {
     Log::GetCoreLogger()->info("--- Cleaning up resources ---");
+    if (!m_config.cpuTraceOutput.empty()) {
+        CpuProfiler::WriteChromeTrace(m_config.cpuTraceOutput);
+    }
     if (m_device) {
         vkDeviceWaitIdle(m_device); // Ensure GPU is idle before destroying resources
     }
 
     m_renderer.reset(); // Destroy the renderer first
+    m_meshLoader.reset();
+    m_textureStreamer.reset();
+    m_bindlessTable.reset(); // After the streamer, which releases its slots into it
+    m_descriptorAllocator.reset(); // After every system whose layouts and sets it holds
+    m_uploadQueue.reset();
+    m_gpuProfiler.reset();
+    m_threadPool.reset();
+    m_assetCache.reset(); // Abandoned import jobs may still have been cooking into it
+    m_deletionQueue.reset(); // After every system that retires objects into it; the device is idle
     
-    // Shutdown ImGui
-    ImGui_ImplVulkan_Shutdown();
-    ImGui_ImplGlfw_Shutdown();
-    ImGui::DestroyContext();
+    // Shutdown ImGui (never initialized in headless mode)
+    if (!m_config.headless) {
+        ImGui_ImplVulkan_Shutdown();
+        ImGui_ImplGlfw_Shutdown();
+        ImGui::DestroyContext();
+    }
     
     // Cleanup Vulkan resources in reverse order of creation
+    if (m_pipelineCache) {
+        m_pipelineCache->Save(); // Every pipeline has been created by now
+        m_pipelineCache.reset();
+    }
+    m_allocator.reset(); // Every resource living in its blocks is gone by now
     if (m_descriptorPool != VK_NULL_HANDLE) {
         vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
     }
-    for (size_t i = 0; i < 2; i++) {
+    for (size_t i = 0; i < m_inFlightFences.size(); i++) {
         vkDestroySemaphore(m_device, m_renderFinishedSemaphores[i], nullptr);
         vkDestroySemaphore(m_device, m_imageAvailableSemaphores[i], nullptr);
         vkDestroyFence(m_device, m_inFlightFences[i], nullptr);
     }
+    cleanupSwapChain(); // Cleans up swapchain-dependent resources
     if (m_commandPool != VK_NULL_HANDLE) {
         vkDestroyCommandPool(m_device, m_commandPool, nullptr);
     }
-    cleanupSwapChain(); // Cleans up swapchain-dependent resources
     if (m_renderPass != VK_NULL_HANDLE) {
         vkDestroyRenderPass(m_device, m_renderPass, nullptr);
     }
@@ -284,8 +605,10 @@ void Application::cleanup()
     }
 
     // Cleanup GLFW
-    glfwDestroyWindow(m_window);
-    glfwTerminate();
+    if (m_window) {
+        glfwDestroyWindow(m_window);
+        glfwTerminate();
+    }
     Log::GetCoreLogger()->info("Cleanup complete.");
 }
 
@@ -300,15 +623,24 @@ void Application::createInstance() {
     appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
     appInfo.pEngineName = "No Engine";
     appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-    appInfo.apiVersion = VK_API_VERSION_1_0;
+    // Use Vulkan 1.2 where the loader supports it (indirect count draws); 1.0 loaders lack vkEnumerateInstanceVersion
+    m_instanceApiVersion = VK_API_VERSION_1_0;
+    auto enumerateInstanceVersion = reinterpret_cast<PFN_vkEnumerateInstanceVersion>(vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceVersion"));
+    if (enumerateInstanceVersion && enumerateInstanceVersion(&m_instanceApiVersion) == VK_SUCCESS) {
+        m_instanceApiVersion = std::min<uint32_t>(m_instanceApiVersion, VK_API_VERSION_1_2);
+    }
+    appInfo.apiVersion = m_instanceApiVersion;
 
     VkInstanceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
     createInfo.pApplicationInfo = &appInfo;
     
-    // Get required extensions from GLFW
+    // Get required extensions from GLFW (headless mode presents nothing and needs none)
     uint32_t glfwExtensionCount = 0;
-    const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+    const char** glfwExtensions = nullptr;
+    if (!m_config.headless) {
+        glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+    }
     createInfo.enabledExtensionCount = glfwExtensionCount;
     createInfo.ppEnabledExtensionNames = glfwExtensions;
     createInfo.enabledLayerCount = 0; // No validation layers for now
@@ -341,29 +673,105 @@ void Application::pickPhysicalDevice() {
 
     vkGetPhysicalDeviceProperties(m_physicalDevice, &m_deviceProperties);
     Log::GetCoreLogger()->info("Picked physical device: {0}", m_deviceProperties.deviceName);
+
+    m_queueFamilies = QueueFamilies::Find(m_physicalDevice, m_surface);
+    Log::GetCoreLogger()->info("Queue families: graphics {0}, transfer {1}{2}, compute {3}{4}",
+        m_queueFamilies.graphics, m_queueFamilies.transfer, m_queueFamilies.HasDedicatedTransfer() ? " (dedicated)" : "",
+        m_queueFamilies.compute, m_queueFamilies.HasAsyncCompute() ? " (async)" : "");
 }
 
 void Application::createLogicalDevice() {
-    // Assuming the first queue family supports graphics, which is usually the case.
-    uint32_t queueFamilyIndex = 0; 
-    
-    VkDeviceQueueCreateInfo queueCreateInfo{};
-    queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    queueCreateInfo.queueFamilyIndex = queueFamilyIndex;
-    queueCreateInfo.queueCount = 1;
+    // Enable the optional features GPU-driven rendering can use, where supported
+    m_deviceFeatures = DeviceFeatures();
+    m_deviceFeatures.apiVersion = std::min(m_instanceApiVersion, m_deviceProperties.apiVersion);
+    m_deviceFeatures.maxDrawIndirectCount = m_deviceProperties.limits.maxDrawIndirectCount;
+
+    VkPhysicalDeviceFeatures supportedFeatures;
+    vkGetPhysicalDeviceFeatures(m_physicalDevice, &supportedFeatures);
+    VkPhysicalDeviceFeatures deviceFeatures{};
+    deviceFeatures.multiDrawIndirect = supportedFeatures.multiDrawIndirect;
+    deviceFeatures.drawIndirectFirstInstance = supportedFeatures.drawIndirectFirstInstance;
+    deviceFeatures.textureCompressionBC = supportedFeatures.textureCompressionBC;
+    deviceFeatures.shaderSampledImageArrayDynamicIndexing = supportedFeatures.shaderSampledImageArrayDynamicIndexing;
+    deviceFeatures.shaderStorageBufferArrayDynamicIndexing = supportedFeatures.shaderStorageBufferArrayDynamicIndexing;
+    m_deviceFeatures.multiDrawIndirect = supportedFeatures.multiDrawIndirect == VK_TRUE;
+    m_deviceFeatures.drawIndirectFirstInstance = supportedFeatures.drawIndirectFirstInstance == VK_TRUE;
+    m_deviceFeatures.textureCompressionBC = supportedFeatures.textureCompressionBC == VK_TRUE;
+    m_deviceFeatures.dynamicArrayIndexing = supportedFeatures.shaderSampledImageArrayDynamicIndexing == VK_TRUE &&
+        supportedFeatures.shaderStorageBufferArrayDynamicIndexing == VK_TRUE;
+
+    VkPhysicalDeviceVulkan12Features vulkan12Features{};
+    vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    bool hasVulkan12 = m_deviceFeatures.apiVersion >= VK_API_VERSION_1_2;
+    if (hasVulkan12) {
+        VkPhysicalDeviceVulkan12Features supported12{};
+        supported12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &supported12;
+        vkGetPhysicalDeviceFeatures2(m_physicalDevice, &features2);
+        vulkan12Features.drawIndirectCount = supported12.drawIndirectCount;
+        vulkan12Features.timelineSemaphore = supported12.timelineSemaphore;
+        m_deviceFeatures.drawIndirectCount = supported12.drawIndirectCount == VK_TRUE;
+        m_deviceFeatures.timelineSemaphore = supported12.timelineSemaphore == VK_TRUE;
+
+        // Everything the bindless table relies on, or nothing: it falls back to per-frame sets as a whole
+        m_deviceFeatures.descriptorIndexing = m_deviceFeatures.dynamicArrayIndexing &&
+            supported12.descriptorBindingPartiallyBound && supported12.descriptorBindingUpdateUnusedWhilePending &&
+            supported12.descriptorBindingSampledImageUpdateAfterBind && supported12.descriptorBindingStorageBufferUpdateAfterBind;
+        if (m_deviceFeatures.descriptorIndexing) {
+            vulkan12Features.descriptorBindingPartiallyBound = VK_TRUE;
+            vulkan12Features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+            vulkan12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            vulkan12Features.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+        }
+    }
+    Log::GetCoreLogger()->info("Device features: Vulkan {0}.{1}, multiDrawIndirect {2}, drawIndirectFirstInstance {3}, drawIndirectCount {4}, timelineSemaphore {5}, textureCompressionBC {6}, dynamicArrayIndexing {7}, descriptorIndexing {8}",
+        VK_VERSION_MAJOR(m_deviceFeatures.apiVersion), VK_VERSION_MINOR(m_deviceFeatures.apiVersion),
+        m_deviceFeatures.multiDrawIndirect, m_deviceFeatures.drawIndirectFirstInstance, m_deviceFeatures.drawIndirectCount,
+        m_deviceFeatures.timelineSemaphore, m_deviceFeatures.textureCompressionBC, m_deviceFeatures.dynamicArrayIndexing,
+        m_deviceFeatures.descriptorIndexing);
+
+    // Uploads only move to their own queue when the device has a transfer family and the
+    // timeline semaphores that hand the data over to the graphics queue; otherwise everything
+    // runs on the graphics queue, as on single-queue devices like lavapipe
+    bool useTransferQueue = m_config.transferQueue && m_queueFamilies.HasDedicatedTransfer() && m_deviceFeatures.timelineSemaphore;
+    if (m_queueFamilies.HasDedicatedTransfer() && !useTransferQueue) {
+        Log::GetCoreLogger()->info("Not using transfer queue family {0}: {1}.", m_queueFamilies.transfer,
+            m_config.transferQueue ? "timeline semaphores are not supported" : "disabled by transfer-queue=false");
+        m_queueFamilies.transfer = m_queueFamilies.graphics;
+    }
+
+    // One queue from each distinct family in use
+    std::vector<uint32_t> families = { m_queueFamilies.graphics };
+    for (uint32_t family : { m_queueFamilies.present, m_queueFamilies.transfer }) {
+        if (family != QueueFamilies::None && std::find(families.begin(), families.end(), family) == families.end()) {
+            families.push_back(family);
+        }
+    }
     float queuePriority = 1.0f;
-    queueCreateInfo.pQueuePriorities = &queuePriority;
-    
-    VkPhysicalDeviceFeatures deviceFeatures{}; // No special features needed for now
+    std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
+    for (uint32_t family : families) {
+        VkDeviceQueueCreateInfo queueCreateInfo{};
+        queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueCreateInfo.queueFamilyIndex = family;
+        queueCreateInfo.queueCount = 1;
+        queueCreateInfo.pQueuePriorities = &queuePriority;
+        queueCreateInfos.push_back(queueCreateInfo);
+    }
     
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-    createInfo.pQueueCreateInfos = &queueCreateInfo;
-    createInfo.queueCreateInfoCount = 1;
+    createInfo.pNext = hasVulkan12 ? &vulkan12Features : nullptr;
+    createInfo.pQueueCreateInfos = queueCreateInfos.data();
+    createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
     createInfo.pEnabledFeatures = &deviceFeatures;
     
-    // Enable the swapchain extension
-    const std::vector<const char*> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    // Enable the swapchain extension (not needed, and possibly unsupported, when headless)
+    std::vector<const char*> deviceExtensions;
+    if (!m_config.headless) {
+        deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
     createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
     createInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
@@ -372,30 +780,57 @@ void Application::createLogicalDevice() {
     }
     
     // Get handles to the device queues
-    vkGetDeviceQueue(m_device, queueFamilyIndex, 0, &m_graphicsQueue);
-    vkGetDeviceQueue(m_device, queueFamilyIndex, 0, &m_presentQueue);
+    vkGetDeviceQueue(m_device, m_queueFamilies.graphics, 0, &m_graphicsQueue);
+    if (m_queueFamilies.present != QueueFamilies::None) {
+        vkGetDeviceQueue(m_device, m_queueFamilies.present, 0, &m_presentQueue);
+    }
+    if (m_queueFamilies.HasDedicatedTransfer()) {
+        vkGetDeviceQueue(m_device, m_queueFamilies.transfer, 0, &m_transferQueue);
+    }
     Log::GetCoreLogger()->info("Logical device and queues created.");
 }
 
+void Application::createPipelineCache() {
+    m_pipelineCache = std::make_unique<PipelineCache>(m_device, m_physicalDevice, m_config.pipelineCachePath);
+}
+
 void Application::createSwapChain() {
     m_swapChainImageFormat = VK_FORMAT_B8G8R8A8_SRGB;
     m_swapChainExtent = { (uint32_t)m_width, (uint32_t)m_height };
+
+    // Keep at least one swapchain image per frame in flight so the CPU is not throttled by
+    // image acquisition before the frame fences, within the limits of the surface.
+    VkSurfaceCapabilitiesKHR capabilities;
+    vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_physicalDevice, m_surface, &capabilities);
+    uint32_t minImageCount = std::max<uint32_t>(2, m_config.framesInFlight); // At least double buffering
+    minImageCount = std::max(minImageCount, capabilities.minImageCount);
+    if (capabilities.maxImageCount > 0) {
+        minImageCount = std::min(minImageCount, capabilities.maxImageCount);
+    }
     
     VkSwapchainCreateInfoKHR createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
     createInfo.surface = m_surface;
-    createInfo.minImageCount = 2; // Double buffering
+    createInfo.minImageCount = minImageCount;
     createInfo.imageFormat = m_swapChainImageFormat;
     createInfo.imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
     createInfo.imageExtent = m_swapChainExtent;
     createInfo.imageArrayLayers = 1;
     createInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
-    createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    uint32_t sharingFamilies[] = { m_queueFamilies.graphics, m_queueFamilies.present };
+    if (m_queueFamilies.present != m_queueFamilies.graphics) {
+        // Rendered on one family and presented from another, without ownership transfers
+        createInfo.imageSharingMode = VK_SHARING_MODE_CONCURRENT;
+        createInfo.queueFamilyIndexCount = 2;
+        createInfo.pQueueFamilyIndices = sharingFamilies;
+    } else {
+        createInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    }
     createInfo.preTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
     createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
     createInfo.presentMode = VK_PRESENT_MODE_FIFO_KHR; // V-Sync
     createInfo.clipped = VK_TRUE;
-    createInfo.oldSwapchain = VK_NULL_HANDLE;
+    createInfo.oldSwapchain = m_swapChain; // Lets the driver hand resources over on recreation; null the first time
 
     if (vkCreateSwapchainKHR(m_device, &createInfo, nullptr, &m_swapChain) != VK_SUCCESS) {
         throw std::runtime_error("failed to create swap chain!");
@@ -488,7 +923,7 @@ void Application::createCommandPool() {
     VkCommandPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
     poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    poolInfo.queueFamilyIndex = 0; // Assuming queue family 0
+    poolInfo.queueFamilyIndex = m_queueFamilies.graphics;
 
     if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool) != VK_SUCCESS) {
         throw std::runtime_error("failed to create command pool!");
@@ -497,7 +932,7 @@ void Application::createCommandPool() {
 }
 
 void Application::createCommandBuffers() {
-    m_commandBuffers.resize(2); // For double buffering
+    m_commandBuffers.resize(m_config.framesInFlight); // One per frame in flight
     VkCommandBufferAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     allocInfo.commandPool = m_commandPool;
@@ -511,9 +946,9 @@ void Application::createCommandBuffers() {
 }
 
 void Application::createSyncObjects() {
-    m_imageAvailableSemaphores.resize(2);
-    m_renderFinishedSemaphores.resize(2);
-    m_inFlightFences.resize(2);
+    m_imageAvailableSemaphores.resize(m_config.framesInFlight);
+    m_renderFinishedSemaphores.resize(m_config.framesInFlight);
+    m_inFlightFences.resize(m_config.framesInFlight);
 
     VkSemaphoreCreateInfo semaphoreInfo{};
     semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -521,7 +956,7 @@ void Application::createSyncObjects() {
     fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
     fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT; // Start signaled to not block on the first frame
 
-    for (size_t i = 0; i < 2; i++) {
+    for (size_t i = 0; i < m_config.framesInFlight; i++) {
         if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &m_imageAvailableSemaphores[i]) != VK_SUCCESS ||
             vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &m_renderFinishedSemaphores[i]) != VK_SUCCESS ||
             vkCreateFence(m_device, &fenceInfo, nullptr, &m_inFlightFences[i]) != VK_SUCCESS) {
@@ -537,6 +972,8 @@ void Application::createSyncObjects() {
 
 void Application::drawFrame()
 {
+    ENGINE_PROFILE_FUNCTION();
+
     // --- 1. Calculate Delta Time ---
     float currentTime = (float)glfwGetTime();
     float deltaTime = currentTime - m_lastFrameTime;
@@ -546,24 +983,39 @@ void Application::drawFrame()
     processCameraKeyboardInput(deltaTime);
     
     // --- 3. Update Scene Data ---
+    updateMeshes();
+    updateTextures();
+    updateSceneExtent(deltaTime);
     m_renderer->SetViewProjection(m_camera->GetViewMatrix(), m_camera->GetProjectionMatrix());
     
-    // --- 4. Render 3D Scene to Offscreen Texture ---
-    m_renderer->Render(m_currentFrame);
-
-    // --- 5. Render UI to Main Window ---
-    vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
-    
+    // --- 4. Wait for this frame slot and acquire a swapchain image ---
     uint32_t imageIndex;
-    VkResult result = vkAcquireNextImageKHR(m_device, m_swapChain, UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &imageIndex);
+    VkResult result;
+    {
+        ENGINE_PROFILE_SCOPE("Application::waitForFrame");
+        vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+        result = vkAcquireNextImageKHR(m_device, m_swapChain, UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &imageIndex);
+    }
 
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || m_framebufferResized) {
+    // Only an out-of-date swapchain skips the frame; a resize is handled after presenting,
+    // so the image just acquired and its semaphore are not left behind with the old swapchain
+    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
         m_framebufferResized = false;
         recreateSwapChain();
         return; // Skip the rest of the frame
     }
 
     vkResetFences(m_device, 1, &m_inFlightFences[m_currentFrame]);
+    m_gpuProfiler->BeginFrame(m_currentFrame); // Resolves this slot's timings from its previous use
+    m_descriptorAllocator->BeginFrame(m_currentFrame); // Resets the transient sets this slot's last frame used
+    m_deletionQueue->BeginFrame(); // Destroys what the completed frames retired
+
+    // --- 5. Record 3D Scene to Offscreen Texture ---
+    // The scene command buffer is submitted together with the UI command buffer below,
+    // so the CPU never has to wait for the scene pass on its own.
+    VkCommandBuffer sceneCommandBuffer = m_renderer->Render(m_currentFrame);
+
+    // --- 6. Render UI to Main Window ---
     vkResetCommandBuffer(m_commandBuffers[m_currentFrame], 0);
 
     // --- Begin Command Buffer Recording ---
@@ -572,6 +1024,7 @@ void Application::drawFrame()
     if (vkBeginCommandBuffer(m_commandBuffers[m_currentFrame], &beginInfo) != VK_SUCCESS) {
         throw std::runtime_error("failed to begin recording command buffer!");
     }
+    m_gpuProfiler->BeginScope(m_commandBuffers[m_currentFrame], "ImGui");
 
     // --- Begin Main Render Pass (for UI) ---
     VkRenderPassBeginInfo renderPassInfo{};
@@ -609,8 +1062,11 @@ void Application::drawFrame()
         ImGui::End();
         
         // Render all UI panels
-        for (const auto& panel : m_UIPanels) {
-            panel->OnImGuiRender();
+        {
+            ENGINE_PROFILE_SCOPE("Application::renderPanels");
+            for (const auto& panel : m_UIPanels) {
+                panel->OnImGuiRender();
+            }
         }
 
         // Finalize ImGui rendering
@@ -618,6 +1074,7 @@ void Application::drawFrame()
         ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), m_commandBuffers[m_currentFrame]);
 
     vkCmdEndRenderPass(m_commandBuffers[m_currentFrame]);
+    m_gpuProfiler->EndScope(m_commandBuffers[m_currentFrame]);
 
     if (vkEndCommandBuffer(m_commandBuffers[m_currentFrame]) != VK_SUCCESS) {
         throw std::runtime_error("failed to record command buffer!");
@@ -631,11 +1088,24 @@ void Application::drawFrame()
     submitInfo.waitSemaphoreCount = 1;
     submitInfo.pWaitSemaphores = waitSemaphores;
     submitInfo.pWaitDstStageMask = waitStages;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &m_commandBuffers[m_currentFrame];
-    VkSemaphore signalSemaphores[] = {m_renderFinishedSemaphores[m_currentFrame]};
+    // Command buffers in a batch start in submission order; the scene render pass's outgoing
+    // dependency makes its output visible to the UI pass that samples it.
+    VkCommandBuffer commandBuffers[] = {sceneCommandBuffer, m_commandBuffers[m_currentFrame]};
+    submitInfo.commandBufferCount = 2;
+    submitInfo.pCommandBuffers = commandBuffers;
+    // The deletion queue's timeline, if any, is signaled with the frame number; the binary semaphore ignores its value
+    VkSemaphore signalSemaphores[] = {m_renderFinishedSemaphores[m_currentFrame], m_deletionQueue->GetTimelineSemaphore()};
+    uint64_t signalValues[] = {0, m_deletionQueue->GetFrame()};
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.signalSemaphoreValueCount = 2;
+    timelineInfo.pSignalSemaphoreValues = signalValues;
     submitInfo.signalSemaphoreCount = 1;
     submitInfo.pSignalSemaphores = signalSemaphores;
+    if (signalSemaphores[1] != VK_NULL_HANDLE) {
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.signalSemaphoreCount = 2;
+    }
 
     if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_inFlightFences[m_currentFrame]) != VK_SUCCESS) {
         throw std::runtime_error("failed to submit draw command buffer!");
@@ -649,13 +1119,24 @@ void Application::drawFrame()
     presentInfo.swapchainCount = 1;
     presentInfo.pSwapchains = swapChains;
     presentInfo.pImageIndices = &imageIndex;
-    vkQueuePresentKHR(m_presentQueue, &presentInfo);
+    VkResult presentResult;
+    {
+        ENGINE_PROFILE_SCOPE("Application::present");
+        presentResult = vkQueuePresentKHR(m_presentQueue, &presentInfo);
+    }
     
-    m_currentFrame = (m_currentFrame + 1) % 2; // Switch to the next frame in flight
+    m_currentFrame = (m_currentFrame + 1) % m_config.framesInFlight; // Switch to the next frame in flight
+
+    if (presentResult == VK_ERROR_OUT_OF_DATE_KHR || presentResult == VK_SUBOPTIMAL_KHR || m_framebufferResized) {
+        m_framebufferResized = false;
+        recreateSwapChain();
+    }
 }
 
 void Application::recreateSwapChain()
 {
+    ENGINE_PROFILE_FUNCTION();
+
     // Handle window minimization
     int width = 0, height = 0;
     glfwGetFramebufferSize(m_window, &width, &height);
@@ -664,18 +1145,23 @@ void Application::recreateSwapChain()
         glfwWaitEvents();
     }
 
-    vkDeviceWaitIdle(m_device);
-    
-    cleanupSwapChain();
-    
-    // Recreate everything that depends on the swapchain
+    // Frames in flight may still render to and present the old images, so everything is retired instead of
+    // destroyed; the swapchain goes last, after the views and framebuffers queued before it
+    for (VkFramebuffer& framebuffer : m_swapChainFramebuffers) {
+        m_deletionQueue->DestroyFramebuffer(framebuffer);
+    }
+    m_swapChainFramebuffers.clear();
+    for (VkImageView& imageView : m_swapChainImageViews) {
+        m_deletionQueue->DestroyImageView(imageView);
+    }
+    m_swapChainImageViews.clear();
+    VkSwapchainKHR oldSwapChain = m_swapChain;
+
+    // Recreate everything that depends on the swapchain; the UI command buffers are not tied to it
     createSwapChain();
     createImageViews();
     createFramebuffers();
-    createCommandBuffers();
-
-    // Notify the renderer of the new size
-    m_renderer->OnResize(m_swapChainExtent);
+    m_deletionQueue->Defer([device = m_device, oldSwapChain]() { vkDestroySwapchainKHR(device, oldSwapChain, nullptr); });
 }
 
 void Application::cleanupSwapChain()
@@ -685,8 +1171,10 @@ void Application::cleanupSwapChain()
     }
     m_swapChainFramebuffers.clear();
 
-    vkFreeCommandBuffers(m_device, m_commandPool, static_cast<uint32_t>(m_commandBuffers.size()), m_commandBuffers.data());
-    m_commandBuffers.clear();
+    if (!m_commandBuffers.empty()) {
+        vkFreeCommandBuffers(m_device, m_commandPool, static_cast<uint32_t>(m_commandBuffers.size()), m_commandBuffers.data());
+        m_commandBuffers.clear();
+    }
 
     for (auto imageView : m_swapChainImageViews) {
         vkDestroyImageView(m_device, imageView, nullptr);
@@ -723,6 +1211,13 @@ bool Application::OnMouseButtonPressed(MouseButtonPressedEvent& e)
         m_lastMousePosition = {(float)x, (float)y};
         return true; // Event handled
     }
+
+    // Pick the instance under the cursor when left-clicking inside the viewport
+    if (m_viewportPanel && m_viewportPanel->IsHovered() && e.GetMouseButton() == GLFW_MOUSE_BUTTON_LEFT)
+    {
+        pickInstance(m_viewportPanel->GetMouseImagePosition());
+        return true; // Event handled
+    }
     return false;
 }
 
@@ -799,3 +1294,109 @@ void Application::processCameraKeyboardInput(float deltaTime)
             m_camera->ProcessKeyboard(CameraMovement::DOWN, deltaTime);
     }
 }
+
+void Application::pickInstance(const glm::vec2& imagePosition)
+{
+    if (imagePosition.x < 0.0f || imagePosition.x > 1.0f || imagePosition.y < 0.0f || imagePosition.y > 1.0f)
+        return;
+
+    // The scene image is shown flipped vertically, so the top of the viewport is NDC y = +1
+    glm::vec2 ndc(imagePosition.x * 2.0f - 1.0f, 1.0f - imagePosition.y * 2.0f);
+    glm::mat4 inverseViewProjection = glm::inverse(m_camera->GetProjectionMatrix() * m_camera->GetViewMatrix());
+    glm::vec4 nearPoint = inverseViewProjection * glm::vec4(ndc, 0.0f, 1.0f);
+    glm::vec4 farPoint = inverseViewProjection * glm::vec4(ndc, 1.0f, 1.0f);
+    glm::vec3 origin = glm::vec3(nearPoint) / nearPoint.w;
+    glm::vec3 direction = glm::vec3(farPoint) / farPoint.w - origin;
+
+    int instance = m_renderer->PickInstance(origin, direction);
+    ConsolePanel::AddLog(instance >= 0 ? "Picked instance " + std::to_string(instance) : std::string("Picked nothing"));
+}
+
+void Application::loadMesh(const std::string& path)
+{
+    if (!MeshImporter::IsSupported(path) && !MeshFile::IsMeshFile(path)) {
+        Log::GetCoreLogger()->error("Cannot load '{0}': only .obj, .glb and .emesh meshes are supported.", path);
+        ConsolePanel::AddLog("Unsupported mesh format: " + path);
+        return;
+    }
+    m_pendingMesh = m_meshLoader->LoadAsync(path);
+    ConsolePanel::AddLog("Loading mesh " + path);
+}
+
+void Application::loadTexture(const std::string& path)
+{
+    if (!TextureImporter::IsSupported(path)) {
+        Log::GetCoreLogger()->error("Cannot load '{0}': only .ktx2 and .dds textures are supported.", path);
+        ConsolePanel::AddLog("Unsupported texture format: " + path);
+        return;
+    }
+    m_sceneTexture = m_textureStreamer->LoadAsync(path);
+    ConsolePanel::AddLog("Loading texture " + path);
+}
+
+void Application::updateTextures()
+{
+    ENGINE_PROFILE_FUNCTION();
+
+    // The scene asks for full detail; the streamer's budget still decides what stays resident
+    if (m_sceneTexture != 0) {
+        m_textureStreamer->Request(m_sceneTexture, 0);
+    }
+    m_textureStreamer->Update();
+
+    // The slot moves with every residency change; until the texture is ready it is the default white one
+    MaterialConstants material = m_renderer->GetMaterial();
+    material.albedoTexture = m_textureStreamer->GetBindlessIndex(m_sceneTexture);
+    m_renderer->SetMaterial(material);
+}
+
+void Application::updateSceneExtent(float deltaTime)
+{
+    glm::vec2 size = m_viewportPanel->GetContentSize();
+    if (size.x < 1.0f || size.y < 1.0f) {
+        return; // Hidden, collapsed or not laid out yet
+    }
+
+    // The projection follows at once, so a stretched image keeps its proportions until the resize
+    m_camera->SetAspectRatio(size.x / size.y);
+
+    VkExtent2D requested = { static_cast<uint32_t>(size.x), static_cast<uint32_t>(size.y) };
+    if (requested.width != m_requestedSceneExtent.width || requested.height != m_requestedSceneExtent.height) {
+        m_requestedSceneExtent = requested;
+        m_sceneResizeTimer = 0.0f;
+        return;
+    }
+
+    VkExtent2D current = m_renderer->GetSceneExtent();
+    if (requested.width == current.width && requested.height == current.height) {
+        return;
+    }
+    m_sceneResizeTimer += deltaTime;
+    if (m_sceneResizeTimer >= SceneResizeDelay) {
+        m_renderer->OnResize(requested);
+    }
+}
+
+void Application::updateMeshes()
+{
+    ENGINE_PROFILE_FUNCTION();
+    m_meshLoader->Update();
+    if (m_pendingMesh == 0) {
+        return;
+    }
+
+    MeshState state = m_meshLoader->GetState(m_pendingMesh);
+    if (state == MeshState::Ready) {
+        const GpuMesh* mesh = m_meshLoader->GetMesh(m_pendingMesh);
+        m_renderer->SetMesh(mesh);
+        if (m_renderer->GetInstanceCount() == 0) {
+            // A single object: frame it so it fills the view whatever its size
+            m_camera->Focus(glm::vec3(mesh->boundingSphere), std::max(mesh->boundingSphere.w * 2.5f, 0.1f));
+        }
+        ConsolePanel::AddLog("Loaded mesh " + mesh->name);
+        m_pendingMesh = 0;
+    } else if (state == MeshState::Failed) {
+        ConsolePanel::AddLog("Failed to load mesh: " + m_meshLoader->GetError(m_pendingMesh));
+        m_pendingMesh = 0;
+    }
+}
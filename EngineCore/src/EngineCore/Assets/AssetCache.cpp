@@ -0,0 +1,186 @@
+#include "EngineCore/Assets/AssetCache.hpp"
+#include "EngineCore/Hash.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/MappedFile.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+
+namespace
+{
+    constexpr const char* TempExtension = ".tmp";
+
+    // Gives every Store() its own temporary file, so parallel cooks never share one
+    std::atomic<uint64_t> s_tempCounter{ 0 };
+}
+
+// =================================================================================
+// Constructor
+// =================================================================================
+
+AssetCache::AssetCache(std::string directory)
+    : m_directory(std::move(directory))
+{
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error) {
+        throw std::runtime_error("failed to create asset cache directory '" + m_directory + "': " + error.message() + "!");
+    }
+    scan();
+    Log::GetCoreLogger()->info("Asset cache '{0}' opened ({1} entries, {2:.1f} MiB).", m_directory, m_entryCount,
+        static_cast<double>(m_diskBytes) / (1024.0 * 1024.0));
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+uint64_t AssetCache::MakeKey(const std::string& sourcePath, const std::string& settings)
+{
+    ENGINE_PROFILE_FUNCTION();
+    auto start = std::chrono::steady_clock::now();
+    MappedFile source(sourcePath);
+    uint64_t key = HashBytes(source.GetData(), source.GetSize(), HashString(settings));
+
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    m_hashedBytes += source.GetSize();
+    m_hashMicroseconds += static_cast<uint64_t>(microseconds);
+    return key;
+}
+
+bool AssetCache::Find(uint64_t key, const std::string& extension, std::string& cookedPath)
+{
+    std::string path = getPath(key, extension);
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        m_misses++;
+        return false;
+    }
+    m_hits++;
+    cookedPath = std::move(path);
+    return true;
+}
+
+bool AssetCache::Store(uint64_t key, const std::string& extension, const std::function<void(const std::string&)>& write)
+{
+    ENGINE_PROFILE_FUNCTION();
+    const std::string path = getPath(key, extension);
+    const std::string tempPath = path + "." + std::to_string(s_tempCounter++) + TempExtension;
+    std::error_code error;
+    try {
+        write(tempPath);
+    }
+    catch (const std::exception& e) {
+        Log::GetCoreLogger()->error("Failed to store '{0}' in the asset cache: {1}", path, e.what());
+        std::filesystem::remove(tempPath, error);
+        m_failures++;
+        return false;
+    }
+
+    const uint64_t size = std::filesystem::file_size(tempPath, error);
+    if (error) {
+        Log::GetCoreLogger()->error("Failed to store '{0}' in the asset cache: {1}", path, error.message());
+        std::filesystem::remove(tempPath, error);
+        m_failures++;
+        return false;
+    }
+
+    // Another worker may have cooked the same source meanwhile; the results are identical, so the last rename wins
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const bool replaced = std::filesystem::is_regular_file(path, error);
+    const uint64_t replacedSize = replaced ? std::filesystem::file_size(path, error) : 0;
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        Log::GetCoreLogger()->error("Failed to store '{0}' in the asset cache: {1}", path, error.message());
+        std::filesystem::remove(tempPath, error);
+        m_failures++;
+        return false;
+    }
+    m_entryCount += replaced ? 0 : 1;
+    m_diskBytes += size - replacedSize;
+    m_writtenBytes += size;
+    return true;
+}
+
+void AssetCache::Invalidate(uint64_t key, const std::string& extension)
+{
+    const std::string path = getPath(key, extension);
+    m_failures++;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::error_code error;
+    const uint64_t size = std::filesystem::file_size(path, error);
+    if (!error && std::filesystem::remove(path, error)) {
+        m_entryCount--;
+        m_diskBytes -= size;
+    }
+}
+
+void AssetCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::error_code error;
+    m_entryCount = 0;
+    m_diskBytes = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(m_directory, error)) {
+        // Temporary files belong to cooks still running; they are renamed into place or removed by Store()
+        if (!entry.is_regular_file(error) || entry.path().extension() == TempExtension) {
+            continue;
+        }
+        // Files still mapped by a loaded mesh cannot be removed on every OS; they stay counted
+        const uint64_t size = entry.file_size(error);
+        if (!std::filesystem::remove(entry.path(), error)) {
+            m_entryCount++;
+            m_diskBytes += size;
+        }
+    }
+    Log::GetCoreLogger()->info("Asset cache '{0}' cleared.", m_directory);
+}
+
+AssetCacheStats AssetCache::GetStats() const
+{
+    AssetCacheStats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.failures = m_failures;
+    stats.hashedBytes = m_hashedBytes;
+    stats.writtenBytes = m_writtenBytes;
+    stats.hashMilliseconds = static_cast<double>(m_hashMicroseconds) / 1000.0;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    stats.entryCount = m_entryCount;
+    stats.diskBytes = m_diskBytes;
+    return stats;
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+std::string AssetCache::getPath(uint64_t key, const std::string& extension) const
+{
+    char name[17];
+    snprintf(name, sizeof(name), "%016" PRIx64, key);
+    return (std::filesystem::path(m_directory) / (name + extension)).string();
+}
+
+void AssetCache::scan()
+{
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(m_directory, error)) {
+        if (!entry.is_regular_file(error)) {
+            continue;
+        }
+        if (entry.path().extension() == TempExtension) {
+            // Left behind by a run that stopped mid-cook
+            std::filesystem::remove(entry.path(), error);
+            continue;
+        }
+        m_entryCount++;
+        m_diskBytes += entry.file_size(error);
+    }
+}
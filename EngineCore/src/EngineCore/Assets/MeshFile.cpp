@@ -0,0 +1,171 @@
+#include "EngineCore/Assets/MeshFile.hpp"
+#include "EngineCore/PathUtils.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(sizeof(MeshFileHeader) == 112, "MeshFileHeader must match the on-disk layout");
+static_assert(std::is_trivially_copyable<Vertex>::value && std::is_trivially_copyable<MeshLod>::value,
+    "the mesh streams are copied as raw bytes");
+static_assert(sizeof(MeshLod) == 12, "MeshLod must match the on-disk layout");
+
+namespace
+{
+    uint64_t alignSection(uint64_t offset)
+    {
+        return (offset + MeshFile::SectionAlignment - 1) & ~(MeshFile::SectionAlignment - 1);
+    }
+
+    // Checks that a section lies inside the file and starts on a section boundary.
+    bool isSectionValid(uint64_t offset, uint64_t size, uint64_t fileSize)
+    {
+        return offset % MeshFile::SectionAlignment == 0 && offset <= fileSize && size <= fileSize - offset;
+    }
+}
+
+// =================================================================================
+// Static Methods
+// =================================================================================
+
+bool MeshFile::IsMeshFile(const std::string& path)
+{
+    return GetPathExtension(path) == ".emesh";
+}
+
+void MeshFile::Write(const std::string& path, const MeshData& mesh)
+{
+    ENGINE_PROFILE_FUNCTION();
+    MeshFileHeader header{};
+    header.magic = Magic;
+    header.version = Version;
+    header.vertexStride = sizeof(Vertex);
+    header.indexSize = sizeof(uint32_t);
+    header.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    header.indexCount = static_cast<uint32_t>(mesh.indices.size());
+    header.lodCount = static_cast<uint32_t>(mesh.lods.size());
+    header.nameLength = static_cast<uint32_t>(mesh.name.size());
+    for (int axis = 0; axis < 3; axis++) {
+        header.boundsMin[axis] = mesh.bounds.min[axis];
+        header.boundsMax[axis] = mesh.bounds.max[axis];
+    }
+    for (int i = 0; i < 4; i++) {
+        header.boundingSphere[i] = mesh.boundingSphere[i];
+    }
+    header.lodOffset = alignSection(sizeof(MeshFileHeader));
+    header.vertexOffset = alignSection(header.lodOffset + sizeof(MeshLod) * mesh.lods.size());
+    header.indexOffset = alignSection(header.vertexOffset + sizeof(Vertex) * mesh.vertices.size());
+    header.nameOffset = alignSection(header.indexOffset + sizeof(uint32_t) * mesh.indices.size());
+    header.fileSize = header.nameOffset + mesh.name.size();
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("failed to create mesh file '" + path + "'!");
+    }
+
+    // Sections are written in order, zero-padded up to the next one
+    uint64_t written = 0;
+    auto writeSection = [&](uint64_t offset, const void* data, size_t size) {
+        static const char padding[SectionAlignment] = {};
+        file.write(padding, static_cast<std::streamsize>(offset - written));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        written = offset + size;
+    };
+    writeSection(0, &header, sizeof(header));
+    writeSection(header.lodOffset, mesh.lods.data(), sizeof(MeshLod) * mesh.lods.size());
+    writeSection(header.vertexOffset, mesh.vertices.data(), sizeof(Vertex) * mesh.vertices.size());
+    writeSection(header.indexOffset, mesh.indices.data(), sizeof(uint32_t) * mesh.indices.size());
+    writeSection(header.nameOffset, mesh.name.data(), mesh.name.size());
+    if (!file.good()) {
+        throw std::runtime_error("failed to write mesh file '" + path + "'!");
+    }
+}
+
+// =================================================================================
+// Constructor
+// =================================================================================
+
+MeshFile::MeshFile(const std::string& path)
+    : m_file(path)
+{
+    const uint64_t fileSize = m_file.GetSize();
+    if (fileSize < sizeof(MeshFileHeader)) {
+        throw std::runtime_error("failed to load '" + path + "': the file is too small for a mesh header!");
+    }
+    m_header = reinterpret_cast<const MeshFileHeader*>(m_file.GetData());
+    const MeshFileHeader& header = *m_header;
+    if (header.magic != Magic) {
+        throw std::runtime_error("failed to load '" + path + "': not a binary mesh file!");
+    }
+    if (header.version != Version) {
+        throw std::runtime_error("failed to load '" + path + "': mesh file version " + std::to_string(header.version) +
+            " is not supported (expected " + std::to_string(Version) + "), convert it again!");
+    }
+    if (header.vertexStride != sizeof(Vertex) || header.indexSize != sizeof(uint32_t)) {
+        throw std::runtime_error("failed to load '" + path + "': the vertex or index layout does not match the engine's!");
+    }
+
+    // The table and section bounds are checked here, the index values below; vertex data is used as is
+    if (header.fileSize != fileSize ||
+        !isSectionValid(header.lodOffset, sizeof(MeshLod) * uint64_t(header.lodCount), fileSize) ||
+        !isSectionValid(header.vertexOffset, sizeof(Vertex) * uint64_t(header.vertexCount), fileSize) ||
+        !isSectionValid(header.indexOffset, sizeof(uint32_t) * uint64_t(header.indexCount), fileSize) ||
+        header.nameOffset > fileSize || header.nameLength > fileSize - header.nameOffset) {
+        throw std::runtime_error("failed to load '" + path + "': the file is truncated or its sections are out of bounds!");
+    }
+    if (header.indexCount == 0 || header.vertexCount == 0 || header.lodCount == 0) {
+        throw std::runtime_error("failed to load '" + path + "': the mesh has no triangles!");
+    }
+    for (uint32_t i = 0; i < header.lodCount; i++) {
+        const MeshLod& lod = GetLods()[i];
+        if (lod.indexCount == 0 || lod.firstIndex > header.indexCount || lod.indexCount > header.indexCount - lod.firstIndex) {
+            throw std::runtime_error("failed to load '" + path + "': LOD " + std::to_string(i) + " is outside the index stream!");
+        }
+    }
+
+    // Files come from disk and the asset cache, and the importers and the GPU both index the vertex
+    // stream with these; a single pass over the mapping costs about as much as copying it
+    const uint32_t* indices = GetIndices();
+    uint32_t maxIndex = 0;
+    for (uint32_t i = 0; i < header.indexCount; i++) {
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+    if (maxIndex >= header.vertexCount) {
+        throw std::runtime_error("failed to load '" + path + "': index " + std::to_string(maxIndex) +
+            " is out of bounds of the " + std::to_string(header.vertexCount) + " vertices!");
+    }
+
+    m_name.assign(reinterpret_cast<const char*>(m_file.GetData() + header.nameOffset), header.nameLength);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+Aabb MeshFile::GetBounds() const
+{
+    Aabb bounds;
+    bounds.min = glm::vec3(m_header->boundsMin[0], m_header->boundsMin[1], m_header->boundsMin[2]);
+    bounds.max = glm::vec3(m_header->boundsMax[0], m_header->boundsMax[1], m_header->boundsMax[2]);
+    return bounds;
+}
+
+glm::vec4 MeshFile::GetBoundingSphere() const
+{
+    const float* sphere = m_header->boundingSphere;
+    return glm::vec4(sphere[0], sphere[1], sphere[2], sphere[3]);
+}
+
+MeshData MeshFile::ToMeshData() const
+{
+    MeshData mesh;
+    mesh.name = m_name;
+    mesh.vertices.assign(GetVertices(), GetVertices() + GetVertexCount());
+    mesh.indices.assign(GetIndices(), GetIndices() + GetIndexCount());
+    mesh.lods.assign(GetLods(), GetLods() + GetLodCount());
+    mesh.bounds = GetBounds();
+    mesh.boundingSphere = GetBoundingSphere();
+    return mesh;
+}
@@ -0,0 +1,837 @@
+#include "EngineCore/Assets/MeshImporter.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/PathUtils.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+    // Reads a whole file into memory.
+    std::string readFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open mesh file '" + path + "'!");
+        }
+        std::string contents(static_cast<size_t>(file.tellg()), '\0');
+        file.seekg(0);
+        file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+        return contents;
+    }
+
+    // Computes area-weighted vertex normals of an indexed triangle list.
+    std::vector<glm::vec3> computeNormals(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices)
+    {
+        std::vector<glm::vec3> normals(positions.size(), glm::vec3(0.0f));
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            const glm::vec3& a = positions[indices[i]];
+            glm::vec3 faceNormal = glm::cross(positions[indices[i + 1]] - a, positions[indices[i + 2]] - a);
+            normals[indices[i]] += faceNormal;
+            normals[indices[i + 1]] += faceNormal;
+            normals[indices[i + 2]] += faceNormal;
+        }
+        for (glm::vec3& normal : normals) {
+            float length = glm::length(normal);
+            normal = length > 0.0f ? normal / length : glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+        return normals;
+    }
+
+    // Maps a unit normal to a color, like BenchmarkScene's sphere.
+    glm::vec3 colorFromNormal(const glm::vec3& normal)
+    {
+        return normal * 0.5f + 0.5f;
+    }
+
+    // =================================================================================
+    // Wavefront OBJ
+    // =================================================================================
+
+    // Skips spaces and tabs.
+    const char* skipBlanks(const char* p, const char* end)
+    {
+        while (p < end && (*p == ' ' || *p == '\t')) {
+            p++;
+        }
+        return p;
+    }
+
+    // Parses up to `count` floats; returns how many were read.
+    int parseFloats(const char*& p, const char* end, float* out, int count)
+    {
+        int parsed = 0;
+        while (parsed < count) {
+            p = skipBlanks(p, end);
+            char* next = nullptr;
+            float value = std::strtof(p, &next);
+            if (next == p || next > end) {
+                break;
+            }
+            out[parsed++] = value;
+            p = next;
+        }
+        return parsed;
+    }
+
+    // Resolves a 1-based (or negative, relative) OBJ index to a 0-based one; returns -1 if out of range.
+    int64_t resolveObjIndex(long index, size_t count)
+    {
+        int64_t resolved = index > 0 ? index - 1 : static_cast<int64_t>(count) + index;
+        return resolved >= 0 && resolved < static_cast<int64_t>(count) ? resolved : -1;
+    }
+
+    MeshData loadObj(const std::string& path)
+    {
+        std::string text = readFile(path);
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec3> colors;
+        std::vector<glm::vec3> normals;
+        bool hasColors = false;
+
+        // Each corner is a (position, normal) pair; normal -1 if the face has none
+        std::vector<std::pair<uint32_t, int32_t>> corners;
+        std::vector<std::pair<uint32_t, int32_t>> polygon;
+
+        const char* p = text.data();
+        const char* end = p + text.size();
+        size_t lineNumber = 0;
+        while (p < end) {
+            lineNumber++;
+            const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            if (!lineEnd) {
+                lineEnd = end;
+            }
+            p = skipBlanks(p, lineEnd);
+
+            if (lineEnd - p > 2 && p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
+                // "v x y z [r g b]"
+                p += 2;
+                float values[6];
+                int count = parseFloats(p, lineEnd, values, 6);
+                if (count < 3) {
+                    throw std::runtime_error("failed to load '" + path + "': bad vertex on line " + std::to_string(lineNumber) + "!");
+                }
+                positions.emplace_back(values[0], values[1], values[2]);
+                hasColors |= count == 6;
+                colors.push_back(count == 6 ? glm::vec3(values[3], values[4], values[5]) : glm::vec3(1.0f));
+            } else if (lineEnd - p > 3 && p[0] == 'v' && p[1] == 'n' && (p[2] == ' ' || p[2] == '\t')) {
+                p += 3;
+                float values[3];
+                if (parseFloats(p, lineEnd, values, 3) != 3) {
+                    throw std::runtime_error("failed to load '" + path + "': bad normal on line " + std::to_string(lineNumber) + "!");
+                }
+                normals.emplace_back(values[0], values[1], values[2]);
+            } else if (lineEnd - p > 2 && p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+                // "f v", "f v/vt", "f v//vn" or "f v/vt/vn" per corner, any number of corners
+                p += 2;
+                polygon.clear();
+                while (true) {
+                    p = skipBlanks(p, lineEnd);
+                    if (p >= lineEnd || *p == '\r' || *p == '#') {
+                        break;
+                    }
+                    char* next = nullptr;
+                    long position = std::strtol(p, &next, 10);
+                    int64_t positionIndex = next != p ? resolveObjIndex(position, positions.size()) : -1;
+                    int64_t normalIndex = -1;
+                    p = next;
+                    if (p < lineEnd && *p == '/') {
+                        p++;
+                        if (p < lineEnd && *p != '/') {
+                            std::strtol(p, &next, 10); // Texture coordinates are not used
+                            p = next;
+                        }
+                        if (p < lineEnd && *p == '/') {
+                            p++;
+                            long normal = std::strtol(p, &next, 10);
+                            normalIndex = next != p ? resolveObjIndex(normal, normals.size()) : -1;
+                            p = next;
+                        }
+                    }
+                    if (positionIndex < 0) {
+                        throw std::runtime_error("failed to load '" + path + "': bad face index on line " + std::to_string(lineNumber) + "!");
+                    }
+                    polygon.emplace_back(static_cast<uint32_t>(positionIndex), static_cast<int32_t>(normalIndex));
+                    while (p < lineEnd && !std::isspace(static_cast<unsigned char>(*p))) {
+                        p++;
+                    }
+                }
+                for (size_t i = 2; i < polygon.size(); i++) {
+                    corners.push_back(polygon[0]);
+                    corners.push_back(polygon[i - 1]);
+                    corners.push_back(polygon[i]);
+                }
+            }
+            p = lineEnd + 1;
+        }
+
+        // Faces without normals get smooth normals from the positions they share
+        std::vector<glm::vec3> positionNormals;
+        bool needsNormals = !hasColors && std::any_of(corners.begin(), corners.end(), [](const auto& corner) { return corner.second < 0; });
+        if (needsNormals) {
+            std::vector<uint32_t> positionIndices(corners.size());
+            for (size_t i = 0; i < corners.size(); i++) {
+                positionIndices[i] = corners[i].first;
+            }
+            positionNormals = computeNormals(positions, positionIndices);
+        }
+
+        // One vertex per distinct (position, normal) pair
+        MeshData mesh;
+        mesh.name = GetPathStem(path);
+        mesh.indices.reserve(corners.size());
+        std::unordered_map<uint64_t, uint32_t> vertexIds;
+        vertexIds.reserve(corners.size() / 2);
+        for (const auto& [position, normal] : corners) {
+            uint64_t key = (static_cast<uint64_t>(position) << 32) | static_cast<uint32_t>(normal + 1);
+            auto [it, inserted] = vertexIds.try_emplace(key, static_cast<uint32_t>(mesh.vertices.size()));
+            if (inserted) {
+                glm::vec3 color = hasColors ? colors[position]
+                    : colorFromNormal(normal >= 0 ? glm::normalize(normals[normal]) : positionNormals[position]);
+                mesh.vertices.push_back({ positions[position], color });
+            }
+            mesh.indices.push_back(it->second);
+        }
+
+        // OBJ faces are counter-clockwise; the engine draws clockwise front faces
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+            std::swap(mesh.indices[i + 1], mesh.indices[i + 2]);
+        }
+        return mesh;
+    }
+
+    // =================================================================================
+    // JSON (for the glTF header chunk)
+    // =================================================================================
+
+    /**
+     * @struct JsonValue
+     * @brief A parsed JSON value; objects keep their members in file order.
+     */
+    struct JsonValue
+    {
+        enum class Type { Null, Bool, Number, String, Array, Object };
+
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<JsonValue> items;
+        std::vector<std::pair<std::string, JsonValue>> members;
+
+        // Gets a member of an object, or null if absent.
+        const JsonValue* find(const char* key) const
+        {
+            for (const auto& member : members) {
+                if (member.first == key) {
+                    return &member.second;
+                }
+            }
+            return nullptr;
+        }
+
+        // Gets a numeric member, or a fallback if absent.
+        double numberOr(const char* key, double fallback) const
+        {
+            const JsonValue* value = find(key);
+            return value && value->type == Type::Number ? value->number : fallback;
+        }
+    };
+
+    /**
+     * @class JsonParser
+     * @brief A small recursive-descent JSON parser. Throws std::runtime_error on malformed input.
+     */
+    class JsonParser
+    {
+    public:
+        JsonParser(const char* begin, const char* end) : m_p(begin), m_end(end) {}
+
+        JsonValue parse()
+        {
+            JsonValue value = parseValue(0);
+            skipWhitespace();
+            if (m_p != m_end) {
+                fail();
+            }
+            return value;
+        }
+
+    private:
+        static constexpr int MaxDepth = 128;
+
+        [[noreturn]] void fail() const { throw std::runtime_error("failed to parse glTF JSON!"); }
+
+        void skipWhitespace()
+        {
+            while (m_p < m_end && (*m_p == ' ' || *m_p == '\t' || *m_p == '\n' || *m_p == '\r')) {
+                m_p++;
+            }
+        }
+
+        void expect(char c)
+        {
+            skipWhitespace();
+            if (m_p >= m_end || *m_p != c) {
+                fail();
+            }
+            m_p++;
+        }
+
+        bool consumeLiteral(const char* literal)
+        {
+            size_t length = std::strlen(literal);
+            if (static_cast<size_t>(m_end - m_p) >= length && std::memcmp(m_p, literal, length) == 0) {
+                m_p += length;
+                return true;
+            }
+            return false;
+        }
+
+        JsonValue parseValue(int depth)
+        {
+            if (depth > MaxDepth) {
+                fail();
+            }
+            skipWhitespace();
+            if (m_p >= m_end) {
+                fail();
+            }
+
+            JsonValue value;
+            if (*m_p == '{') {
+                m_p++;
+                value.type = JsonValue::Type::Object;
+                skipWhitespace();
+                if (m_p < m_end && *m_p == '}') {
+                    m_p++;
+                    return value;
+                }
+                while (true) {
+                    skipWhitespace();
+                    std::string key = parseString();
+                    expect(':');
+                    value.members.emplace_back(std::move(key), parseValue(depth + 1));
+                    skipWhitespace();
+                    if (m_p < m_end && *m_p == ',') {
+                        m_p++;
+                        continue;
+                    }
+                    expect('}');
+                    return value;
+                }
+            }
+            if (*m_p == '[') {
+                m_p++;
+                value.type = JsonValue::Type::Array;
+                skipWhitespace();
+                if (m_p < m_end && *m_p == ']') {
+                    m_p++;
+                    return value;
+                }
+                while (true) {
+                    value.items.push_back(parseValue(depth + 1));
+                    skipWhitespace();
+                    if (m_p < m_end && *m_p == ',') {
+                        m_p++;
+                        continue;
+                    }
+                    expect(']');
+                    return value;
+                }
+            }
+            if (*m_p == '"') {
+                value.type = JsonValue::Type::String;
+                value.string = parseString();
+                return value;
+            }
+            if (consumeLiteral("true")) {
+                value.type = JsonValue::Type::Bool;
+                value.boolean = true;
+                return value;
+            }
+            if (consumeLiteral("false")) {
+                value.type = JsonValue::Type::Bool;
+                return value;
+            }
+            if (consumeLiteral("null")) {
+                return value;
+            }
+
+            // The chunk is not null-terminated, so copy the number before converting it
+            const char* start = m_p;
+            while (m_p < m_end && (std::isdigit(static_cast<unsigned char>(*m_p)) || *m_p == '-' || *m_p == '+' || *m_p == '.' || *m_p == 'e' || *m_p == 'E')) {
+                m_p++;
+            }
+            std::string digits(start, m_p);
+            char* parsedEnd = nullptr;
+            value.number = std::strtod(digits.c_str(), &parsedEnd);
+            if (digits.empty() || parsedEnd != digits.c_str() + digits.size()) {
+                fail();
+            }
+            value.type = JsonValue::Type::Number;
+            return value;
+        }
+
+        std::string parseString()
+        {
+            if (m_p >= m_end || *m_p != '"') {
+                fail();
+            }
+            m_p++;
+            std::string result;
+            while (m_p < m_end && *m_p != '"') {
+                char c = *m_p++;
+                if (c != '\\') {
+                    result.push_back(c);
+                    continue;
+                }
+                if (m_p >= m_end) {
+                    fail();
+                }
+                char escaped = *m_p++;
+                switch (escaped) {
+                case 'n': result.push_back('\n'); break;
+                case 't': result.push_back('\t'); break;
+                case 'r': result.push_back('\r'); break;
+                case 'b': result.push_back('\b'); break;
+                case 'f': result.push_back('\f'); break;
+                case 'u':
+                    // Names are only used for logging, so non-ASCII code points become '?'
+                    if (m_end - m_p < 4) {
+                        fail();
+                    }
+                    m_p += 4;
+                    result.push_back('?');
+                    break;
+                default: result.push_back(escaped); break;
+                }
+            }
+            if (m_p >= m_end) {
+                fail();
+            }
+            m_p++;
+            return result;
+        }
+
+        const char* m_p;
+        const char* m_end;
+    };
+
+    // =================================================================================
+    // Binary glTF
+    // =================================================================================
+
+    constexpr uint32_t GlbMagic = 0x46546C67;     // "glTF"
+    constexpr uint32_t GlbChunkJson = 0x4E4F534A; // "JSON"
+    constexpr uint32_t GlbChunkBin = 0x004E4942;  // "BIN\0"
+
+    constexpr int ComponentByte = 5120;
+    constexpr int ComponentUnsignedByte = 5121;
+    constexpr int ComponentShort = 5122;
+    constexpr int ComponentUnsignedShort = 5123;
+    constexpr int ComponentUnsignedInt = 5125;
+    constexpr int ComponentFloat = 5126;
+
+    /**
+     * @struct AccessorView
+     * @brief A typed, strided view of an accessor's elements in the binary chunk.
+     */
+    struct AccessorView
+    {
+        const uint8_t* data = nullptr;
+        size_t count = 0;
+        size_t stride = 0;
+        int componentType = ComponentFloat;
+        int components = 1;
+        bool normalized = false;
+
+        // Reads up to 4 components of an element as floats.
+        void readFloats(size_t element, float* out) const
+        {
+            const uint8_t* p = data + element * stride;
+            for (int c = 0; c < components && c < 4; c++) {
+                switch (componentType) {
+                case ComponentFloat: { float v; std::memcpy(&v, p + c * 4, 4); out[c] = v; break; }
+                case ComponentUnsignedByte: out[c] = normalized ? p[c] / 255.0f : p[c]; break;
+                case ComponentByte: { int8_t v; std::memcpy(&v, p + c, 1); out[c] = normalized ? std::max(v / 127.0f, -1.0f) : v; break; }
+                case ComponentUnsignedShort: { uint16_t v; std::memcpy(&v, p + c * 2, 2); out[c] = normalized ? v / 65535.0f : v; break; }
+                case ComponentShort: { int16_t v; std::memcpy(&v, p + c * 2, 2); out[c] = normalized ? std::max(v / 32767.0f, -1.0f) : v; break; }
+                default: { uint32_t v; std::memcpy(&v, p + c * 4, 4); out[c] = static_cast<float>(v); break; }
+                }
+            }
+        }
+
+        // Reads an element of an index accessor.
+        uint32_t readIndex(size_t element) const
+        {
+            const uint8_t* p = data + element * stride;
+            switch (componentType) {
+            case ComponentUnsignedByte: return p[0];
+            case ComponentUnsignedShort: { uint16_t v; std::memcpy(&v, p, 2); return v; }
+            default: { uint32_t v; std::memcpy(&v, p, 4); return v; }
+            }
+        }
+    };
+
+    size_t componentSize(int componentType)
+    {
+        switch (componentType) {
+        case ComponentByte:
+        case ComponentUnsignedByte: return 1;
+        case ComponentShort:
+        case ComponentUnsignedShort: return 2;
+        case ComponentUnsignedInt:
+        case ComponentFloat: return 4;
+        default: throw std::runtime_error("failed to load glTF: unknown accessor component type!");
+        }
+    }
+
+    // Converts a JSON count, offset or stride to a size, rejecting negative, fractional and huge values.
+    size_t toSize(double value, const char* what)
+    {
+        // Integers are exact in a double up to 2^53; anything above cannot be a byte count of a loadable file
+        if (!(value >= 0.0 && value <= 9007199254740992.0) || value != std::floor(value)) {
+            throw std::runtime_error(std::string("failed to load glTF: invalid ") + what + "!");
+        }
+        return static_cast<size_t>(value);
+    }
+
+    int componentCount(const std::string& type)
+    {
+        if (type == "SCALAR") return 1;
+        if (type == "VEC2") return 2;
+        if (type == "VEC3") return 3;
+        if (type == "VEC4") return 4;
+        throw std::runtime_error("failed to load glTF: unsupported accessor type '" + type + "'!");
+    }
+
+    /**
+     * @class GlbReader
+     * @brief Bakes the triangle primitives of a .glb file's default scene into one mesh.
+     */
+    class GlbReader
+    {
+    public:
+        GlbReader(const JsonValue& json, const uint8_t* bin, size_t binSize)
+            : m_json(json), m_bin(bin), m_binSize(binSize)
+        {
+        }
+
+        void read(MeshData& mesh)
+        {
+            const JsonValue* scenes = m_json.find("scenes");
+            const JsonValue* nodes = m_json.find("nodes");
+            if (scenes && nodes && !scenes->items.empty()) {
+                size_t sceneIndex = toSize(m_json.numberOr("scene", 0.0), "scene index");
+                const JsonValue& scene = scenes->items.at(sceneIndex);
+                if (const JsonValue* roots = scene.find("nodes")) {
+                    for (const JsonValue& root : roots->items) {
+                        readNode(toSize(root.number, "node index"), glm::mat4(1.0f), mesh, 0);
+                    }
+                }
+            } else if (const JsonValue* meshes = m_json.find("meshes")) {
+                // No scene graph: take every mesh untransformed
+                for (size_t i = 0; i < meshes->items.size(); i++) {
+                    readMesh(i, glm::mat4(1.0f), mesh);
+                }
+            }
+        }
+
+    private:
+        static constexpr int MaxNodeDepth = 64;
+
+        // glTF's limits on a vertex buffer view's byteStride
+        static constexpr size_t MinByteStride = 4;
+        static constexpr size_t MaxByteStride = 252;
+
+        // Gets a top-level array that an index in the file refers to.
+        const JsonValue& topLevelArray(const char* key) const
+        {
+            const JsonValue* array = m_json.find(key);
+            if (!array) {
+                throw std::runtime_error(std::string("failed to load glTF: the '") + key + "' array is missing!");
+            }
+            return *array;
+        }
+
+        static glm::mat4 localTransform(const JsonValue& node)
+        {
+            if (const JsonValue* matrix = node.find("matrix")) {
+                glm::mat4 result(1.0f);
+                for (int i = 0; i < 16 && i < static_cast<int>(matrix->items.size()); i++) {
+                    result[i / 4][i % 4] = static_cast<float>(matrix->items[i].number); // Column-major, like glm
+                }
+                return result;
+            }
+
+            glm::vec3 translation(0.0f);
+            glm::vec4 rotation(0.0f, 0.0f, 0.0f, 1.0f); // Quaternion x, y, z, w
+            glm::vec3 scale(1.0f);
+            if (const JsonValue* t = node.find("translation")) {
+                for (int i = 0; i < 3 && i < static_cast<int>(t->items.size()); i++) translation[i] = static_cast<float>(t->items[i].number);
+            }
+            if (const JsonValue* r = node.find("rotation")) {
+                for (int i = 0; i < 4 && i < static_cast<int>(r->items.size()); i++) rotation[i] = static_cast<float>(r->items[i].number);
+            }
+            if (const JsonValue* s = node.find("scale")) {
+                for (int i = 0; i < 3 && i < static_cast<int>(s->items.size()); i++) scale[i] = static_cast<float>(s->items[i].number);
+            }
+
+            float x = rotation.x, y = rotation.y, z = rotation.z, w = rotation.w;
+            glm::mat4 result(1.0f);
+            result[0] = glm::vec4(1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w), 0.0f) * scale.x;
+            result[1] = glm::vec4(2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w), 0.0f) * scale.y;
+            result[2] = glm::vec4(2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y), 0.0f) * scale.z;
+            result[3] = glm::vec4(translation, 1.0f);
+            return result;
+        }
+
+        void readNode(size_t index, const glm::mat4& parent, MeshData& mesh, int depth)
+        {
+            if (depth > MaxNodeDepth) {
+                throw std::runtime_error("failed to load glTF: node hierarchy is too deep!");
+            }
+            const JsonValue& node = m_json.find("nodes")->items.at(index);
+            glm::mat4 world = parent * localTransform(node);
+            if (const JsonValue* meshIndex = node.find("mesh")) {
+                readMesh(toSize(meshIndex->number, "mesh index"), world, mesh);
+            }
+            if (const JsonValue* children = node.find("children")) {
+                for (const JsonValue& child : children->items) {
+                    readNode(toSize(child.number, "node index"), world, mesh, depth + 1);
+                }
+            }
+        }
+
+        AccessorView accessor(size_t index) const
+        {
+            const JsonValue& accessor = topLevelArray("accessors").items.at(index);
+            if (accessor.find("sparse")) {
+                throw std::runtime_error("failed to load glTF: sparse accessors are not supported!");
+            }
+            const JsonValue* viewIndex = accessor.find("bufferView");
+            if (!viewIndex) {
+                throw std::runtime_error("failed to load glTF: accessors without a buffer view are not supported!");
+            }
+            const JsonValue& view = topLevelArray("bufferViews").items.at(toSize(viewIndex->number, "buffer view index"));
+            if (view.numberOr("buffer", 0.0) != 0.0) {
+                throw std::runtime_error("failed to load glTF: only the embedded binary buffer is supported!");
+            }
+
+            AccessorView result;
+            result.componentType = static_cast<int>(accessor.numberOr("componentType", ComponentFloat));
+            const JsonValue* type = accessor.find("type");
+            result.components = componentCount(type ? type->string : "SCALAR");
+            result.count = toSize(accessor.numberOr("count", 0.0), "accessor count");
+            const JsonValue* normalized = accessor.find("normalized");
+            result.normalized = normalized && normalized->boolean;
+            size_t elementSize = componentSize(result.componentType) * result.components;
+            result.stride = toSize(view.numberOr("byteStride", 0.0), "byteStride");
+            if (result.stride == 0) {
+                result.stride = elementSize;
+            } else if (result.stride < MinByteStride || result.stride > MaxByteStride || result.stride < elementSize) {
+                throw std::runtime_error("failed to load glTF: byteStride " + std::to_string(result.stride) + " is out of range!");
+            }
+
+            // Each step stays within the buffer before the next one builds on it, so nothing can wrap around
+            size_t viewOffset = toSize(view.numberOr("byteOffset", 0.0), "buffer view byteOffset");
+            size_t viewLength = toSize(view.numberOr("byteLength", 0.0), "buffer view byteLength");
+            size_t accessorOffset = toSize(accessor.numberOr("byteOffset", 0.0), "accessor byteOffset");
+            if (viewOffset > m_binSize || viewLength > m_binSize - viewOffset || accessorOffset > viewLength) {
+                throw std::runtime_error("failed to load glTF: buffer view exceeds its buffer!");
+            }
+            size_t offset = viewOffset + accessorOffset;
+            size_t available = viewLength - accessorOffset;
+            if (result.count > 0 && (elementSize > available || (result.count - 1) > (available - elementSize) / result.stride)) {
+                throw std::runtime_error("failed to load glTF: accessor exceeds its buffer!");
+            }
+            result.data = m_bin + offset;
+            return result;
+        }
+
+        void readMesh(size_t index, const glm::mat4& world, MeshData& mesh)
+        {
+            const JsonValue& gltfMesh = topLevelArray("meshes").items.at(index);
+            const JsonValue* primitives = gltfMesh.find("primitives");
+            if (!primitives) {
+                return;
+            }
+
+            glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(world)));
+            // A mirroring transform turns the winding around, which cancels the flip below
+            bool flip = glm::determinant(glm::mat3(world)) >= 0.0f;
+
+            for (const JsonValue& primitive : primitives->items) {
+                if (primitive.numberOr("mode", 4.0) != 4.0) {
+                    continue; // Only triangle lists
+                }
+                const JsonValue* attributes = primitive.find("attributes");
+                const JsonValue* positionAccessor = attributes ? attributes->find("POSITION") : nullptr;
+                if (!positionAccessor) {
+                    continue;
+                }
+
+                AccessorView positions = accessor(toSize(positionAccessor->number, "accessor index"));
+                if (positions.components < 3) {
+                    throw std::runtime_error("failed to load glTF: POSITION must be a VEC3!");
+                }
+                std::vector<glm::vec3> localPositions(positions.count);
+                for (size_t i = 0; i < positions.count; i++) {
+                    float value[4] = {};
+                    positions.readFloats(i, value);
+                    localPositions[i] = glm::vec3(world * glm::vec4(value[0], value[1], value[2], 1.0f));
+                }
+
+                std::vector<uint32_t> indices;
+                if (const JsonValue* indexAccessor = primitive.find("indices")) {
+                    AccessorView indexView = accessor(toSize(indexAccessor->number, "accessor index"));
+                    indices.resize(indexView.count);
+                    for (size_t i = 0; i < indexView.count; i++) {
+                        indices[i] = indexView.readIndex(i);
+                        if (indices[i] >= positions.count) {
+                            throw std::runtime_error("failed to load glTF: index out of range!");
+                        }
+                    }
+                } else {
+                    indices.resize(positions.count);
+                    for (size_t i = 0; i < indices.size(); i++) {
+                        indices[i] = static_cast<uint32_t>(i);
+                    }
+                }
+                indices.resize(indices.size() / 3 * 3);
+
+                std::vector<glm::vec3> colors(positions.count);
+                if (const JsonValue* colorAccessor = attributes->find("COLOR_0")) {
+                    AccessorView colorView = accessor(toSize(colorAccessor->number, "accessor index"));
+                    for (size_t i = 0; i < positions.count && i < colorView.count; i++) {
+                        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                        colorView.readFloats(i, value);
+                        colors[i] = glm::vec3(value[0], value[1], value[2]);
+                    }
+                } else {
+                    std::vector<glm::vec3> normals;
+                    if (const JsonValue* normalAccessor = attributes->find("NORMAL")) {
+                        AccessorView normalView = accessor(toSize(normalAccessor->number, "accessor index"));
+                        normals.resize(positions.count, glm::vec3(0.0f, 1.0f, 0.0f));
+                        for (size_t i = 0; i < positions.count && i < normalView.count; i++) {
+                            float value[4] = {};
+                            normalView.readFloats(i, value);
+                            glm::vec3 normal = normalMatrix * glm::vec3(value[0], value[1], value[2]);
+                            float length = glm::length(normal);
+                            normals[i] = length > 0.0f ? normal / length : glm::vec3(0.0f, 1.0f, 0.0f);
+                        }
+                    } else {
+                        normals = computeNormals(localPositions, indices);
+                    }
+                    for (size_t i = 0; i < positions.count; i++) {
+                        colors[i] = colorFromNormal(normals[i]);
+                    }
+                }
+
+                uint32_t baseVertex = static_cast<uint32_t>(mesh.vertices.size());
+                for (size_t i = 0; i < positions.count; i++) {
+                    mesh.vertices.push_back({ localPositions[i], colors[i] });
+                }
+                // glTF faces are counter-clockwise; the engine draws clockwise front faces
+                for (size_t i = 0; i < indices.size(); i += 3) {
+                    mesh.indices.push_back(baseVertex + indices[i]);
+                    mesh.indices.push_back(baseVertex + indices[flip ? i + 2 : i + 1]);
+                    mesh.indices.push_back(baseVertex + indices[flip ? i + 1 : i + 2]);
+                }
+            }
+        }
+
+        const JsonValue& m_json;
+        const uint8_t* m_bin;
+        size_t m_binSize;
+    };
+
+    MeshData loadGlb(const std::string& path)
+    {
+        std::string file = readFile(path);
+        auto readU32 = [&file](size_t offset) {
+            uint32_t value = 0;
+            if (offset + 4 <= file.size()) {
+                std::memcpy(&value, file.data() + offset, 4);
+            }
+            return value;
+        };
+        if (file.size() < 20 || readU32(0) != GlbMagic || readU32(4) != 2) {
+            throw std::runtime_error("failed to load '" + path + "': not a glTF 2.0 binary file!");
+        }
+
+        // The JSON chunk comes first, optionally followed by the binary chunk
+        const char* json = nullptr;
+        size_t jsonSize = 0;
+        const uint8_t* bin = nullptr;
+        size_t binSize = 0;
+        size_t offset = 12;
+        size_t fileEnd = std::min<size_t>(readU32(8), file.size());
+        while (offset + 8 <= fileEnd) {
+            size_t chunkSize = readU32(offset);
+            uint32_t chunkType = readU32(offset + 4);
+            if (offset + 8 + chunkSize > fileEnd) {
+                throw std::runtime_error("failed to load '" + path + "': truncated chunk!");
+            }
+            if (chunkType == GlbChunkJson && !json) {
+                json = file.data() + offset + 8;
+                jsonSize = chunkSize;
+            } else if (chunkType == GlbChunkBin && !bin) {
+                bin = reinterpret_cast<const uint8_t*>(file.data()) + offset + 8;
+                binSize = chunkSize;
+            }
+            offset += 8 + (chunkSize + 3) / 4 * 4;
+        }
+        if (!json) {
+            throw std::runtime_error("failed to load '" + path + "': missing JSON chunk!");
+        }
+
+        JsonValue root = JsonParser(json, json + jsonSize).parse();
+        MeshData mesh;
+        mesh.name = GetPathStem(path);
+        GlbReader(root, bin, binSize).read(mesh);
+        return mesh;
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+bool MeshImporter::IsSupported(const std::string& path)
+{
+    std::string extension = GetPathExtension(path);
+    return extension == ".obj" || extension == ".glb";
+}
+
+MeshData MeshImporter::Load(const std::string& path)
+{
+    ENGINE_PROFILE_FUNCTION();
+    std::string extension = GetPathExtension(path);
+    MeshData mesh;
+    if (extension == ".obj") {
+        mesh = loadObj(path);
+    } else if (extension == ".glb") {
+        mesh = loadGlb(path);
+    } else {
+        throw std::runtime_error("failed to load '" + path + "': unsupported mesh format!");
+    }
+
+    if (mesh.indices.empty()) {
+        throw std::runtime_error("failed to load '" + path + "': the file contains no triangles!");
+    }
+    mesh.ComputeBounds();
+    mesh.ResetLods();
+    Log::GetCoreLogger()->info("Imported mesh '{0}': {1} vertices, {2} triangles.", mesh.name, mesh.vertices.size(), mesh.indices.size() / 3);
+    return mesh;
+}
@@ -0,0 +1,381 @@
+#include "EngineCore/Assets/MeshLoader.hpp"
+#include "EngineCore/Assets/AssetCache.hpp"
+#include "EngineCore/Assets/MeshImporter.hpp"
+#include "EngineCore/Assets/MeshOptimizer.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Vulkan/UploadQueue.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    /// Bump whenever MeshImporter or MeshSimplifier produce different output, so cached meshes are cooked again.
+    constexpr uint32_t MeshCookVersion = 2;
+
+    // Describes everything besides the source bytes that a cooked mesh depends on.
+    std::string cookSettings(bool generateLods, const LodSettings& settings, bool optimize)
+    {
+        std::string text = "mesh cook " + std::to_string(MeshCookVersion) + " emesh " + std::to_string(MeshFile::Version);
+        if (generateLods) {
+            text += " lods " + std::to_string(settings.maxLodCount) + " " + std::to_string(settings.reduction) + " " +
+                std::to_string(settings.maxError) + " " + std::to_string(settings.minReduction);
+        }
+        if (optimize) {
+            text += " optimized " + std::to_string(MeshOptimizer::CacheSize) + " " + std::to_string(MeshOptimizer::DefaultOverdrawThreshold);
+        }
+        return text;
+    }
+
+    // 0xffff is only reserved with primitive restart, which no pipeline enables
+    bool fitsUint16(uint32_t vertexCount)
+    {
+        return vertexCount <= uint32_t(std::numeric_limits<uint16_t>::max()) + 1;
+    }
+
+    VkDeviceSize getIndexSize(VkIndexType type)
+    {
+        return type == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    }
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+MeshLoader::MeshLoader(GpuAllocator& allocator, UploadQueue& uploads, ThreadPool& threadPool)
+    : m_allocator(allocator),
+      m_uploads(uploads),
+      m_threadPool(threadPool)
+{
+}
+
+MeshLoader::~MeshLoader()
+{
+    // Parse jobs only own copies of their inputs, so unfinished ones are simply abandoned
+    for (const auto& request : m_requests) {
+        m_allocator.DestroyBuffer(request->mesh.vertexBuffer, request->mesh.vertexMemory);
+        m_allocator.DestroyBuffer(request->mesh.indexBuffer, request->mesh.indexMemory);
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+MeshHandle MeshLoader::LoadAsync(const std::string& path)
+{
+    bool generateLods = m_generateLods;
+    LodSettings lodSettings = m_lodSettings;
+    VertexLayout layout = m_vertexLayout;
+    bool optimize = m_optimizeMeshes;
+    if (MeshFile::IsMeshFile(path)) {
+        std::future<ParsedMesh> mapping = m_threadPool.Submit([path, generateLods, lodSettings, layout, optimize]() {
+            ENGINE_PROFILE_SCOPE("MeshLoader::map");
+            ParsedMesh parsed;
+            parsed.file = std::make_unique<MeshFile>(path);
+            if (generateLods && parsed.file->GetLodCount() <= 1) {
+                // Converted without a chain: fall back to a copy the simplifier can work on
+                parsed.data = parsed.file->ToMeshData();
+                parsed.file.reset();
+                MeshSimplifier::GenerateLods(parsed.data, lodSettings);
+                if (optimize) {
+                    MeshOptimizer::Optimize(parsed.data);
+                }
+            } else {
+                parsed.file->Prefetch();
+            }
+            packBuffers(parsed, layout);
+            return parsed;
+        }, JobPriority::Background);
+        return addRequest(path, std::move(mapping));
+    }
+
+    AssetCache* cache = m_assetCache;
+    std::future<ParsedMesh> parsing = m_threadPool.Submit([path, generateLods, lodSettings, layout, optimize, cache]() {
+        ENGINE_PROFILE_SCOPE("MeshLoader::parse");
+        ParsedMesh parsed;
+        uint64_t key = 0;
+        if (cache) {
+            // A cooked copy of the same bytes and settings is mapped like any .emesh file
+            key = cache->MakeKey(path, cookSettings(generateLods, lodSettings, optimize));
+            std::string cookedPath;
+            if (cache->Find(key, ".emesh", cookedPath)) {
+                try {
+                    parsed.file = std::make_unique<MeshFile>(cookedPath);
+                    parsed.file->Prefetch();
+                    packBuffers(parsed, layout);
+                    return parsed;
+                }
+                catch (const std::exception& e) {
+                    Log::GetCoreLogger()->warn("Cached mesh for '{0}' is unreadable, importing it again: {1}", path, e.what());
+                    cache->Invalidate(key, ".emesh");
+                }
+            }
+        }
+
+        parsed.data = MeshImporter::Load(path);
+        if (generateLods) {
+            MeshSimplifier::GenerateLods(parsed.data, lodSettings);
+        }
+        if (optimize) {
+            MeshOptimizer::Optimize(parsed.data);
+        }
+        if (cache) {
+            cache->Store(key, ".emesh", [&parsed](const std::string& cookedPath) { MeshFile::Write(cookedPath, parsed.data); });
+        }
+        packBuffers(parsed, layout);
+        return parsed;
+    }, JobPriority::Background);
+    return addRequest(path, std::move(parsing));
+}
+
+MeshHandle MeshLoader::LoadAsync(MeshData mesh)
+{
+    std::string name = mesh.name;
+    bool generateLods = m_generateLods && mesh.lods.size() <= 1;
+    LodSettings lodSettings = m_lodSettings;
+    VertexLayout layout = m_vertexLayout;
+    bool optimize = m_optimizeMeshes;
+    std::future<ParsedMesh> parsing = m_threadPool.Submit([mesh = std::move(mesh), generateLods, lodSettings, layout, optimize]() mutable {
+        ENGINE_PROFILE_SCOPE("MeshLoader::prepare");
+        mesh.ComputeBounds();
+        if (mesh.lods.empty()) {
+            mesh.ResetLods();
+        }
+        if (generateLods) {
+            MeshSimplifier::GenerateLods(mesh, lodSettings);
+        }
+        if (optimize) {
+            MeshOptimizer::Optimize(mesh);
+        }
+        ParsedMesh parsed;
+        parsed.data = std::move(mesh);
+        packBuffers(parsed, layout);
+        return parsed;
+    }, JobPriority::Background);
+    return addRequest(name, std::move(parsing));
+}
+
+void MeshLoader::Update()
+{
+    ENGINE_PROFILE_FUNCTION();
+    m_uploads.Update();
+
+    VkDeviceSize budget = m_uploadBudget;
+    bool staged = false;
+    for (const auto& request : m_requests) {
+        if (request->state == MeshState::Parsing &&
+            request->parsing.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            finishParsing(*request);
+        }
+        if (request->state != MeshState::Uploading) {
+            continue;
+        }
+
+        if (request->uploadBatch == 0 && budget > 0) {
+            budget -= stage(*request, budget);
+            staged = true;
+        }
+        if (request->uploadBatch != 0 && m_uploads.IsComplete(request->uploadBatch)) {
+            request->state = MeshState::Ready;
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - request->requestTime).count();
+            Log::GetCoreLogger()->info("Mesh '{0}' is ready ({1} {4} vertices, {2} LODs, {3:.1f} ms after the request).",
+                request->name, request->mesh.vertexCount, request->mesh.lods.size(), ms, VertexFormat::GetName(request->mesh.vertexLayout));
+        }
+    }
+
+    // Everything staged this frame goes to the GPU as one batch
+    if (staged) {
+        m_uploads.Submit();
+    }
+}
+
+void MeshLoader::Flush()
+{
+    ENGINE_PROFILE_FUNCTION();
+    for (const auto& request : m_requests) {
+        if (request->parsing.valid()) {
+            request->parsing.wait();
+        }
+    }
+
+    VkDeviceSize budget = m_uploadBudget;
+    m_uploadBudget = std::numeric_limits<VkDeviceSize>::max();
+    Update();
+    m_uploads.WaitIdle();
+    Update();
+    m_uploadBudget = budget;
+}
+
+MeshState MeshLoader::GetState(MeshHandle handle) const
+{
+    const Request* request = find(handle);
+    return request ? request->state : MeshState::Invalid;
+}
+
+const GpuMesh* MeshLoader::GetMesh(MeshHandle handle) const
+{
+    const Request* request = find(handle);
+    return request && request->state == MeshState::Ready ? &request->mesh : nullptr;
+}
+
+const std::string& MeshLoader::GetError(MeshHandle handle) const
+{
+    static const std::string none;
+    const Request* request = find(handle);
+    return request ? request->error : none;
+}
+
+size_t MeshLoader::GetPendingCount() const
+{
+    return std::count_if(m_requests.begin(), m_requests.end(), [](const auto& request) {
+        return request->state == MeshState::Parsing || request->state == MeshState::Uploading;
+    });
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+void MeshLoader::packBuffers(ParsedMesh& parsed, VertexLayout layout)
+{
+    const Vertex* vertices = parsed.file ? parsed.file->GetVertices() : parsed.data.vertices.data();
+    const uint32_t* indices = parsed.file ? parsed.file->GetIndices() : parsed.data.indices.data();
+    const size_t vertexCount = parsed.file ? parsed.file->GetVertexCount() : parsed.data.vertices.size();
+    const size_t indexCount = parsed.file ? parsed.file->GetIndexCount() : parsed.data.indices.size();
+    const Aabb& bounds = parsed.file ? parsed.file->GetBounds() : parsed.data.bounds;
+
+    parsed.layout = layout;
+    if (layout != VertexLayout::Float) {
+        parsed.quantization = VertexFormat::Pack(layout, vertices, vertexCount, bounds, parsed.packed);
+    }
+    // Halves the index stream and the index fetch bandwidth of every draw
+    if (vertexCount > 0 && fitsUint16(static_cast<uint32_t>(vertexCount))) {
+        parsed.indices16.assign(indices, indices + indexCount);
+    }
+}
+
+MeshHandle MeshLoader::addRequest(const std::string& name, std::future<ParsedMesh> parsing)
+{
+    auto request = std::make_unique<Request>();
+    request->name = name;
+    request->parsing = std::move(parsing);
+    request->requestTime = std::chrono::steady_clock::now();
+    m_requests.push_back(std::move(request));
+    return static_cast<MeshHandle>(m_requests.size());
+}
+
+MeshLoader::Request* MeshLoader::find(MeshHandle handle) const
+{
+    return handle > 0 && handle <= m_requests.size() ? m_requests[handle - 1].get() : nullptr;
+}
+
+void MeshLoader::finishParsing(Request& request)
+{
+    try {
+        ParsedMesh parsed = request.parsing.get();
+        request.data = std::move(parsed.data);
+        request.file = std::move(parsed.file);
+
+        GpuMesh& mesh = request.mesh;
+        if (request.file) {
+            const MeshFile& file = *request.file;
+            mesh.name = file.GetName();
+            mesh.vertexCount = file.GetVertexCount();
+            mesh.indexCount = file.GetIndexCount();
+            mesh.lods.assign(file.GetLods(), file.GetLods() + file.GetLodCount());
+            mesh.bounds = file.GetBounds();
+            mesh.boundingSphere = file.GetBoundingSphere();
+            request.vertexData = file.GetVertices();
+            request.indexData = file.GetIndices();
+        } else {
+            const MeshData& data = request.data;
+            if (data.vertices.empty() || data.indices.empty()) {
+                throw std::runtime_error("failed to load mesh: it has no triangles!");
+            }
+            mesh.name = data.name;
+            mesh.vertexCount = static_cast<uint32_t>(data.vertices.size());
+            mesh.indexCount = static_cast<uint32_t>(data.indices.size());
+            mesh.lods = data.lods;
+            mesh.bounds = data.bounds;
+            mesh.boundingSphere = data.boundingSphere;
+            request.vertexData = data.vertices.data();
+            request.indexData = data.indices.data();
+        }
+        if (mesh.name.empty()) {
+            mesh.name = request.name;
+        }
+        mesh.vertexLayout = parsed.layout;
+        mesh.quantization = parsed.quantization;
+        if (parsed.layout != VertexLayout::Float) {
+            request.packed = std::move(parsed.packed);
+            request.vertexData = request.packed.data();
+        }
+        if (!parsed.indices16.empty()) {
+            mesh.indexType = VK_INDEX_TYPE_UINT16;
+            request.indices16 = std::move(parsed.indices16);
+            request.indexData = request.indices16.data();
+        }
+
+        GpuAllocationInfo allocInfo{};
+        m_allocator.CreateBuffer(VkDeviceSize(VertexFormat::GetStride(mesh.vertexLayout)) * mesh.vertexCount, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            allocInfo, mesh.vertexBuffer, mesh.vertexMemory);
+        m_allocator.CreateBuffer(getIndexSize(mesh.indexType) * mesh.indexCount, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+            allocInfo, mesh.indexBuffer, mesh.indexMemory);
+        request.state = MeshState::Uploading;
+    }
+    catch (const std::exception& e) {
+        m_allocator.DestroyBuffer(request.mesh.vertexBuffer, request.mesh.vertexMemory);
+        m_allocator.DestroyBuffer(request.mesh.indexBuffer, request.mesh.indexMemory);
+        request.data = MeshData();
+        request.file.reset();
+        request.packed = std::vector<PackedVertex>();
+        request.indices16 = std::vector<uint16_t>();
+        request.state = MeshState::Failed;
+        request.error = e.what();
+        Log::GetCoreLogger()->error("Loading mesh '{0}' failed: {1}", request.name, request.error);
+    }
+}
+
+VkDeviceSize MeshLoader::stage(Request& request, VkDeviceSize budget)
+{
+    const VkDeviceSize vertexBytes = VkDeviceSize(VertexFormat::GetStride(request.mesh.vertexLayout)) * request.mesh.vertexCount;
+    const VkDeviceSize indexBytes = getIndexSize(request.mesh.indexType) * request.mesh.indexCount;
+    const char* vertexData = static_cast<const char*>(request.vertexData);
+    const char* indexData = static_cast<const char*>(request.indexData);
+
+    // Vertices first, then indices, continuing where the previous frame stopped
+    VkDeviceSize used = 0;
+    while (used < budget && request.stagedBytes < vertexBytes + indexBytes) {
+        if (request.stagedBytes < vertexBytes) {
+            VkDeviceSize chunk = std::min(vertexBytes - request.stagedBytes, budget - used);
+            m_uploads.UploadBuffer(vertexData + request.stagedBytes, chunk,
+                request.mesh.vertexBuffer, request.stagedBytes);
+            request.stagedBytes += chunk;
+            used += chunk;
+        } else {
+            VkDeviceSize offset = request.stagedBytes - vertexBytes;
+            VkDeviceSize chunk = std::min(indexBytes - offset, budget - used);
+            m_uploads.UploadBuffer(indexData + offset, chunk,
+                request.mesh.indexBuffer, offset);
+            request.stagedBytes += chunk;
+            used += chunk;
+        }
+    }
+
+    if (request.stagedBytes == vertexBytes + indexBytes) {
+        // The data is in the ring now; the mesh is ready once the batch it ends in completes
+        request.uploadBatch = m_uploads.GetRecordingBatch();
+        request.data = MeshData();
+        request.file.reset();
+        request.packed = std::vector<PackedVertex>();
+        request.indices16 = std::vector<uint16_t>();
+        request.vertexData = nullptr;
+        request.indexData = nullptr;
+    }
+    return used;
+}
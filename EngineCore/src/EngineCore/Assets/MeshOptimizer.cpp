@@ -0,0 +1,335 @@
+#include "EngineCore/Assets/MeshOptimizer.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+    // A FIFO post-transform cache: a vertex is cached while fewer than CacheSize misses happened since it was inserted.
+    class FifoCache
+    {
+    public:
+        explicit FifoCache(uint32_t vertexCount)
+            : m_inserted(vertexCount, 0)
+        {
+        }
+
+        // Returns the number of the triangle's vertices that had to be transformed
+        uint32_t Access(const uint32_t* triangle)
+        {
+            uint32_t misses = 0;
+            for (int corner = 0; corner < 3; corner++) {
+                uint32_t vertex = triangle[corner];
+                if (m_time - m_inserted[vertex] > MeshOptimizer::CacheSize) {
+                    m_inserted[vertex] = m_time++;
+                    misses++;
+                }
+            }
+            return misses;
+        }
+
+        void Reset()
+        {
+            m_time += MeshOptimizer::CacheSize + 1;
+        }
+
+    private:
+        std::vector<uint32_t> m_inserted;
+        uint32_t m_time = MeshOptimizer::CacheSize + 1;
+    };
+
+    // The triangles using each vertex, in compressed rows
+    struct TriangleAdjacency
+    {
+        std::vector<uint32_t> offsets;   // vertexCount + 1 entries
+        std::vector<uint32_t> triangles;
+
+        TriangleAdjacency(const uint32_t* indices, size_t count, uint32_t vertexCount)
+            : offsets(vertexCount + 1, 0), triangles(count)
+        {
+            for (size_t i = 0; i < count; i++) {
+                offsets[indices[i] + 1]++;
+            }
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < count; i++) {
+                triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+        }
+    };
+
+    VertexCacheStats analyzeLod(const MeshData& mesh, const MeshLod& lod)
+    {
+        return MeshOptimizer::AnalyzeVertexCache(mesh.indices.data() + lod.firstIndex, lod.indexCount,
+                                                 static_cast<uint32_t>(mesh.vertices.size()));
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void MeshOptimizer::Optimize(MeshData& mesh, float overdrawThreshold)
+{
+    ENGINE_PROFILE_FUNCTION();
+    if (mesh.vertices.empty() || mesh.lods.empty()) {
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    const VertexCacheStats before = analyzeLod(mesh, mesh.lods[0]);
+
+    // Levels are optimized on their own: each one is drawn on its own. Tipsify is a heuristic, so a
+    // level that arrived better ordered (e.g. by an offline tool) keeps its order
+    std::vector<uint32_t> original;
+    for (const MeshLod& lod : mesh.lods) {
+        uint32_t* indices = mesh.indices.data() + lod.firstIndex;
+        original.assign(indices, indices + lod.indexCount);
+        OptimizeVertexCache(indices, lod.indexCount, vertexCount);
+        OptimizeOverdraw(indices, lod.indexCount, mesh.vertices, overdrawThreshold);
+        if (AnalyzeVertexCache(indices, lod.indexCount, vertexCount).acmr > AnalyzeVertexCache(original.data(), lod.indexCount, vertexCount).acmr) {
+            std::copy(original.begin(), original.end(), indices);
+        }
+    }
+    OptimizeVertexFetch(mesh);
+
+    const VertexCacheStats after = analyzeLod(mesh, mesh.lods[0]);
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    Log::GetCoreLogger()->info("Optimized mesh '{0}' ({1} LODs, {2} -> {3} vertices): ACMR {4:.3f} -> {5:.3f}, ATVR {6:.3f} -> {7:.3f} ({8:.1f} ms).",
+        mesh.name, mesh.lods.size(), vertexCount, mesh.vertices.size(), before.acmr, after.acmr, before.atvr, after.atvr, milliseconds);
+}
+
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, size_t count, uint32_t vertexCount)
+{
+    ENGINE_PROFILE_FUNCTION();
+    const size_t triangleCount = count / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+    TriangleAdjacency adjacency(indices, count, vertexCount);
+
+    // Remaining (not yet emitted) triangles per vertex
+    std::vector<uint32_t> live(vertexCount);
+    for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+        live[vertex] = adjacency.offsets[vertex + 1] - adjacency.offsets[vertex];
+    }
+    std::vector<uint32_t> cacheTime(vertexCount, 0);
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<uint32_t> deadEnds;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+
+    uint32_t time = CacheSize + 1;
+    uint32_t cursor = 0;
+    int64_t fan = indices[0];
+    while (fan >= 0) {
+        // Emit every remaining triangle around the fanning vertex
+        candidates.clear();
+        const uint32_t vertex = static_cast<uint32_t>(fan);
+        for (uint32_t i = adjacency.offsets[vertex]; i < adjacency.offsets[vertex + 1]; i++) {
+            const uint32_t triangle = adjacency.triangles[i];
+            if (emitted[triangle]) {
+                continue;
+            }
+            for (int corner = 0; corner < 3; corner++) {
+                const uint32_t v = indices[triangle * 3 + corner];
+                output.push_back(v);
+                deadEnds.push_back(v);
+                candidates.push_back(v);
+                live[v]--;
+                if (time - cacheTime[v] > CacheSize) {
+                    cacheTime[v] = time++;
+                }
+            }
+            emitted[triangle] = true;
+        }
+
+        // Continue with the candidate that stays in the cache longest while its remaining fan still fits
+        fan = -1;
+        int64_t bestPriority = -1;
+        for (uint32_t v : candidates) {
+            if (live[v] == 0) {
+                continue;
+            }
+            int64_t priority = 0;
+            if (time - cacheTime[v] + 2 * live[v] <= CacheSize) {
+                priority = time - cacheTime[v];
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                fan = v;
+            }
+        }
+
+        // Dead end: the most recently used vertex with triangles left, else the next one in input order
+        while (fan < 0 && !deadEnds.empty()) {
+            const uint32_t v = deadEnds.back();
+            deadEnds.pop_back();
+            if (live[v] > 0) {
+                fan = v;
+            }
+        }
+        while (fan < 0 && cursor < vertexCount) {
+            if (live[cursor] > 0) {
+                fan = cursor;
+            }
+            cursor++;
+        }
+    }
+    std::copy(output.begin(), output.end(), indices);
+}
+
+void MeshOptimizer::OptimizeOverdraw(uint32_t* indices, size_t count, const std::vector<Vertex>& vertices, float threshold)
+{
+    ENGINE_PROFILE_FUNCTION();
+    const size_t triangleCount = count / 3;
+    if (triangleCount < 2 || threshold < 1.0f) {
+        return;
+    }
+    const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+
+    // Hard boundaries: triangles the cache-optimized order starts from scratch (all three vertices missed)
+    std::vector<size_t> hardStarts;
+    FifoCache cache(vertexCount);
+    uint32_t totalMisses = 0;
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        uint32_t misses = cache.Access(indices + triangle * 3);
+        totalMisses += misses;
+        if (misses == 3) {
+            hardStarts.push_back(triangle);
+        }
+    }
+    hardStarts.push_back(triangleCount);
+
+    // Soft boundaries: split a hard cluster wherever the part so far is within the threshold of its miss ratio
+    std::vector<size_t> clusterStarts;
+    for (size_t h = 0; h + 1 < hardStarts.size(); h++) {
+        const size_t begin = hardStarts[h];
+        const size_t end = hardStarts[h + 1];
+        uint32_t misses = 0;
+        cache.Reset();
+        for (size_t triangle = begin; triangle < end; triangle++) {
+            misses += cache.Access(indices + triangle * 3);
+        }
+        const float limit = threshold * static_cast<float>(misses) / static_cast<float>(end - begin);
+
+        size_t clusterStart = begin;
+        misses = 0;
+        cache.Reset();
+        for (size_t triangle = begin; triangle < end; triangle++) {
+            misses += cache.Access(indices + triangle * 3);
+            if (triangle + 1 < end && static_cast<float>(misses) <= limit * static_cast<float>(triangle - clusterStart + 1)) {
+                clusterStarts.push_back(clusterStart);
+                clusterStart = triangle + 1;
+                misses = 0;
+                cache.Reset();
+            }
+        }
+        clusterStarts.push_back(clusterStart);
+    }
+    clusterStarts.push_back(triangleCount);
+    const size_t clusterCount = clusterStarts.size() - 1;
+    if (clusterCount < 2) {
+        return;
+    }
+
+    // Area-weighted centroid and normal of every cluster and of the whole list (counter-clockwise front faces)
+    std::vector<glm::vec3> centroids(clusterCount, glm::vec3(0.0f));
+    std::vector<glm::vec3> normals(clusterCount, glm::vec3(0.0f));
+    std::vector<float> areas(clusterCount, 0.0f);
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    for (size_t cluster = 0; cluster < clusterCount; cluster++) {
+        for (size_t triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; triangle++) {
+            const glm::vec3& a = vertices[indices[triangle * 3 + 0]].pos;
+            const glm::vec3& b = vertices[indices[triangle * 3 + 1]].pos;
+            const glm::vec3& c = vertices[indices[triangle * 3 + 2]].pos;
+            const glm::vec3 normal = glm::cross(b - a, c - a);
+            const float area = glm::length(normal);
+            centroids[cluster] += (a + b + c) * (area / 3.0f);
+            normals[cluster] += normal;
+            areas[cluster] += area;
+        }
+        meshCentroid += centroids[cluster];
+        meshArea += areas[cluster];
+    }
+    meshCentroid = meshArea > 0.0f ? meshCentroid / meshArea : glm::vec3(0.0f);
+
+    // Clusters facing away from the center are likely in front of the others from any direction, so they go first
+    std::vector<float> facing(clusterCount, 0.0f);
+    for (size_t cluster = 0; cluster < clusterCount; cluster++) {
+        const float normalLength = glm::length(normals[cluster]);
+        if (areas[cluster] > 0.0f && normalLength > 0.0f) {
+            facing[cluster] = glm::dot(centroids[cluster] / areas[cluster] - meshCentroid, normals[cluster] / normalLength);
+        }
+    }
+    std::vector<uint32_t> order(clusterCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&facing](uint32_t a, uint32_t b) { return facing[a] > facing[b]; });
+
+    std::vector<uint32_t> sorted;
+    sorted.reserve(triangleCount * 3);
+    for (uint32_t cluster : order) {
+        sorted.insert(sorted.end(), indices + clusterStarts[cluster] * 3, indices + clusterStarts[cluster + 1] * 3);
+    }
+
+    // A cluster no longer finds the vertices its predecessor left in the cache, so the bound is only
+    // per cluster; the whole list is checked as well before the new order is taken
+    cache.Reset();
+    uint32_t sortedMisses = 0;
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        sortedMisses += cache.Access(sorted.data() + triangle * 3);
+    }
+    if (static_cast<float>(sortedMisses) > threshold * static_cast<float>(totalMisses)) {
+        return;
+    }
+    std::copy(sorted.begin(), sorted.end(), indices);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(MeshData& mesh)
+{
+    ENGINE_PROFILE_FUNCTION();
+    constexpr uint32_t Unused = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> remap(mesh.vertices.size(), Unused);
+    std::vector<Vertex> vertices;
+    vertices.reserve(mesh.vertices.size());
+
+    // The finest level comes first in the index buffer, so its order decides the layout
+    for (uint32_t& index : mesh.indices) {
+        if (remap[index] == Unused) {
+            remap[index] = static_cast<uint32_t>(vertices.size());
+            vertices.push_back(mesh.vertices[index]);
+        }
+        index = remap[index];
+    }
+    mesh.vertices = std::move(vertices);
+}
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const uint32_t* indices, size_t count, uint32_t vertexCount)
+{
+    VertexCacheStats stats;
+    const size_t triangleCount = count / 3;
+    if (triangleCount == 0) {
+        return stats;
+    }
+    FifoCache cache(vertexCount);
+    std::vector<bool> referenced(vertexCount, false);
+    uint32_t misses = 0;
+    uint32_t referencedCount = 0;
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        misses += cache.Access(indices + triangle * 3);
+        for (int corner = 0; corner < 3; corner++) {
+            const uint32_t vertex = indices[triangle * 3 + corner];
+            referencedCount += referenced[vertex] ? 0 : 1;
+            referenced[vertex] = true;
+        }
+    }
+    stats.acmr = static_cast<float>(misses) / static_cast<float>(triangleCount);
+    stats.atvr = static_cast<float>(misses) / static_cast<float>(referencedCount);
+    return stats;
+}
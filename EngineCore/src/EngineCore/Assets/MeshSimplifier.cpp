@@ -0,0 +1,309 @@
+#include "EngineCore/Assets/MeshSimplifier.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace
+{
+    // Symmetric 4x4 quadric in double precision; `weight` is the accumulated triangle area,
+    // so Evaluate() returns an area-weighted mean of squared plane distances.
+    struct Quadric
+    {
+        double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+        double b0 = 0, b1 = 0, b2 = 0;
+        double c = 0;
+        double weight = 0;
+
+        static Quadric FromPlane(const glm::dvec3& normal, double distance, double weight)
+        {
+            Quadric q;
+            q.a00 = normal.x * normal.x * weight;
+            q.a01 = normal.x * normal.y * weight;
+            q.a02 = normal.x * normal.z * weight;
+            q.a11 = normal.y * normal.y * weight;
+            q.a12 = normal.y * normal.z * weight;
+            q.a22 = normal.z * normal.z * weight;
+            q.b0 = normal.x * distance * weight;
+            q.b1 = normal.y * distance * weight;
+            q.b2 = normal.z * distance * weight;
+            q.c = distance * distance * weight;
+            q.weight = weight;
+            return q;
+        }
+
+        void Add(const Quadric& other)
+        {
+            a00 += other.a00; a01 += other.a01; a02 += other.a02;
+            a11 += other.a11; a12 += other.a12; a22 += other.a22;
+            b0 += other.b0; b1 += other.b1; b2 += other.b2;
+            c += other.c;
+            weight += other.weight;
+        }
+
+        // Squared distance of a point to the planes, averaged by area
+        double Evaluate(const glm::vec3& point) const
+        {
+            double x = point.x, y = point.y, z = point.z;
+            double error = a00 * x * x + a11 * y * y + a22 * z * z
+                         + 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+                         + 2.0 * (b0 * x + b1 * y + b2 * z) + c;
+            return weight > 0.0 ? std::max(error, 0.0) / weight : 0.0;
+        }
+    };
+
+    struct Collapse
+    {
+        uint32_t from;
+        uint32_t to;
+        double cost;
+    };
+
+    // Maps every vertex to the first vertex with the same position, so collapses see one connected surface.
+    std::vector<uint32_t> weldPositions(const std::vector<glm::vec3>& positions)
+    {
+        std::vector<uint32_t> order(positions.size());
+        std::iota(order.begin(), order.end(), 0u);
+        auto less = [&positions](uint32_t a, uint32_t b) {
+            const glm::vec3& pa = positions[a];
+            const glm::vec3& pb = positions[b];
+            if (pa.x != pb.x) return pa.x < pb.x;
+            if (pa.y != pb.y) return pa.y < pb.y;
+            if (pa.z != pb.z) return pa.z < pb.z;
+            return a < b;
+        };
+        std::sort(order.begin(), order.end(), less);
+
+        std::vector<uint32_t> canonical(positions.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            bool sameAsPrevious = i > 0 && positions[order[i]] == positions[order[i - 1]];
+            canonical[order[i]] = sameAsPrevious ? canonical[order[i - 1]] : order[i];
+        }
+        return canonical;
+    }
+
+    glm::vec3 triangleNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+    {
+        return glm::cross(b - a, c - a);
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+std::vector<uint32_t> MeshSimplifier::Simplify(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices,
+                                               size_t targetIndexCount, float maxError, float* resultError)
+{
+    ENGINE_PROFILE_FUNCTION();
+    const uint32_t vertexCount = static_cast<uint32_t>(positions.size());
+    std::vector<uint32_t> canonical = weldPositions(positions);
+    std::vector<uint32_t> result(indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        result[i] = canonical[indices[i]];
+    }
+
+    // Lock vertices on open borders or non-manifold edges: an edge is shared by exactly two triangles otherwise
+    std::vector<bool> locked(vertexCount, false);
+    {
+        std::vector<uint64_t> edges;
+        edges.reserve(result.size());
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (int corner = 0; corner < 3; corner++) {
+                uint32_t a = result[i + corner];
+                uint32_t b = result[i + (corner + 1) % 3];
+                edges.push_back((static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        for (size_t i = 0; i < edges.size();) {
+            size_t j = i;
+            while (j < edges.size() && edges[j] == edges[i]) {
+                j++;
+            }
+            if (j - i != 2) {
+                locked[static_cast<uint32_t>(edges[i] >> 32)] = true;
+                locked[static_cast<uint32_t>(edges[i] & 0xffffffffu)] = true;
+            }
+            i = j;
+        }
+    }
+
+    // Accumulate the planes of the surrounding triangles on every vertex
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t i = 0; i < result.size(); i += 3) {
+        glm::dvec3 p0(positions[result[i]]), p1(positions[result[i + 1]]), p2(positions[result[i + 2]]);
+        glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+        double length = glm::length(normal);
+        if (length <= 0.0) {
+            continue;
+        }
+        normal /= length;
+        Quadric plane = Quadric::FromPlane(normal, -glm::dot(normal, p0), length * 0.5);
+        for (int corner = 0; corner < 3; corner++) {
+            quadrics[result[i + corner]].Add(plane);
+        }
+    }
+
+    const double maxCost = static_cast<double>(maxError) * maxError;
+    double largestCost = 0.0;
+    std::vector<uint32_t> triangleOffsets, vertexTriangles;
+    std::vector<Collapse> candidates;
+    std::vector<uint32_t> collapseTarget(vertexCount);
+    std::vector<bool> touched(vertexCount);
+
+    // Each pass collapses the cheapest independent edges, then rewrites the index buffer
+    while (result.size() > targetIndexCount) {
+        const size_t triangleCount = result.size() / 3;
+
+        // Vertex -> triangle adjacency in compressed rows
+        triangleOffsets.assign(vertexCount + 1, 0);
+        for (uint32_t index : result) {
+            triangleOffsets[index + 1]++;
+        }
+        std::partial_sum(triangleOffsets.begin(), triangleOffsets.end(), triangleOffsets.begin());
+        vertexTriangles.resize(result.size());
+        std::vector<uint32_t> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+        for (size_t i = 0; i < result.size(); i++) {
+            vertexTriangles[fill[result[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        // Cheapest direction of every edge. Unlocked edges are shared by two triangles with opposite
+        // winding, so taking only the a < b half-edge visits each of them once
+        candidates.clear();
+        for (size_t i = 0; i < result.size(); i += 3) {
+            for (int corner = 0; corner < 3; corner++) {
+                uint32_t a = result[i + corner];
+                uint32_t b = result[i + (corner + 1) % 3];
+                if (a > b || (locked[a] && locked[b])) {
+                    continue;
+                }
+                Quadric combined = quadrics[a];
+                combined.Add(quadrics[b]);
+                double costToB = locked[a] ? std::numeric_limits<double>::max() : combined.Evaluate(positions[b]);
+                double costToA = locked[b] ? std::numeric_limits<double>::max() : combined.Evaluate(positions[a]);
+                candidates.push_back(costToB <= costToA ? Collapse{ a, b, costToB } : Collapse{ b, a, costToA });
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const Collapse& x, const Collapse& y) {
+            if (x.cost != y.cost) return x.cost < y.cost;
+            if (x.from != y.from) return x.from < y.from;
+            return x.to < y.to;
+        });
+
+        // Each triangle shared by both ends of a collapse disappears
+        size_t trianglesToRemove = triangleCount - targetIndexCount / 3;
+        size_t removed = 0;
+        bool collapsed = false;
+        std::iota(collapseTarget.begin(), collapseTarget.end(), 0u);
+        std::fill(touched.begin(), touched.end(), false);
+
+        for (const Collapse& collapse : candidates) {
+            if (collapse.cost > maxCost || removed >= trianglesToRemove) {
+                break;
+            }
+            // Independent collapses only: the ring of the moved vertex must be unchanged this pass
+            if (touched[collapse.from] || touched[collapse.to]) {
+                continue;
+            }
+
+            bool flips = false;
+            size_t sharedTriangles = 0;
+            for (uint32_t k = triangleOffsets[collapse.from]; k < triangleOffsets[collapse.from + 1] && !flips; k++) {
+                const uint32_t* triangle = &result[vertexTriangles[k] * 3];
+                if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to) {
+                    sharedTriangles++;
+                    continue;
+                }
+                glm::vec3 corners[3], moved[3];
+                for (int corner = 0; corner < 3; corner++) {
+                    corners[corner] = positions[triangle[corner]];
+                    moved[corner] = triangle[corner] == collapse.from ? positions[collapse.to] : corners[corner];
+                }
+                glm::vec3 before = triangleNormal(corners[0], corners[1], corners[2]);
+                glm::vec3 after = triangleNormal(moved[0], moved[1], moved[2]);
+                // Also reject large rotations, which let a triangle flip over several passes
+                flips = glm::dot(before, after) <= 0.25f * glm::length(before) * glm::length(after);
+            }
+            if (flips) {
+                continue;
+            }
+
+            collapseTarget[collapse.from] = collapse.to;
+            quadrics[collapse.to].Add(quadrics[collapse.from]);
+            for (uint32_t k = triangleOffsets[collapse.from]; k < triangleOffsets[collapse.from + 1]; k++) {
+                const uint32_t* triangle = &result[vertexTriangles[k] * 3];
+                touched[triangle[0]] = touched[triangle[1]] = touched[triangle[2]] = true;
+            }
+            removed += sharedTriangles;
+            largestCost = std::max(largestCost, collapse.cost);
+            collapsed = true;
+        }
+        if (!collapsed) {
+            break;
+        }
+
+        // Redirect collapsed vertices and drop the triangles that became degenerate
+        size_t write = 0;
+        for (size_t i = 0; i < result.size(); i += 3) {
+            uint32_t a = collapseTarget[result[i]];
+            uint32_t b = collapseTarget[result[i + 1]];
+            uint32_t c = collapseTarget[result[i + 2]];
+            if (a != b && b != c && a != c) {
+                result[write++] = a;
+                result[write++] = b;
+                result[write++] = c;
+            }
+        }
+        result.resize(write);
+    }
+
+    if (resultError) {
+        *resultError = static_cast<float>(std::sqrt(largestCost));
+    }
+    return result;
+}
+
+void MeshSimplifier::GenerateLods(MeshData& mesh, const LodSettings& settings)
+{
+    ENGINE_PROFILE_FUNCTION();
+    if (mesh.lods.empty()) {
+        mesh.ResetLods();
+    }
+
+    // Keep LOD 0 only; stale levels are dropped together with their indices
+    MeshLod base = mesh.lods.front();
+    std::vector<uint32_t> current(mesh.indices.begin() + base.firstIndex, mesh.indices.begin() + base.firstIndex + base.indexCount);
+    mesh.indices = current;
+    mesh.lods = { MeshLod{ 0, base.indexCount, 0.0f } };
+    if (mesh.boundingSphere.w <= 0.0f) {
+        mesh.ComputeBounds();
+    }
+
+    std::vector<glm::vec3> positions(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); i++) {
+        positions[i] = mesh.vertices[i].pos;
+    }
+
+    float maxError = settings.maxError * mesh.boundingSphere.w;
+    float chainError = 0.0f;
+    while (mesh.lods.size() < settings.maxLodCount) {
+        size_t target = static_cast<size_t>(current.size() / 3 * settings.reduction) * 3;
+        float error = 0.0f;
+        std::vector<uint32_t> simplified = Simplify(positions, current, target, maxError, &error);
+        if (simplified.empty() || simplified.size() > current.size() * (1.0f - settings.minReduction)) {
+            break;
+        }
+
+        chainError += error;
+        mesh.lods.push_back({ static_cast<uint32_t>(mesh.indices.size()), static_cast<uint32_t>(simplified.size()), chainError });
+        mesh.indices.insert(mesh.indices.end(), simplified.begin(), simplified.end());
+        current = std::move(simplified);
+    }
+
+    Log::GetCoreLogger()->info("Generated {0} LODs for mesh '{1}': {2} -> {3} triangles (error {4:.4f}).",
+        mesh.lods.size(), mesh.name, mesh.lods.front().indexCount / 3, mesh.lods.back().indexCount / 3, mesh.lods.back().error);
+}
@@ -0,0 +1,465 @@
+#include "EngineCore/Assets/TextureImporter.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/PathUtils.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    uint32_t readU32(const uint8_t* p)
+    {
+        return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+    }
+
+    uint64_t readU64(const uint8_t* p)
+    {
+        return static_cast<uint64_t>(readU32(p)) | static_cast<uint64_t>(readU32(p + 4)) << 32;
+    }
+
+    constexpr uint32_t fourCC(char a, char b, char c, char d)
+    {
+        return static_cast<uint32_t>(a) | static_cast<uint32_t>(b) << 8 | static_cast<uint32_t>(c) << 16 | static_cast<uint32_t>(d) << 24;
+    }
+
+    // Reads up to size bytes from the start of a file and reports the file's total size.
+    std::vector<uint8_t> readPrefix(const std::string& path, size_t size, uint64_t& fileSize)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            throw std::runtime_error("failed to open texture file '" + path + "'!");
+        }
+        fileSize = static_cast<uint64_t>(file.tellg());
+        std::vector<uint8_t> bytes(static_cast<size_t>(std::min<uint64_t>(size, fileSize)));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return bytes;
+    }
+
+    // Fills in the size of every level of a chain and checks that the chain fits in the file.
+    void describeLevels(TextureData& texture, uint64_t fileSize)
+    {
+        TextureFormatInfo info = TextureFormatInfo::Get(texture.format);
+        if (!info.IsSupported()) {
+            throw std::runtime_error("failed to load '" + texture.path + "': unsupported texture format " + std::to_string(texture.format) + "!");
+        }
+        if (texture.width == 0 || texture.height == 0 || texture.levels.empty() || texture.levels.size() > texture.GetFullMipCount()) {
+            throw std::runtime_error("failed to load '" + texture.path + "': invalid texture dimensions or mip count!");
+        }
+        for (size_t i = 0; i < texture.levels.size(); i++) {
+            TextureLevel& level = texture.levels[i];
+            level.width = std::max(texture.width >> i, 1u);
+            level.height = std::max(texture.height >> i, 1u);
+            if (level.size == 0) {
+                level.size = info.GetLevelSize(level.width, level.height);
+            }
+            if (level.size != info.GetLevelSize(level.width, level.height) || level.fileOffset + level.size > fileSize) {
+                throw std::runtime_error("failed to load '" + texture.path + "': mip level " + std::to_string(i) + " is truncated!");
+            }
+        }
+    }
+
+    // =================================================================================
+    // KTX2
+    // =================================================================================
+
+    constexpr uint8_t Ktx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+    constexpr size_t Ktx2HeaderSize = 80;
+    constexpr size_t Ktx2LevelIndexEntrySize = 24;
+
+    TextureData readKtx2Header(const std::string& path)
+    {
+        uint64_t fileSize = 0;
+        std::vector<uint8_t> header = readPrefix(path, Ktx2HeaderSize, fileSize);
+        if (header.size() < Ktx2HeaderSize || std::memcmp(header.data(), Ktx2Identifier, sizeof(Ktx2Identifier)) != 0) {
+            throw std::runtime_error("failed to load '" + path + "': not a KTX2 file!");
+        }
+
+        TextureData texture;
+        texture.path = path;
+        texture.format = static_cast<VkFormat>(readU32(&header[12]));
+        texture.width = readU32(&header[20]);
+        texture.height = readU32(&header[24]);
+        uint32_t depth = readU32(&header[28]);
+        uint32_t layers = readU32(&header[32]);
+        uint32_t faces = readU32(&header[36]);
+        uint32_t levelCount = std::max(readU32(&header[40]), 1u); // 0 asks the loader to generate the mips
+        uint32_t supercompression = readU32(&header[44]);
+        if (texture.format == VK_FORMAT_UNDEFINED || supercompression != 0) {
+            throw std::runtime_error("failed to load '" + path + "': supercompressed KTX2 files are not supported!");
+        }
+        if (depth > 1 || layers > 1 || faces != 1) {
+            throw std::runtime_error("failed to load '" + path + "': only single 2D textures are supported!");
+        }
+        if (levelCount > 32) {
+            throw std::runtime_error("failed to load '" + path + "': invalid mip count!");
+        }
+
+        std::vector<uint8_t> index = readPrefix(path, Ktx2HeaderSize + Ktx2LevelIndexEntrySize * levelCount, fileSize);
+        if (index.size() < Ktx2HeaderSize + Ktx2LevelIndexEntrySize * levelCount) {
+            throw std::runtime_error("failed to load '" + path + "': truncated level index!");
+        }
+        texture.levels.resize(levelCount);
+        for (uint32_t i = 0; i < levelCount; i++) {
+            const uint8_t* entry = &index[Ktx2HeaderSize + Ktx2LevelIndexEntrySize * i];
+            texture.levels[i].fileOffset = readU64(entry);
+            texture.levels[i].size = readU64(entry + 8);
+        }
+        describeLevels(texture, fileSize);
+        return texture;
+    }
+
+    // =================================================================================
+    // DDS
+    // =================================================================================
+
+    constexpr size_t DdsHeaderSize = 128;      // Magic and DDS_HEADER
+    constexpr size_t DdsDx10HeaderSize = 20;
+    constexpr uint32_t DdsMipMapCountFlag = 0x20000;
+    constexpr uint32_t DdsFourCCFlag = 0x4;
+    constexpr uint32_t DdsRgbFlag = 0x40;
+    constexpr uint32_t DdsLuminanceFlag = 0x20000;
+    constexpr uint32_t DdsCubemapFlag = 0x200;
+    constexpr uint32_t DdsVolumeFlag = 0x200000;
+
+    VkFormat formatFromDxgi(uint32_t dxgiFormat)
+    {
+        switch (dxgiFormat) {
+        case 2:  return VK_FORMAT_R32G32B32A32_SFLOAT;
+        case 10: return VK_FORMAT_R16G16B16A16_SFLOAT;
+        case 28: return VK_FORMAT_R8G8B8A8_UNORM;
+        case 29: return VK_FORMAT_R8G8B8A8_SRGB;
+        case 49: return VK_FORMAT_R8G8_UNORM;
+        case 61: return VK_FORMAT_R8_UNORM;
+        case 71: return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case 72: return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        case 74: return VK_FORMAT_BC2_UNORM_BLOCK;
+        case 75: return VK_FORMAT_BC2_SRGB_BLOCK;
+        case 77: return VK_FORMAT_BC3_UNORM_BLOCK;
+        case 78: return VK_FORMAT_BC3_SRGB_BLOCK;
+        case 80: return VK_FORMAT_BC4_UNORM_BLOCK;
+        case 81: return VK_FORMAT_BC4_SNORM_BLOCK;
+        case 83: return VK_FORMAT_BC5_UNORM_BLOCK;
+        case 84: return VK_FORMAT_BC5_SNORM_BLOCK;
+        case 87: return VK_FORMAT_B8G8R8A8_UNORM;
+        case 91: return VK_FORMAT_B8G8R8A8_SRGB;
+        case 95: return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case 96: return VK_FORMAT_BC6H_SFLOAT_BLOCK;
+        case 98: return VK_FORMAT_BC7_UNORM_BLOCK;
+        case 99: return VK_FORMAT_BC7_SRGB_BLOCK;
+        default: return VK_FORMAT_UNDEFINED;
+        }
+    }
+
+    VkFormat formatFromPixelFormat(const uint8_t* pixelFormat)
+    {
+        uint32_t flags = readU32(pixelFormat + 4);
+        uint32_t code = readU32(pixelFormat + 8);
+        uint32_t bitCount = readU32(pixelFormat + 12);
+        uint32_t redMask = readU32(pixelFormat + 16);
+        uint32_t blueMask = readU32(pixelFormat + 24);
+
+        if (flags & DdsFourCCFlag) {
+            switch (code) {
+            case fourCC('D', 'X', 'T', '1'): return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+            case fourCC('D', 'X', 'T', '2'):
+            case fourCC('D', 'X', 'T', '3'): return VK_FORMAT_BC2_UNORM_BLOCK;
+            case fourCC('D', 'X', 'T', '4'):
+            case fourCC('D', 'X', 'T', '5'): return VK_FORMAT_BC3_UNORM_BLOCK;
+            case fourCC('A', 'T', 'I', '1'):
+            case fourCC('B', 'C', '4', 'U'): return VK_FORMAT_BC4_UNORM_BLOCK;
+            case fourCC('B', 'C', '4', 'S'): return VK_FORMAT_BC4_SNORM_BLOCK;
+            case fourCC('A', 'T', 'I', '2'):
+            case fourCC('B', 'C', '5', 'U'): return VK_FORMAT_BC5_UNORM_BLOCK;
+            case fourCC('B', 'C', '5', 'S'): return VK_FORMAT_BC5_SNORM_BLOCK;
+            case 113: return VK_FORMAT_R16G16B16A16_SFLOAT; // D3DFMT_A16B16G16R16F
+            case 116: return VK_FORMAT_R32G32B32A32_SFLOAT; // D3DFMT_A32B32G32R32F
+            default: return VK_FORMAT_UNDEFINED;
+            }
+        }
+        if ((flags & DdsRgbFlag) && bitCount == 32) {
+            if (redMask == 0x000000FF && blueMask == 0x00FF0000) {
+                return VK_FORMAT_R8G8B8A8_UNORM;
+            }
+            if (redMask == 0x00FF0000 && blueMask == 0x000000FF) {
+                return VK_FORMAT_B8G8R8A8_UNORM;
+            }
+        }
+        if ((flags & DdsLuminanceFlag) && bitCount == 8) {
+            return VK_FORMAT_R8_UNORM;
+        }
+        return VK_FORMAT_UNDEFINED;
+    }
+
+    TextureData readDdsHeader(const std::string& path)
+    {
+        uint64_t fileSize = 0;
+        std::vector<uint8_t> header = readPrefix(path, DdsHeaderSize + DdsDx10HeaderSize, fileSize);
+        if (header.size() < DdsHeaderSize || readU32(&header[0]) != fourCC('D', 'D', 'S', ' ') || readU32(&header[4]) != 124) {
+            throw std::runtime_error("failed to load '" + path + "': not a DDS file!");
+        }
+
+        TextureData texture;
+        texture.path = path;
+        texture.height = readU32(&header[12]);
+        texture.width = readU32(&header[16]);
+        uint32_t flags = readU32(&header[8]);
+        uint32_t levelCount = (flags & DdsMipMapCountFlag) ? std::max(readU32(&header[28]), 1u) : 1;
+        uint32_t caps2 = readU32(&header[112]);
+        if (caps2 & (DdsCubemapFlag | DdsVolumeFlag)) {
+            throw std::runtime_error("failed to load '" + path + "': only single 2D textures are supported!");
+        }
+        if (levelCount > 32) {
+            throw std::runtime_error("failed to load '" + path + "': invalid mip count!");
+        }
+
+        uint64_t dataOffset = DdsHeaderSize;
+        const uint8_t* pixelFormat = &header[76];
+        if ((readU32(pixelFormat + 4) & DdsFourCCFlag) && readU32(pixelFormat + 8) == fourCC('D', 'X', '1', '0')) {
+            if (header.size() < DdsHeaderSize + DdsDx10HeaderSize) {
+                throw std::runtime_error("failed to load '" + path + "': truncated DX10 header!");
+            }
+            uint32_t dimension = readU32(&header[132]);
+            uint32_t arraySize = readU32(&header[140]);
+            if (dimension != 3 || arraySize > 1) { // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+                throw std::runtime_error("failed to load '" + path + "': only single 2D textures are supported!");
+            }
+            texture.format = formatFromDxgi(readU32(&header[128]));
+            dataOffset += DdsDx10HeaderSize;
+        } else {
+            texture.format = formatFromPixelFormat(pixelFormat);
+        }
+        if (texture.format == VK_FORMAT_UNDEFINED) {
+            throw std::runtime_error("failed to load '" + path + "': unsupported DDS pixel format!");
+        }
+
+        // The levels follow the header back to back, most detailed first
+        TextureFormatInfo info = TextureFormatInfo::Get(texture.format);
+        texture.levels.resize(levelCount);
+        for (uint32_t i = 0; i < levelCount; i++) {
+            texture.levels[i].fileOffset = dataOffset;
+            texture.levels[i].size = info.GetLevelSize(std::max(texture.width >> i, 1u), std::max(texture.height >> i, 1u));
+            dataOffset += texture.levels[i].size;
+        }
+        describeLevels(texture, fileSize);
+        return texture;
+    }
+
+    // =================================================================================
+    // Block Decoding
+    // =================================================================================
+
+    // Decodes the color part of a BC1-BC3 block into 16 RGBA texels.
+    void decodeColorBlock(const uint8_t* block, bool allowTransparent, uint8_t* texels)
+    {
+        uint16_t c0 = static_cast<uint16_t>(block[0] | block[1] << 8);
+        uint16_t c1 = static_cast<uint16_t>(block[2] | block[3] << 8);
+        uint8_t palette[4][4];
+        auto expand = [](uint16_t c, uint8_t* out) {
+            out[0] = static_cast<uint8_t>(((c >> 11) & 31) * 255 / 31);
+            out[1] = static_cast<uint8_t>(((c >> 5) & 63) * 255 / 63);
+            out[2] = static_cast<uint8_t>((c & 31) * 255 / 31);
+            out[3] = 255;
+        };
+        expand(c0, palette[0]);
+        expand(c1, palette[1]);
+        for (int channel = 0; channel < 3; channel++) {
+            if (c0 > c1 || !allowTransparent) {
+                palette[2][channel] = static_cast<uint8_t>((2 * palette[0][channel] + palette[1][channel]) / 3);
+                palette[3][channel] = static_cast<uint8_t>((palette[0][channel] + 2 * palette[1][channel]) / 3);
+            } else {
+                palette[2][channel] = static_cast<uint8_t>((palette[0][channel] + palette[1][channel]) / 2);
+                palette[3][channel] = 0;
+            }
+        }
+        palette[2][3] = 255;
+        palette[3][3] = (c0 > c1 || !allowTransparent) ? 255 : 0;
+
+        uint32_t indices = readU32(block + 4);
+        for (int i = 0; i < 16; i++) {
+            std::memcpy(texels + i * 4, palette[(indices >> (2 * i)) & 3], 4);
+        }
+    }
+
+    // Decodes a BC4 block (also the alpha of BC3 and each channel of BC5) into 16 values.
+    // Signed blocks are written as two's complement bytes, for an R8G8B8A8_SNORM target.
+    void decodeChannelBlock(const uint8_t* block, bool isSigned, uint8_t* values, size_t stride)
+    {
+        // -128 and -127 both mean -1.0 in SNORM, so the endpoints are clamped before interpolating
+        int a0 = isSigned ? std::max<int>(static_cast<int8_t>(block[0]), -127) : block[0];
+        int a1 = isSigned ? std::max<int>(static_cast<int8_t>(block[1]), -127) : block[1];
+        int palette[8] = { a0, a1 };
+        if (a0 > a1) {
+            for (int i = 1; i < 7; i++) {
+                palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+            }
+        } else {
+            for (int i = 1; i < 5; i++) {
+                palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+            }
+            palette[6] = isSigned ? -127 : 0;
+            palette[7] = isSigned ? 127 : 255;
+        }
+
+        uint64_t indices = 0;
+        for (int i = 0; i < 6; i++) {
+            indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+        }
+        for (int i = 0; i < 16; i++) {
+            values[i * stride] = static_cast<uint8_t>(palette[(indices >> (3 * i)) & 7]);
+        }
+    }
+
+    // Decodes one block of any BC1-BC5 format into 16 RGBA texels.
+    void decodeBlock(VkFormat format, const uint8_t* block, uint8_t* texels)
+    {
+        switch (format) {
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            decodeColorBlock(block, false, texels);
+            break;
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            decodeColorBlock(block, true, texels);
+            break;
+        case VK_FORMAT_BC2_UNORM_BLOCK:
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+            decodeColorBlock(block + 8, false, texels);
+            for (int i = 0; i < 16; i++) {
+                texels[i * 4 + 3] = static_cast<uint8_t>(((block[i / 2] >> (4 * (i % 2))) & 15) * 17);
+            }
+            break;
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+            decodeColorBlock(block + 8, false, texels);
+            decodeChannelBlock(block, false, texels + 3, 4);
+            break;
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+        case VK_FORMAT_BC4_SNORM_BLOCK:
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+        case VK_FORMAT_BC5_SNORM_BLOCK: {
+            bool isSigned = format == VK_FORMAT_BC4_SNORM_BLOCK || format == VK_FORMAT_BC5_SNORM_BLOCK;
+            bool twoChannels = format == VK_FORMAT_BC5_UNORM_BLOCK || format == VK_FORMAT_BC5_SNORM_BLOCK;
+            for (int i = 0; i < 16; i++) {
+                texels[i * 4 + 1] = 0;
+                texels[i * 4 + 2] = 0;
+                texels[i * 4 + 3] = isSigned ? 127 : 255;
+            }
+            decodeChannelBlock(block, isSigned, texels, 4);
+            if (twoChannels) {
+                decodeChannelBlock(block + 8, isSigned, texels + 1, 4);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // Picks the RGBA8 format that keeps the meaning of a block format's values.
+    VkFormat decodedFormat(VkFormat format)
+    {
+        switch (format) {
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+            return VK_FORMAT_R8G8B8A8_SRGB;
+        case VK_FORMAT_BC4_SNORM_BLOCK:
+        case VK_FORMAT_BC5_SNORM_BLOCK:
+            return VK_FORMAT_R8G8B8A8_SNORM;
+        default:
+            return VK_FORMAT_R8G8B8A8_UNORM;
+        }
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+bool TextureImporter::IsSupported(const std::string& path)
+{
+    std::string extension = GetPathExtension(path);
+    return extension == ".ktx2" || extension == ".dds";
+}
+
+TextureData TextureImporter::ReadHeader(const std::string& path)
+{
+    std::string extension = GetPathExtension(path);
+    TextureData texture;
+    if (extension == ".ktx2") {
+        texture = readKtx2Header(path);
+    } else if (extension == ".dds") {
+        texture = readDdsHeader(path);
+    } else {
+        throw std::runtime_error("failed to load '" + path + "': unsupported texture format!");
+    }
+    texture.name = GetPathStem(path);
+    return texture;
+}
+
+void TextureImporter::ReadLevels(TextureData& texture, uint32_t firstLevel, uint32_t levelCount)
+{
+    ENGINE_PROFILE_FUNCTION();
+    std::ifstream file(texture.path, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("failed to open texture file '" + texture.path + "'!");
+    }
+    uint32_t lastLevel = std::min<uint32_t>(firstLevel + levelCount, static_cast<uint32_t>(texture.levels.size()));
+    for (uint32_t i = firstLevel; i < lastLevel; i++) {
+        TextureLevel& level = texture.levels[i];
+        level.data.resize(static_cast<size_t>(level.size));
+        file.seekg(static_cast<std::streamoff>(level.fileOffset));
+        file.read(reinterpret_cast<char*>(level.data.data()), static_cast<std::streamsize>(level.size));
+        if (!file) {
+            throw std::runtime_error("failed to read mip level " + std::to_string(i) + " of '" + texture.path + "'!");
+        }
+    }
+}
+
+bool TextureImporter::Decompress(TextureData& texture)
+{
+    ENGINE_PROFILE_FUNCTION();
+    VkFormat format = texture.format;
+    if (TextureFormatInfo::Get(format).blockWidth != 4 || (format >= VK_FORMAT_BC6H_UFLOAT_BLOCK && format <= VK_FORMAT_BC7_SRGB_BLOCK)) {
+        return false;
+    }
+
+    // Levels that were never read cannot be decoded later, so the chain ends at the first of them
+    size_t decodedCount = 0;
+    while (decodedCount < texture.levels.size() && !texture.levels[decodedCount].data.empty()) {
+        decodedCount++;
+    }
+    texture.levels.resize(decodedCount);
+
+    const TextureFormatInfo rgba = TextureFormatInfo::Get(VK_FORMAT_R8G8B8A8_UNORM);
+    for (TextureLevel& level : texture.levels) {
+        std::vector<uint8_t> pixels(static_cast<size_t>(rgba.GetLevelSize(level.width, level.height)));
+        uint32_t blocksWide = (level.width + 3) / 4;
+        uint32_t blocksHigh = (level.height + 3) / 4;
+        uint32_t blockBytes = TextureFormatInfo::Get(format).blockBytes;
+        uint8_t texels[16 * 4];
+        for (uint32_t by = 0; by < blocksHigh; by++) {
+            for (uint32_t bx = 0; bx < blocksWide; bx++) {
+                decodeBlock(format, &level.data[(static_cast<size_t>(by) * blocksWide + bx) * blockBytes], texels);
+                // Blocks overhanging the edge of small levels only write the texels inside it
+                for (uint32_t y = 0; y < 4 && by * 4 + y < level.height; y++) {
+                    for (uint32_t x = 0; x < 4 && bx * 4 + x < level.width; x++) {
+                        size_t dst = (static_cast<size_t>(by * 4 + y) * level.width + bx * 4 + x) * 4;
+                        std::memcpy(&pixels[dst], &texels[(y * 4 + x) * 4], 4);
+                    }
+                }
+            }
+        }
+        level.data = std::move(pixels);
+        level.size = level.data.size();
+        level.fileOffset = 0;
+    }
+    texture.format = decodedFormat(format);
+    Log::GetCoreLogger()->info("Decoded '{0}' to RGBA8 on the CPU ({1} levels).", texture.name, texture.levels.size());
+    return true;
+}
@@ -0,0 +1,617 @@
+#include "EngineCore/Assets/TextureStreamer.hpp"
+#include "EngineCore/Assets/TextureImporter.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Vulkan/BindlessTable.hpp"
+#include "EngineCore/Vulkan/DeletionQueue.hpp"
+#include "EngineCore/Vulkan/UploadQueue.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace
+{
+    /// The shader stages textures are read from.
+    constexpr VkPipelineStageFlags ShaderStages = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+    bool isSampleable(VkPhysicalDevice physicalDevice, VkFormat format, bool textureCompressionBC)
+    {
+        if (TextureFormatInfo::Get(format).IsCompressed() && !textureCompressionBC) {
+            return false;
+        }
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &properties);
+        return (properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0;
+    }
+
+    bool canGenerateMips(VkPhysicalDevice physicalDevice, VkFormat format)
+    {
+        constexpr VkFormatFeatureFlags required = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT |
+            VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, format, &properties);
+        return (properties.optimalTilingFeatures & required) == required;
+    }
+
+    VkImageMemoryBarrier imageBarrier(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout,
+        VkAccessFlags srcAccess, VkAccessFlags dstAccess, uint32_t baseLevel, uint32_t levelCount)
+    {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.oldLayout = oldLayout;
+        barrier.newLayout = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, baseLevel, levelCount, 0, 1 };
+        return barrier;
+    }
+
+    uint32_t levelExtent(uint32_t size, uint32_t level)
+    {
+        return std::max(1u, size >> level);
+    }
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+TextureStreamer::TextureStreamer(const TextureStreamerCreateInfo& createInfo)
+    : m_device(createInfo.device),
+      m_physicalDevice(createInfo.physicalDevice),
+      m_allocator(*createInfo.allocator),
+      m_uploads(*createInfo.uploadQueue),
+      m_threadPool(*createInfo.threadPool),
+      m_graphicsQueue(createInfo.graphicsQueue),
+      m_deletionQueue(*createInfo.deletionQueue),
+      m_textureCompressionBC(createInfo.textureCompressionBC),
+      m_budget(createInfo.budget),
+      m_bindless(createInfo.bindless)
+{
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = createInfo.graphicsFamily;
+    if (vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create texture streaming command pool!");
+    }
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_LINEAR;
+    samplerInfo.minFilter = VK_FILTER_LINEAR;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.maxLod = VK_LOD_CLAMP_NONE;
+    samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &m_sampler) != VK_SUCCESS) {
+        vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+        throw std::runtime_error("failed to create texture sampler!");
+    }
+}
+
+TextureStreamer::~TextureStreamer()
+{
+    // Read jobs only own copies of their inputs, so unfinished ones are simply abandoned
+    for (const auto& texture : m_textures) {
+        if (m_bindless) {
+            m_bindless->ReleaseTexture(texture->bindlessIndex);
+        }
+        vkDestroyImageView(m_device, texture->view, nullptr);
+        m_allocator.DestroyImage(texture->image, texture->memory);
+        m_allocator.DestroyImage(texture->pendingImage, texture->pendingMemory);
+    }
+
+    vkDestroyFence(m_device, m_recording.fence, nullptr);
+    for (const CommandBatch& batch : m_submitted) {
+        vkDestroyFence(m_device, batch.fence, nullptr);
+    }
+    for (const CommandBatch& batch : m_freeBatches) {
+        vkDestroyFence(m_device, batch.fence, nullptr);
+    }
+    vkDestroySampler(m_device, m_sampler, nullptr);
+    vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+TextureHandle TextureStreamer::LoadAsync(const std::string& path)
+{
+    auto texture = std::make_unique<Texture>();
+    texture->data.path = path;
+    texture->data.name = path;
+    texture->changing = true;
+
+    VkPhysicalDevice physicalDevice = m_physicalDevice;
+    bool textureCompressionBC = m_textureCompressionBC;
+    texture->reading = m_threadPool.Submit([path, physicalDevice, textureCompressionBC]() {
+        ENGINE_PROFILE_SCOPE("TextureStreamer::load");
+        return readInitialLevels(path, physicalDevice, textureCompressionBC);
+    }, JobPriority::Background);
+
+    m_textures.push_back(std::move(texture));
+    return static_cast<TextureHandle>(m_textures.size());
+}
+
+void TextureStreamer::Request(TextureHandle handle, uint32_t level)
+{
+    Texture* texture = find(handle);
+    if (texture) {
+        texture->lastUsedFrame = m_frame;
+        texture->requestedLevel = std::min(texture->requestedLevel, level);
+    }
+}
+
+void TextureStreamer::Update()
+{
+    ENGINE_PROFILE_FUNCTION();
+    m_uploads.Update();
+
+    while (!m_submitted.empty() && vkGetFenceStatus(m_device, m_submitted.front().fence) == VK_SUCCESS) {
+        m_freeBatches.push_back(m_submitted.front());
+        m_submitted.pop_front();
+    }
+
+    m_staged = false;
+    for (const auto& texture : m_textures) {
+        if (texture->reading.valid() && texture->reading.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            finishReading(*texture);
+        }
+        if (texture->pendingImage != VK_NULL_HANDLE && !texture->reading.valid() && m_uploads.IsAvailable(texture->uploadBatch)) {
+            finishChange(*texture);
+        }
+    }
+
+    updateResidency();
+
+    // Everything staged this frame goes to the GPU as one batch
+    if (m_staged) {
+        m_uploads.Submit();
+    }
+    if (m_recording.commandBuffer != VK_NULL_HANDLE) {
+        submitCommands();
+    }
+
+    for (const auto& texture : m_textures) {
+        texture->requestedLevel = UINT32_MAX;
+    }
+    m_frame++;
+}
+
+TextureState TextureStreamer::GetState(TextureHandle handle) const
+{
+    const Texture* texture = find(handle);
+    return texture ? texture->state : TextureState::Invalid;
+}
+
+VkImageView TextureStreamer::GetImageView(TextureHandle handle) const
+{
+    const Texture* texture = find(handle);
+    return texture && texture->state == TextureState::Ready ? texture->view : VK_NULL_HANDLE;
+}
+
+uint32_t TextureStreamer::GetBindlessIndex(TextureHandle handle) const
+{
+    const Texture* texture = find(handle);
+    return texture && texture->state == TextureState::Ready ? texture->bindlessIndex : BindlessTable::DefaultTexture;
+}
+
+TextureInfo TextureStreamer::GetInfo(TextureHandle handle) const
+{
+    TextureInfo info;
+    const Texture* texture = find(handle);
+    if (!texture) {
+        return info;
+    }
+
+    info.name = texture->data.name;
+    info.state = texture->state;
+    info.format = texture->data.format;
+    info.width = texture->data.width;
+    info.height = texture->data.height;
+    info.levelCount = texture->levelCount;
+    info.residentLevel = texture->residentLevel;
+    info.tailLevel = texture->tailLevel;
+    info.streamable = texture->streamable;
+    info.residentBytes = texture->memory.size;
+    return info;
+}
+
+const std::string& TextureStreamer::GetError(TextureHandle handle) const
+{
+    static const std::string none;
+    const Texture* texture = find(handle);
+    return texture ? texture->error : none;
+}
+
+TextureStreamerStats TextureStreamer::GetStats() const
+{
+    TextureStreamerStats stats;
+    stats.textureCount = GetTextureCount();
+    stats.budget = m_budget;
+    stats.streamedLevels = m_streamedLevels;
+    stats.evictedLevels = m_evictedLevels;
+    for (const auto& texture : m_textures) {
+        stats.residentBytes += texture->memory.size;
+        stats.streamingCount += texture->changing && texture->state == TextureState::Ready;
+    }
+    return stats;
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+TextureStreamer::LoadedLevels TextureStreamer::readInitialLevels(const std::string& path, VkPhysicalDevice physicalDevice, bool textureCompressionBC)
+{
+    LoadedLevels loaded;
+    TextureData& data = loaded.data;
+    data = TextureImporter::ReadHeader(path);
+    const uint32_t fileLevels = static_cast<uint32_t>(data.levels.size());
+    const TextureFormatInfo format = TextureFormatInfo::Get(data.format);
+
+    if (!isSampleable(physicalDevice, data.format, textureCompressionBC)) {
+        if (!format.IsCompressed()) {
+            throw std::runtime_error("failed to load texture: the device cannot sample its format!");
+        }
+        // Decoded levels cannot be read from the file again, so all of them stay resident
+        TextureImporter::ReadLevels(data, 0, fileLevels);
+        if (!TextureImporter::Decompress(data)) {
+            throw std::runtime_error("failed to load texture: its block compression cannot be decoded on the CPU!");
+        }
+    } else if (fileLevels == 1) {
+        TextureImporter::ReadLevels(data, 0, 1);
+    } else {
+        // Only the tail comes now; the detailed levels are read once they are requested
+        uint32_t tail = 0;
+        while (tail + 1 < fileLevels && std::max(data.levels[tail].width, data.levels[tail].height) > TailSize) {
+            tail++;
+        }
+        TextureImporter::ReadLevels(data, tail, fileLevels - tail);
+        loaded.firstLevel = tail;
+    }
+
+    loaded.generateMips = data.levels.size() == 1 && data.GetFullMipCount() > 1 &&
+        !TextureFormatInfo::Get(data.format).IsCompressed() && canGenerateMips(physicalDevice, data.format);
+    return loaded;
+}
+
+TextureStreamer::Texture* TextureStreamer::find(TextureHandle handle) const
+{
+    return handle > 0 && handle <= m_textures.size() ? m_textures[handle - 1].get() : nullptr;
+}
+
+void TextureStreamer::finishReading(Texture& texture)
+{
+    try {
+        LoadedLevels loaded = texture.reading.get();
+        if (texture.state == TextureState::Loading) {
+            texture.data = std::move(loaded.data);
+            texture.generateMips = loaded.generateMips;
+            texture.streamable = loaded.firstLevel > 0;
+            texture.tailLevel = loaded.firstLevel;
+            texture.levelCount = texture.generateMips ? texture.data.GetFullMipCount() : static_cast<uint32_t>(texture.data.levels.size());
+            texture.residentLevel = texture.levelCount;
+        } else {
+            for (uint32_t level = loaded.firstLevel; level < texture.residentLevel; level++) {
+                texture.data.levels[level].data = std::move(loaded.data.levels[level].data);
+            }
+            m_streamedLevels += texture.residentLevel - loaded.firstLevel;
+        }
+        startChange(texture, loaded.firstLevel);
+    }
+    catch (const std::exception& e) {
+        m_allocator.DestroyImage(texture.pendingImage, texture.pendingMemory);
+        for (TextureLevel& level : texture.data.levels) {
+            level.data = std::vector<uint8_t>();
+        }
+        texture.changing = false;
+        if (texture.state == TextureState::Loading) {
+            texture.state = TextureState::Failed;
+            texture.error = e.what();
+            Log::GetCoreLogger()->error("Loading texture '{0}' failed: {1}", texture.data.name, texture.error);
+        } else {
+            // Keep what is resident rather than retrying the same read every frame
+            texture.streamable = false;
+            Log::GetCoreLogger()->warn("Streaming texture '{0}' failed, keeping level {1}: {2}", texture.data.name, texture.residentLevel, e.what());
+        }
+    }
+}
+
+void TextureStreamer::startChange(Texture& texture, uint32_t level)
+{
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = texture.data.format;
+    imageInfo.extent = { levelExtent(texture.data.width, level), levelExtent(texture.data.height, level), 1 };
+    imageInfo.mipLevels = texture.levelCount - level;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    m_allocator.CreateImage(imageInfo, GpuAllocationInfo{}, texture.pendingImage, texture.pendingMemory);
+    texture.pendingLevel = level;
+    texture.changing = true;
+    texture.uploadBatch = 0;
+
+    // Levels that are not resident yet come from the file; finishChange() fills in the rest on the GPU
+    const uint32_t uploadEnd = std::min(texture.residentLevel, static_cast<uint32_t>(texture.data.levels.size()));
+    if (level >= uploadEnd) {
+        return;
+    }
+
+    const uint32_t blockHeight = TextureFormatInfo::Get(texture.data.format).blockHeight;
+    m_uploads.BeginImage(texture.pendingImage, 0, uploadEnd - level);
+    for (uint32_t i = level; i < uploadEnd; i++) {
+        TextureLevel& source = texture.data.levels[i];
+        m_uploads.UploadImage(source.data.data(), source.data.size(), texture.pendingImage, i - level, source.width, source.height, blockHeight);
+        source.data = std::vector<uint8_t>();
+    }
+    m_uploads.FinishImage(texture.pendingImage, 0, uploadEnd - level,
+        texture.generateMips ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    texture.uploadBatch = m_uploads.GetRecordingBatch();
+    m_staged = true;
+}
+
+void TextureStreamer::finishChange(Texture& texture)
+{
+    const uint32_t levelCount = texture.levelCount - texture.pendingLevel;
+    const uint32_t copyLevel = std::max(texture.pendingLevel, texture.residentLevel);
+
+    if (texture.generateMips) {
+        // Each level is blitted from the one above it, which is then left in TRANSFER_SRC_OPTIMAL for the next
+        VkCommandBuffer commandBuffer = getCommandBuffer();
+        VkImageMemoryBarrier toDst = imageBarrier(texture.pendingImage, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            0, VK_ACCESS_TRANSFER_WRITE_BIT, 1, levelCount - 1);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toDst);
+
+        for (uint32_t level = 1; level < levelCount; level++) {
+            VkImageBlit blit{};
+            blit.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level - 1, 0, 1 };
+            blit.srcOffsets[1] = { static_cast<int32_t>(levelExtent(texture.data.width, level - 1)),
+                static_cast<int32_t>(levelExtent(texture.data.height, level - 1)), 1 };
+            blit.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+            blit.dstOffsets[1] = { static_cast<int32_t>(levelExtent(texture.data.width, level)),
+                static_cast<int32_t>(levelExtent(texture.data.height, level)), 1 };
+            vkCmdBlitImage(commandBuffer, texture.pendingImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                texture.pendingImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+
+            VkImageMemoryBarrier toSrc = imageBarrier(texture.pendingImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, level, 1);
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &toSrc);
+        }
+
+        VkImageMemoryBarrier toRead = imageBarrier(texture.pendingImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, 0, levelCount);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, ShaderStages, 0, 0, nullptr, 0, nullptr, 1, &toRead);
+    } else if (texture.image != VK_NULL_HANDLE && copyLevel < texture.levelCount) {
+        // Levels both images hold are copied over on the GPU instead of being read again
+        VkCommandBuffer commandBuffer = getCommandBuffer();
+        const uint32_t copyCount = texture.levelCount - copyLevel;
+        const uint32_t srcBase = copyLevel - texture.residentLevel;
+        const uint32_t dstBase = copyLevel - texture.pendingLevel;
+
+        VkImageMemoryBarrier toTransfer[2] = {
+            imageBarrier(texture.image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                0, VK_ACCESS_TRANSFER_READ_BIT, srcBase, copyCount),
+            imageBarrier(texture.pendingImage, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                0, VK_ACCESS_TRANSFER_WRITE_BIT, dstBase, copyCount),
+        };
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 2, toTransfer);
+
+        std::vector<VkImageCopy> regions(copyCount);
+        for (uint32_t i = 0; i < copyCount; i++) {
+            VkImageCopy& region = regions[i];
+            region.srcSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, srcBase + i, 0, 1 };
+            region.dstSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, dstBase + i, 0, 1 };
+            region.extent = { levelExtent(texture.data.width, copyLevel + i), levelExtent(texture.data.height, copyLevel + i), 1 };
+        }
+        vkCmdCopyImage(commandBuffer, texture.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            texture.pendingImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, copyCount, regions.data());
+
+        VkImageMemoryBarrier toRead = imageBarrier(texture.pendingImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, dstBase, copyCount);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, ShaderStages, 0, 0, nullptr, 0, nullptr, 1, &toRead);
+    }
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = texture.pendingImage;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = texture.data.format;
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, levelCount, 0, 1 };
+    VkImageView view = VK_NULL_HANDLE;
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &view) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create texture image view!");
+    }
+
+    // The old image may still be sampled by frames in flight or read by the copy above
+    m_deletionQueue.DestroyImageView(texture.view);
+    m_deletionQueue.DestroyImage(texture.image, texture.memory);
+    texture.image = texture.pendingImage;
+    texture.memory = texture.pendingMemory;
+    texture.view = view;
+    if (m_bindless) {
+        // The old slot is only reused once no frame can read it, like the old image
+        m_bindless->ReleaseTexture(texture.bindlessIndex);
+        texture.bindlessIndex = m_bindless->RegisterTexture(view, m_sampler);
+    }
+    texture.pendingImage = VK_NULL_HANDLE;
+    texture.pendingMemory = GpuAllocation();
+    texture.changing = false;
+    if (texture.pendingLevel > texture.residentLevel) {
+        m_evictedLevels += texture.pendingLevel - texture.residentLevel;
+    }
+    texture.residentLevel = texture.pendingLevel;
+
+    if (texture.state == TextureState::Loading) {
+        texture.state = TextureState::Ready;
+        Log::GetCoreLogger()->info("Texture '{0}' is ready ({1}x{2}, {3} levels from level {4}{5}).", texture.data.name,
+            texture.data.width, texture.data.height, texture.levelCount, texture.residentLevel,
+            texture.generateMips ? ", mips generated" : "");
+    }
+}
+
+void TextureStreamer::updateResidency()
+{
+    // The memory in use once every change in flight has finished
+    VkDeviceSize committed = 0;
+    uint32_t streaming = 0;
+    for (const auto& texture : m_textures) {
+        committed += estimateBytes(*texture, texture->changing ? texture->pendingLevel : texture->residentLevel);
+        streaming += texture->changing && texture->state == TextureState::Ready;
+    }
+
+    for (const auto& texture : m_textures) {
+        if (streaming >= MaxConcurrentStreams) {
+            break;
+        }
+        if (texture->state != TextureState::Ready || !texture->streamable || texture->changing ||
+            texture->requestedLevel >= texture->residentLevel) {
+            continue;
+        }
+
+        // Evict unused textures to make room, and settle for less detail if that is not enough
+        const VkDeviceSize current = estimateBytes(*texture, texture->residentLevel);
+        uint32_t level = texture->requestedLevel;
+        for (; level < texture->residentLevel; level++) {
+            VkDeviceSize needed = committed + estimateBytes(*texture, level) - current;
+            if (needed > m_budget) {
+                committed -= evictFor(needed - m_budget, texture.get());
+            }
+            if (committed + estimateBytes(*texture, level) - current <= m_budget) {
+                break;
+            }
+        }
+        if (level == texture->residentLevel) {
+            continue;
+        }
+
+        committed += estimateBytes(*texture, level) - current;
+        streaming++;
+        texture->changing = true;
+        texture->pendingLevel = level;
+
+        // The level index is all the worker needs; the texels of resident levels were dropped after upload
+        uint32_t levelCount = texture->residentLevel - level;
+        texture->reading = m_threadPool.Submit([data = texture->data, level, levelCount]() mutable {
+            ENGINE_PROFILE_SCOPE("TextureStreamer::stream");
+            TextureImporter::ReadLevels(data, level, levelCount);
+            LoadedLevels loaded;
+            loaded.data = std::move(data);
+            loaded.firstLevel = level;
+            return loaded;
+        }, JobPriority::Background);
+    }
+
+    // The budget may have been lowered below what is resident
+    if (committed > m_budget) {
+        evictFor(committed - m_budget, nullptr);
+    }
+}
+
+VkDeviceSize TextureStreamer::evictFor(VkDeviceSize bytes, const Texture* requester)
+{
+    // Least recently used first; textures requested this frame are kept
+    std::vector<Texture*> victims;
+    for (const auto& texture : m_textures) {
+        if (texture.get() != requester && texture->state == TextureState::Ready && texture->streamable && !texture->changing &&
+            texture->residentLevel < texture->tailLevel && texture->lastUsedFrame < m_frame) {
+            victims.push_back(texture.get());
+        }
+    }
+    std::sort(victims.begin(), victims.end(), [](const Texture* a, const Texture* b) {
+        return a->lastUsedFrame < b->lastUsedFrame;
+    });
+
+    VkDeviceSize freed = 0;
+    for (Texture* victim : victims) {
+        if (freed >= bytes) {
+            break;
+        }
+        const VkDeviceSize current = estimateBytes(*victim, victim->residentLevel);
+        uint32_t level = victim->residentLevel;
+        while (level < victim->tailLevel && freed + current - estimateBytes(*victim, level) < bytes) {
+            level++;
+        }
+        freed += current - estimateBytes(*victim, level);
+
+        // Nothing to read, so the smaller image is copied out of the current one right away
+        startChange(*victim, level);
+        finishChange(*victim);
+    }
+    return freed;
+}
+
+VkDeviceSize TextureStreamer::estimateBytes(const Texture& texture, uint32_t level) const
+{
+    const TextureFormatInfo format = TextureFormatInfo::Get(texture.data.format);
+    VkDeviceSize bytes = 0;
+    for (uint32_t i = level; i < texture.levelCount; i++) {
+        bytes += format.GetLevelSize(levelExtent(texture.data.width, i), levelExtent(texture.data.height, i));
+    }
+    return bytes;
+}
+
+VkCommandBuffer TextureStreamer::getCommandBuffer()
+{
+    if (m_recording.commandBuffer != VK_NULL_HANDLE) {
+        return m_recording.commandBuffer;
+    }
+
+    if (!m_freeBatches.empty()) {
+        m_recording = m_freeBatches.back();
+        m_freeBatches.pop_back();
+        vkResetFences(m_device, 1, &m_recording.fence);
+        vkResetCommandBuffer(m_recording.commandBuffer, 0);
+    } else {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = m_commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        if (vkAllocateCommandBuffers(m_device, &allocInfo, &m_recording.commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate texture streaming command buffer!");
+        }
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(m_device, &fenceInfo, nullptr, &m_recording.fence) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create texture streaming fence!");
+        }
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(m_recording.commandBuffer, &beginInfo);
+    return m_recording.commandBuffer;
+}
+
+void TextureStreamer::submitCommands()
+{
+    vkEndCommandBuffer(m_recording.commandBuffer);
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &m_recording.commandBuffer;
+    if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, m_recording.fence) != VK_SUCCESS) {
+        throw std::runtime_error("failed to submit texture streaming commands!");
+    }
+
+    m_submitted.push_back(m_recording);
+    m_recording = CommandBatch();
+}
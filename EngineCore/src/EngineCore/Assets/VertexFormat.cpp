@@ -0,0 +1,165 @@
+#include "EngineCore/Assets/VertexFormat.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+static_assert(sizeof(PackedVertex) == 12, "PackedVertex must match the vertex input description");
+
+namespace
+{
+    uint8_t toUnorm8(float value)
+    {
+        return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+
+    uint16_t toSnorm16(float value)
+    {
+        return static_cast<uint16_t>(static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f)));
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+uint32_t VertexFormat::GetStride(VertexLayout layout)
+{
+    return layout == VertexLayout::Float ? sizeof(Vertex) : sizeof(PackedVertex);
+}
+
+const char* VertexFormat::GetName(VertexLayout layout)
+{
+    switch (layout) {
+    case VertexLayout::Half: return "half";
+    case VertexLayout::Snorm16: return "snorm16";
+    default: return "float";
+    }
+}
+
+bool VertexFormat::Parse(const std::string& name, VertexLayout& layout)
+{
+    for (uint32_t i = 0; i < VertexLayoutCount; i++) {
+        if (name == GetName(static_cast<VertexLayout>(i))) {
+            layout = static_cast<VertexLayout>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void VertexFormat::GetInputDescription(VertexLayout layout, uint32_t binding, std::vector<VkVertexInputBindingDescription>& bindings,
+                                       std::vector<VkVertexInputAttributeDescription>& attributes)
+{
+    VkVertexInputBindingDescription bindingDescription{};
+    bindingDescription.binding = binding;
+    bindingDescription.stride = GetStride(layout);
+    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+    bindings.push_back(bindingDescription);
+
+    VkVertexInputAttributeDescription position{};
+    position.binding = binding;
+    position.location = 0; // layout(location = 0) in shader
+    VkVertexInputAttributeDescription color{};
+    color.binding = binding;
+    color.location = 1; // layout(location = 1) in shader
+
+    // Four-component 16-bit and 8-bit formats are required for vertex buffers; the three-component ones are not
+    switch (layout) {
+    case VertexLayout::Float:
+        position.format = VK_FORMAT_R32G32B32_SFLOAT;
+        position.offset = offsetof(Vertex, pos);
+        color.format = VK_FORMAT_R32G32B32_SFLOAT;
+        color.offset = offsetof(Vertex, color);
+        break;
+    case VertexLayout::Half:
+        position.format = VK_FORMAT_R16G16B16A16_SFLOAT;
+        position.offset = offsetof(PackedVertex, position);
+        color.format = VK_FORMAT_R8G8B8A8_UNORM;
+        color.offset = offsetof(PackedVertex, color);
+        break;
+    case VertexLayout::Snorm16:
+        position.format = VK_FORMAT_R16G16B16A16_SNORM;
+        position.offset = offsetof(PackedVertex, position);
+        color.format = VK_FORMAT_R8G8B8A8_UNORM;
+        color.offset = offsetof(PackedVertex, color);
+        break;
+    }
+    attributes.push_back(position);
+    attributes.push_back(color);
+}
+
+VertexQuantization VertexFormat::Pack(VertexLayout layout, const Vertex* vertices, size_t count, const Aabb& bounds,
+                                      std::vector<PackedVertex>& packed)
+{
+    ENGINE_PROFILE_FUNCTION();
+    if (layout == VertexLayout::Float) {
+        throw std::runtime_error("failed to pack vertices: the float layout is not packed!");
+    }
+
+    // Centering halves the magnitudes half floats have to hold, which doubles their precision;
+    // snorm16 additionally spreads its 65535 steps over each axis's extent
+    VertexQuantization quantization;
+    const glm::vec3 center = bounds.Center();
+    const glm::vec3 extent = glm::max((bounds.max - bounds.min) * 0.5f, glm::vec3(1e-20f));
+    quantization.offset = glm::vec4(center, 0.0f);
+    if (layout == VertexLayout::Snorm16) {
+        quantization.scale = glm::vec4(extent, 1.0f);
+    }
+    const glm::vec3 inverseScale = 1.0f / glm::vec3(quantization.scale);
+
+    packed.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        const glm::vec3 position = (vertices[i].pos - center) * inverseScale;
+        PackedVertex& out = packed[i];
+        for (int axis = 0; axis < 3; axis++) {
+            out.position[axis] = layout == VertexLayout::Half ? FloatToHalf(position[axis]) : toSnorm16(position[axis]);
+            out.color[axis] = toUnorm8(vertices[i].color[axis]);
+        }
+        out.position[3] = 0;
+        out.color[3] = 255;
+    }
+    return quantization;
+}
+
+uint16_t VertexFormat::FloatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xffu) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffffu;
+
+    if (((bits >> 23) & 0xffu) == 0xffu) {
+        return static_cast<uint16_t>(sign | 0x7c00u | (mantissa ? 0x200u : 0u)); // Infinity or NaN
+    }
+    if (exponent >= 31) {
+        return static_cast<uint16_t>(sign | 0x7c00u); // Too large: infinity
+    }
+    if (exponent <= 0) {
+        // Subnormal half (or zero): shift the mantissa with its implicit bit into place
+        if (exponent < -10) {
+            return static_cast<uint16_t>(sign);
+        }
+        mantissa |= 0x800000u;
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // A carry out of the mantissa correctly bumps the exponent, up to infinity
+    uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+        half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
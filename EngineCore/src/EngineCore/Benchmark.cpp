@@ -0,0 +1,97 @@
+#include "EngineCore/Benchmark.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+
+namespace
+{
+    // Returns the nearest-rank percentile of an already sorted, non-empty sample set.
+    double percentile(const std::vector<double>& sorted, double fraction)
+    {
+        size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+        rank = std::clamp<size_t>(rank, 1, sorted.size());
+        return sorted[rank - 1];
+    }
+}
+
+// =================================================================================
+// TimingSummary
+// =================================================================================
+
+TimingSummary TimingSummary::FromSamples(std::vector<double> samples)
+{
+    TimingSummary summary;
+    if (samples.empty()) {
+        return summary;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    summary.count = samples.size();
+    summary.average = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    summary.minimum = samples.front();
+    summary.maximum = samples.back();
+    summary.median = percentile(samples, 0.50);
+    summary.p95 = percentile(samples, 0.95);
+    summary.p99 = percentile(samples, 0.99);
+    return summary;
+}
+
+// =================================================================================
+// BenchmarkReport
+// =================================================================================
+
+BenchmarkReport::BenchmarkReport(std::string name)
+    : m_name(std::move(name))
+{
+}
+
+void BenchmarkReport::AddValue(const std::string& key, double value)
+{
+    m_values.emplace_back(key, value);
+}
+
+void BenchmarkReport::AddTiming(const std::string& key, const TimingSummary& summary)
+{
+    m_timings.emplace_back(key, summary);
+}
+
+void BenchmarkReport::Log() const
+{
+    Log::GetCoreLogger()->info("--- Benchmark '{0}' ---", m_name);
+    for (const auto& [key, value] : m_values) {
+        Log::GetCoreLogger()->info("  {0}: {1:.3f}", key, value);
+    }
+    for (const auto& [key, t] : m_timings) {
+        Log::GetCoreLogger()->info("  {0}: avg {1:.3f} | min {2:.3f} | p50 {3:.3f} | p95 {4:.3f} | p99 {5:.3f} | max {6:.3f} ({7} samples)",
+            key, t.average, t.minimum, t.median, t.p95, t.p99, t.maximum, t.count);
+    }
+}
+
+bool BenchmarkReport::WriteJson(const std::string& path) const
+{
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        Log::GetCoreLogger()->error("Failed to write benchmark report: {0}", path);
+        return false;
+    }
+
+    file << "{\n  \"name\": \"" << m_name << "\",\n  \"values\": {";
+    for (size_t i = 0; i < m_values.size(); i++) {
+        file << (i ? "," : "") << "\n    \"" << m_values[i].first << "\": " << m_values[i].second;
+    }
+    file << "\n  },\n  \"timings\": {";
+    for (size_t i = 0; i < m_timings.size(); i++) {
+        const TimingSummary& t = m_timings[i].second;
+        file << (i ? "," : "") << "\n    \"" << m_timings[i].first << "\": { "
+             << "\"count\": " << t.count << ", \"avg\": " << t.average << ", \"min\": " << t.minimum
+             << ", \"p50\": " << t.median << ", \"p95\": " << t.p95 << ", \"p99\": " << t.p99
+             << ", \"max\": " << t.maximum << " }";
+    }
+    file << "\n  }\n}\n";
+
+    Log::GetCoreLogger()->info("Benchmark report written to '{0}'", path);
+    return true;
+}
@@ -76,6 +76,23 @@ void Camera::ProcessMouseZoom(float delta)
     recalculateMatrices();
 }
 
+void Camera::Focus(const glm::vec3& target, float distance)
+{
+    m_target = target;
+    m_distance = std::max(distance, 1.0f);
+    m_movementSpeed = std::max(5.0f, m_distance * 0.5f); // Large scenes need faster keyboard movement
+    recalculateMatrices();
+}
+
+void Camera::SetAspectRatio(float aspectRatio)
+{
+    if (!(aspectRatio > 0.0f) || aspectRatio == m_aspectRatio) {
+        return;
+    }
+    m_aspectRatio = aspectRatio;
+    recalculateMatrices();
+}
+
 void Camera::OnEvent(Event& e)
 {
     EventDispatcher dispatcher(e);
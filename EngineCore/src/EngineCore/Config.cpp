@@ -0,0 +1,334 @@
+#include "EngineCore/Config.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Assets/VertexFormat.hpp"
+#include "EngineCore/Rendering/Upscaler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    // Removes leading and trailing whitespace from a string.
+    std::string trim(const std::string& str)
+    {
+        const char* whitespace = " \t\r\n";
+        size_t begin = str.find_first_not_of(whitespace);
+        if (begin == std::string::npos) {
+            return {};
+        }
+        size_t end = str.find_last_not_of(whitespace);
+        return str.substr(begin, end - begin + 1);
+    }
+
+    // Parses an unsigned integer, returning false on malformed or out-of-range input.
+    bool parseUInt(const std::string& text, uint32_t& out)
+    {
+        // std::stoul negates "-1" into ULONG_MAX instead of failing
+        if (text.find('-') != std::string::npos) {
+            return false;
+        }
+        try {
+            size_t consumed = 0;
+            unsigned long long value = std::stoull(text, &consumed);
+            if (consumed != text.size() || value > std::numeric_limits<uint32_t>::max()) {
+                return false;
+            }
+            out = static_cast<uint32_t>(value);
+            return true;
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    // Parses a floating-point number, returning false on malformed input.
+    bool parseFloat(const std::string& text, float& out)
+    {
+        try {
+            size_t consumed = 0;
+            float value = std::stof(text, &consumed);
+            if (consumed != text.size()) {
+                return false;
+            }
+            out = value;
+            return true;
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    // Parses a boolean; an empty value counts as "true" so flags can be given without one.
+    bool parseBool(const std::string& text, bool& out)
+    {
+        if (text.empty() || text == "1" || text == "true" || text == "yes" || text == "on") {
+            out = true;
+            return true;
+        }
+        if (text == "0" || text == "false" || text == "no" || text == "off") {
+            out = false;
+            return true;
+        }
+        return false;
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+bool EngineConfig::LoadFromFile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    Log::GetCoreLogger()->info("Loading config from '{0}'...", path);
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        line = trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        size_t separator = line.find('=');
+        if (separator == std::string::npos) {
+            Log::GetCoreLogger()->warn("{0}:{1}: expected 'key = value'", path, lineNumber);
+            continue;
+        }
+
+        std::string key = trim(line.substr(0, separator));
+        std::string value = trim(line.substr(separator + 1));
+        if (!set(key, value)) {
+            Log::GetCoreLogger()->warn("{0}:{1}: ignoring setting '{2}'", path, lineNumber, key);
+        }
+    }
+    return true;
+}
+
+void EngineConfig::ApplyCommandLine(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--", 0) != 0) {
+            Log::GetCoreLogger()->warn("Ignoring command line argument '{0}'", arg);
+            continue;
+        }
+        arg = arg.substr(2);
+
+        // Accept both "--key=value" and "--key value"
+        std::string key, value;
+        size_t separator = arg.find('=');
+        if (separator != std::string::npos) {
+            key = arg.substr(0, separator);
+            value = arg.substr(separator + 1);
+        } else {
+            key = arg;
+            // The next argument is the value unless it is another option (boolean flags)
+            if (i + 1 < argc && std::string(argv[i + 1]).rfind("--", 0) != 0) {
+                value = argv[++i];
+            }
+        }
+
+        if (!set(key, value)) {
+            Log::GetCoreLogger()->warn("Ignoring command line option '--{0}'", key);
+        }
+    }
+}
+
+void EngineConfig::Validate()
+{
+    uint32_t clamped = std::clamp(framesInFlight, MinFramesInFlight, MaxFramesInFlight);
+    if (clamped != framesInFlight) {
+        Log::GetCoreLogger()->warn("frames-in-flight {0} is out of range [{1}, {2}], using {3}",
+            framesInFlight, MinFramesInFlight, MaxFramesInFlight, clamped);
+        framesInFlight = clamped;
+    }
+
+    if (frameDataMegabytes == 0 || frameDataMegabytes > 256) {
+        Log::GetCoreLogger()->warn("frame-data-mb {0} is out of range [1, 256], using 8", frameDataMegabytes);
+        frameDataMegabytes = 8;
+    }
+
+    if (stagingRingMegabytes == 0 || stagingRingMegabytes > 1024) {
+        Log::GetCoreLogger()->warn("staging-ring-mb {0} is out of range [1, 1024], using 32", stagingRingMegabytes);
+        stagingRingMegabytes = 32;
+    }
+
+    if (uploadBudgetMegabytes == 0) {
+        Log::GetCoreLogger()->warn("upload-budget-mb must be positive, using 8");
+        uploadBudgetMegabytes = 8;
+    }
+
+    if (textureBudgetMegabytes == 0) {
+        Log::GetCoreLogger()->warn("texture-budget-mb must be positive, using 256");
+        textureBudgetMegabytes = 256;
+    }
+
+    if (instanceGrid > 100) {
+        Log::GetCoreLogger()->warn("instance-grid {0} exceeds 100 (one million instances), using 100", instanceGrid);
+        instanceGrid = 100;
+    }
+
+    if (instanceMesh != "cube" && instanceMesh != "sphere") {
+        Log::GetCoreLogger()->warn("instance-mesh '{0}' is unknown, using 'cube'", instanceMesh);
+        instanceMesh = "cube";
+    }
+
+    VertexLayout layout;
+    if (!VertexFormat::Parse(vertexLayout, layout)) {
+        Log::GetCoreLogger()->warn("vertex-layout '{0}' is unknown, using 'float'", vertexLayout);
+        vertexLayout = "float";
+    }
+
+    if (!(lodPixelError > 0.0f)) {
+        Log::GetCoreLogger()->warn("lod-pixel-error {0} must be positive, using 1", lodPixelError);
+        lodPixelError = 1.0f;
+    }
+
+    if (!(targetFrameMs > 0.0f)) {
+        Log::GetCoreLogger()->warn("target-frame-ms {0} must be positive, using 16", targetFrameMs);
+        targetFrameMs = 16.0f;
+    }
+
+    if (!(minRenderScale >= 0.25f && minRenderScale <= 1.0f)) {
+        Log::GetCoreLogger()->warn("min-render-scale {0} is out of range [0.25, 1], using 0.5", minRenderScale);
+        minRenderScale = 0.5f;
+    }
+
+    UpscalePreset preset;
+    if (!Upscaler::ParsePreset(upscalePreset, preset)) {
+        Log::GetCoreLogger()->warn("upscale-preset '{0}' is unknown, using 'off'", upscalePreset);
+        upscalePreset = "off";
+    }
+
+    if (sceneWidth == 0 || sceneHeight == 0) {
+        Log::GetCoreLogger()->warn("Scene size {0}x{1} is invalid, using 1280x720", sceneWidth, sceneHeight);
+        sceneWidth = 1280;
+        sceneHeight = 720;
+    }
+    if (headless && benchmarkWarmupFrames >= benchmarkFrames) {
+        Log::GetCoreLogger()->warn("benchmark-warmup-frames ({0}) must be below benchmark-frames ({1}), disabling warmup",
+            benchmarkWarmupFrames, benchmarkFrames);
+        benchmarkWarmupFrames = 0;
+    }
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+bool EngineConfig::set(const std::string& key, const std::string& value)
+{
+    if (key == "frames-in-flight") {
+        return parseUInt(value, framesInFlight);
+    }
+    if (key == "frame-data-mb") {
+        return parseUInt(value, frameDataMegabytes);
+    }
+    if (key == "pipeline-cache") {
+        pipelineCachePath = value; // An empty value disables the on-disk cache
+        return true;
+    }
+    if (key == "asset-cache") {
+        assetCachePath = value; // An empty value imports every asset from scratch
+        return true;
+    }
+    if (key == "staging-ring-mb") {
+        return parseUInt(value, stagingRingMegabytes);
+    }
+    if (key == "upload-budget-mb") {
+        return parseUInt(value, uploadBudgetMegabytes);
+    }
+    if (key == "transfer-queue") {
+        return parseBool(value, transferQueue);
+    }
+    if (key == "texture-budget-mb") {
+        return parseUInt(value, textureBudgetMegabytes);
+    }
+    if (key == "bindless") {
+        return parseBool(value, bindless);
+    }
+    if (key == "mesh") {
+        meshPath = value;
+        return !value.empty();
+    }
+    if (key == "texture") {
+        texturePath = value;
+        return !value.empty();
+    }
+    if (key == "instance-grid") {
+        return parseUInt(value, instanceGrid);
+    }
+    if (key == "gpu-culling") {
+        return parseBool(value, gpuCulling);
+    }
+    if (key == "cpu-culling") {
+        return parseBool(value, cpuCulling);
+    }
+    if (key == "bvh-culling") {
+        return parseBool(value, bvhCulling);
+    }
+    if (key == "instance-mesh") {
+        instanceMesh = value;
+        return !value.empty();
+    }
+    if (key == "vertex-layout") {
+        vertexLayout = value;
+        return !value.empty();
+    }
+    if (key == "mesh-optimization") {
+        return parseBool(value, meshOptimization);
+    }
+    if (key == "lods") {
+        return parseBool(value, lods);
+    }
+    if (key == "lod-pixel-error") {
+        return parseFloat(value, lodPixelError);
+    }
+    if (key == "dynamic-resolution") {
+        return parseBool(value, dynamicResolution);
+    }
+    if (key == "target-frame-ms") {
+        return parseFloat(value, targetFrameMs);
+    }
+    if (key == "min-render-scale") {
+        return parseFloat(value, minRenderScale);
+    }
+    if (key == "upscale-preset") {
+        upscalePreset = value;
+        return !value.empty();
+    }
+    if (key == "cull-benchmark") {
+        return parseBool(value, cullBenchmark);
+    }
+    if (key == "headless") {
+        return parseBool(value, headless);
+    }
+    if (key == "benchmark-frames") {
+        return parseUInt(value, benchmarkFrames);
+    }
+    if (key == "benchmark-warmup-frames") {
+        return parseUInt(value, benchmarkWarmupFrames);
+    }
+    if (key == "benchmark-output") {
+        benchmarkOutput = value;
+        return !value.empty();
+    }
+    if (key == "cpu-trace") {
+        cpuTraceOutput = value;
+        return !value.empty();
+    }
+    if (key == "scene-width") {
+        return parseUInt(value, sceneWidth);
+    }
+    if (key == "scene-height") {
+        return parseUInt(value, sceneHeight);
+    }
+    return false;
+}
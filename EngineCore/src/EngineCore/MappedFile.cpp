@@ -0,0 +1,97 @@
+#include "EngineCore/MappedFile.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string& path)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("failed to open '" + path + "'!");
+    }
+    m_file = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        throw std::runtime_error("failed to map '" + path + "': the file is empty!");
+    }
+    m_size = static_cast<size_t>(size.QuadPart);
+
+    m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    m_data = m_mapping ? static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+    if (!m_data) {
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+        }
+        CloseHandle(file);
+        throw std::runtime_error("failed to map '" + path + "'!");
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+}
+#else
+MappedFile::MappedFile(const std::string& path)
+{
+    m_descriptor = open(path.c_str(), O_RDONLY);
+    if (m_descriptor < 0) {
+        throw std::runtime_error("failed to open '" + path + "'!");
+    }
+
+    struct stat status;
+    if (fstat(m_descriptor, &status) != 0 || status.st_size == 0) {
+        close(m_descriptor);
+        throw std::runtime_error("failed to map '" + path + "': the file is empty!");
+    }
+    m_size = static_cast<size_t>(status.st_size);
+
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_descriptor, 0);
+    if (data == MAP_FAILED) {
+        close(m_descriptor);
+        throw std::runtime_error("failed to map '" + path + "'!");
+    }
+    m_data = static_cast<const uint8_t*>(data);
+    madvise(data, m_size, MADV_SEQUENTIAL);
+}
+
+MappedFile::~MappedFile()
+{
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+    close(m_descriptor);
+}
+#endif
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void MappedFile::Prefetch() const
+{
+    // Page size is at least 4 KiB everywhere the engine runs; touching more often is harmless
+    constexpr size_t PageSize = 4096;
+    volatile uint8_t sink = 0;
+    for (size_t offset = 0; offset < m_size; offset += PageSize) {
+        sink = sink + m_data[offset];
+    }
+    sink = sink + m_data[m_size - 1];
+}
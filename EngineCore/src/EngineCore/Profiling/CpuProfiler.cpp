@@ -0,0 +1,152 @@
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    /// A completed zone.
+    struct Event {
+        const char* name;
+        uint64_t startNs;
+        uint64_t durationNs;
+    };
+
+    /// The ring buffer of one thread. Shared so it can still be dumped after the thread exits.
+    struct ThreadBuffer {
+        std::mutex mutex;          // Only ever contended while a trace is being written
+        std::vector<Event> events; // Ring storage, EventsPerThread entries
+        size_t next = 0;           // The slot the next event is written to
+        size_t count = 0;          // The number of valid events (saturates at the capacity)
+        uint32_t threadId = 0;
+        std::string threadName;
+    };
+
+    std::mutex s_registryMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> s_threadBuffers;
+    uint32_t s_nextThreadId = 1;
+
+    // Returns the calling thread's buffer, registering it on first use.
+    ThreadBuffer& threadBuffer()
+    {
+        thread_local std::shared_ptr<ThreadBuffer> t_buffer;
+        if (!t_buffer) {
+            t_buffer = std::make_shared<ThreadBuffer>();
+            t_buffer->events.resize(CpuProfiler::EventsPerThread);
+            std::lock_guard<std::mutex> lock(s_registryMutex);
+            t_buffer->threadId = s_nextThreadId++;
+            t_buffer->threadName = "Thread " + std::to_string(t_buffer->threadId);
+            s_threadBuffers.push_back(t_buffer);
+        }
+        return *t_buffer;
+    }
+
+    // Writes a string as a JSON string literal.
+    void writeJsonString(std::ofstream& file, const std::string& text)
+    {
+        file << '"';
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                file << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                file << ' ';
+            } else {
+                file << c;
+            }
+        }
+        file << '"';
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+uint64_t CpuProfiler::Now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void CpuProfiler::Record(const char* name, uint64_t startNs, uint64_t endNs)
+{
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.events[buffer.next] = { name, startNs, endNs - startNs };
+    buffer.next = (buffer.next + 1) % EventsPerThread;
+    buffer.count = std::min(buffer.count + 1, EventsPerThread);
+}
+
+void CpuProfiler::SetThreadName(const std::string& name)
+{
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+bool CpuProfiler::WriteChromeTrace(const std::string& path)
+{
+    // Snapshot every thread's ring so recording can continue while the file is written
+    struct ThreadSnapshot {
+        uint32_t threadId;
+        std::string threadName;
+        std::vector<Event> events;
+    };
+    std::vector<ThreadSnapshot> snapshots;
+    {
+        std::lock_guard<std::mutex> registryLock(s_registryMutex);
+        for (const auto& buffer : s_threadBuffers) {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            ThreadSnapshot snapshot{ buffer->threadId, buffer->threadName, {} };
+            snapshot.events.reserve(buffer->count);
+            size_t first = (buffer->next + EventsPerThread - buffer->count) % EventsPerThread;
+            for (size_t i = 0; i < buffer->count; i++) {
+                snapshot.events.push_back(buffer->events[(first + i) % EventsPerThread]);
+            }
+            snapshots.push_back(std::move(snapshot));
+        }
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        Log::GetCoreLogger()->error("Failed to write CPU trace: {0}", path);
+        return false;
+    }
+
+    // Timestamps are written relative to the oldest event, in microseconds
+    uint64_t origin = UINT64_MAX;
+    size_t eventCount = 0;
+    for (const ThreadSnapshot& snapshot : snapshots) {
+        for (const Event& event : snapshot.events) {
+            origin = std::min(origin, event.startNs);
+        }
+        eventCount += snapshot.events.size();
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const ThreadSnapshot& snapshot : snapshots) {
+        file << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << snapshot.threadId << ",\"args\":{\"name\":";
+        writeJsonString(file, snapshot.threadName);
+        file << "}}";
+        first = false;
+        for (const Event& event : snapshot.events) {
+            file << ",\n{\"name\":";
+            writeJsonString(file, event.name);
+            file << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << snapshot.threadId
+                 << ",\"ts\":" << (event.startNs - origin) / 1000.0
+                 << ",\"dur\":" << event.durationNs / 1000.0 << "}";
+        }
+    }
+    file << "\n]}\n";
+
+    Log::GetCoreLogger()->info("CPU trace with {0} events written to '{1}'", eventCount, path);
+    return true;
+}
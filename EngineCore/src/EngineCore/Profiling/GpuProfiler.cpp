@@ -0,0 +1,185 @@
+#include "EngineCore/Profiling/GpuProfiler.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+GpuProfiler::GpuProfiler(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, uint32_t framesInFlight)
+    : m_device(device)
+{
+    m_frameStats.name = "Frame";
+    m_frameStats.history.resize(HistoryLength, 0.0f);
+    m_frames.resize(framesInFlight);
+
+    // Timestamps are only meaningful if the queue family reports valid bits
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, families.data());
+    uint32_t validBits = queueFamilyIndex < familyCount ? families[queueFamilyIndex].timestampValidBits : 0;
+    if (validBits == 0) {
+        Log::GetCoreLogger()->warn("GPU profiler disabled: queue family {0} does not support timestamps.", queueFamilyIndex);
+        return;
+    }
+    m_timestampMask = validBits >= 64 ? ~0ull : ((1ull << validBits) - 1);
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    m_timestampPeriodNs = properties.limits.timestampPeriod;
+
+    VkQueryPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    poolInfo.queryCount = framesInFlight * MaxScopesPerFrame * 2; // A begin and an end query per scope
+    if (vkCreateQueryPool(m_device, &poolInfo, nullptr, &m_queryPool) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create timestamp query pool!");
+    }
+    Log::GetCoreLogger()->info("GPU profiler created ({0} scopes per frame, {1:.2f} ns per tick).", MaxScopesPerFrame, m_timestampPeriodNs);
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    if (m_queryPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(m_device, m_queryPool, nullptr);
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void GpuProfiler::BeginFrame(uint32_t frameIndex)
+{
+    m_currentFrame = frameIndex;
+    if (!IsSupported()) {
+        return;
+    }
+    // The caller has waited on this slot's fence, so its queries are complete
+    resolveFrame(frameIndex);
+}
+
+void GpuProfiler::BeginScope(VkCommandBuffer commandBuffer, const std::string& name)
+{
+    if (!IsSupported()) {
+        return;
+    }
+
+    FrameQueries& frame = m_frames[m_currentFrame];
+    uint32_t firstQuery = m_currentFrame * MaxScopesPerFrame * 2;
+    if (frame.needsReset) {
+        vkCmdResetQueryPool(commandBuffer, m_queryPool, firstQuery, MaxScopesPerFrame * 2);
+        frame.needsReset = false;
+    }
+    if (frame.scopeIndices.size() >= MaxScopesPerFrame) {
+        // Keep the scope stack balanced but don't record anything
+        frame.openScopes.push_back(UINT32_MAX);
+        return;
+    }
+
+    uint32_t pairIndex = static_cast<uint32_t>(frame.scopeIndices.size());
+    frame.scopeIndices.push_back(findOrAddScope(name));
+    frame.openScopes.push_back(pairIndex);
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_queryPool, firstQuery + pairIndex * 2);
+}
+
+void GpuProfiler::EndScope(VkCommandBuffer commandBuffer)
+{
+    if (!IsSupported()) {
+        return;
+    }
+
+    FrameQueries& frame = m_frames[m_currentFrame];
+    if (frame.openScopes.empty()) {
+        Log::GetCoreLogger()->error("GpuProfiler::EndScope called without a matching BeginScope.");
+        return;
+    }
+    uint32_t pairIndex = frame.openScopes.back();
+    frame.openScopes.pop_back();
+    if (pairIndex == UINT32_MAX) {
+        return; // The scope was dropped because the frame ran out of queries
+    }
+
+    uint32_t firstQuery = m_currentFrame * MaxScopesPerFrame * 2;
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPool, firstQuery + pairIndex * 2 + 1);
+}
+
+void GpuProfiler::CollectAll()
+{
+    if (!IsSupported()) {
+        return;
+    }
+    // Resolve the slots in submission order, oldest first
+    uint32_t frameCount = static_cast<uint32_t>(m_frames.size());
+    for (uint32_t i = 1; i <= frameCount; i++) {
+        resolveFrame((m_currentFrame + i) % frameCount);
+    }
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+void GpuProfiler::resolveFrame(uint32_t frameIndex)
+{
+    FrameQueries& frame = m_frames[frameIndex];
+    uint32_t scopeCount = static_cast<uint32_t>(frame.scopeIndices.size());
+    if (scopeCount > 0 && frame.openScopes.empty()) {
+        // Each query yields a value and an availability word
+        std::vector<uint64_t> results(scopeCount * 2 * 2);
+        uint32_t firstQuery = frameIndex * MaxScopesPerFrame * 2;
+        vkGetQueryPoolResults(m_device, m_queryPool, firstQuery, scopeCount * 2,
+            results.size() * sizeof(uint64_t), results.data(), 2 * sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+        uint64_t frameBegin = UINT64_MAX;
+        uint64_t frameEnd = 0;
+        for (uint32_t i = 0; i < scopeCount; i++) {
+            const uint64_t* begin = &results[i * 4];
+            const uint64_t* end = &results[i * 4 + 2];
+            if (begin[1] == 0 || end[1] == 0) {
+                continue; // Not available; never blocks, the sample is simply skipped
+            }
+            uint64_t beginTicks = begin[0] & m_timestampMask;
+            uint64_t endTicks = end[0] & m_timestampMask;
+            uint64_t ticks = endTicks >= beginTicks ? endTicks - beginTicks : 0;
+            addSample(m_scopes[frame.scopeIndices[i]], ticks * m_timestampPeriodNs * 1e-6);
+            frameBegin = std::min(frameBegin, beginTicks);
+            frameEnd = std::max(frameEnd, endTicks);
+        }
+        if (frameEnd > frameBegin) {
+            addSample(m_frameStats, (frameEnd - frameBegin) * m_timestampPeriodNs * 1e-6);
+        }
+    }
+
+    frame.scopeIndices.clear();
+    frame.openScopes.clear();
+    frame.needsReset = true;
+}
+
+void GpuProfiler::addSample(GpuScopeStats& stats, double milliseconds)
+{
+    stats.lastMilliseconds = milliseconds;
+    stats.history.erase(stats.history.begin());
+    stats.history.push_back(static_cast<float>(milliseconds));
+    if (m_recording) {
+        stats.recorded.push_back(milliseconds);
+    }
+}
+
+uint32_t GpuProfiler::findOrAddScope(const std::string& name)
+{
+    for (uint32_t i = 0; i < m_scopes.size(); i++) {
+        if (m_scopes[i].name == name) {
+            return i;
+        }
+    }
+    GpuScopeStats stats;
+    stats.name = name;
+    stats.history.resize(HistoryLength, 0.0f);
+    m_scopes.push_back(std::move(stats));
+    return static_cast<uint32_t>(m_scopes.size() - 1);
+}
@@ -1,13 +1,21 @@
 #include "EngineCore/Renderer.hpp"
 #include "EngineCore/Logger.hpp"
+#include "EngineCore/Profiling/GpuProfiler.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "EngineCore/Rendering/GpuCulling.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Scene/Frustum.hpp"
+#include "EngineCore/Vulkan/Shader.hpp"
+#include "EngineCore/Vulkan/UploadQueue.hpp"
 
-#include <backends/imgui_impl_vulkan.h>
 #include <glm/gtc/matrix_transform.hpp>
 
-#include <fstream>
 #include <stdexcept>
+#include <algorithm>
 #include <chrono>
 #include <array>
+#include <cmath>
+#include <limits>
 
 // =================================================================================
 // Cube Geometry
@@ -25,8 +33,8 @@ const std::vector<Vertex> cube_vertices = {
     {{-0.5f,  0.5f,  0.5f}, {0.5f, 0.5f, 0.5f}}  // 7: Gray
 };
 
-// Defines the indices for the 12 triangles that make up the cube.
-const std::vector<uint32_t> cube_indices = {
+// Defines the indices for the 12 triangles that make up the cube; 8 vertices fit in 16 bits.
+const std::vector<uint16_t> cube_indices = {
     0, 1, 2, 2, 3, 0, // Front face
     1, 5, 6, 6, 2, 1, // Right face
     5, 4, 7, 7, 6, 5, // Back face
@@ -39,15 +47,41 @@ const std::vector<uint32_t> cube_indices = {
 // Constructor and Destructor
 // =================================================================================
 
-Renderer::Renderer(VkDevice device, VkPhysicalDevice physicalDevice, VkCommandPool commandPool, VkQueue graphicsQueue, uint32_t framesInFlight, VkExtent2D swapChainExtent)
-    : m_device(device), 
-      m_physicalDevice(physicalDevice), 
-      m_commandPool(commandPool), 
-      m_graphicsQueue(graphicsQueue), 
-      m_framesInFlight(framesInFlight), 
-      m_sceneExtent(swapChainExtent)
+Renderer::Renderer(const RendererCreateInfo& createInfo)
+    : m_device(createInfo.device), 
+      m_physicalDevice(createInfo.physicalDevice), 
+      m_commandPool(createInfo.commandPool), 
+      m_graphicsQueue(createInfo.graphicsQueue), 
+      m_allocator(createInfo.allocator),
+      m_uploadQueue(createInfo.uploadQueue),
+      m_bindless(createInfo.bindless),
+      m_descriptorAllocator(createInfo.descriptorAllocator),
+      m_deletionQueue(createInfo.deletionQueue),
+      m_framesInFlight(createInfo.framesInFlight), 
+      m_frameDataBytes(createInfo.frameDataBytes),
+      m_sceneExtent(createInfo.sceneExtent),
+      m_renderExtent(createInfo.sceneExtent),
+      m_imGuiEnabled(createInfo.enableImGui),
+      m_profiler(createInfo.profiler),
+      m_threadPool(createInfo.threadPool),
+      m_pipelineCache(createInfo.pipelineCache),
+      m_features(createInfo.features),
+      m_gpuCullingEnabled(createInfo.enableGpuCulling),
+      m_cpuCullingAvailable(createInfo.enableCpuCulling),
+      m_cpuCullingEnabled(false),
+      m_bvhCullingEnabled(createInfo.enableBvhCulling),
+      m_lodEnabled(createInfo.enableLods),
+      m_cpuCulling(createInfo.threadPool)
 {
+    ENGINE_PROFILE_SCOPE("Renderer::Renderer");
     Log::GetCoreLogger()->info("Initializing Renderer...");
+    m_lodSelector.SetPixelError(createInfo.lodPixelError);
+    m_dynamicResolution.SetTargetMilliseconds(createInfo.targetFrameMilliseconds);
+    m_dynamicResolution.SetMinScale(createInfo.minRenderScale);
+    m_dynamicResolution.SetEnabled(createInfo.enableDynamicResolution && m_profiler && m_profiler->IsSupported());
+    if (createInfo.enableDynamicResolution && !m_dynamicResolution.IsEnabled()) {
+        Log::GetCoreLogger()->warn("Dynamic resolution needs GPU timestamps, rendering at full resolution.");
+    }
 
     // The order of creation is important due to dependencies.
     createRenderPass();
@@ -55,12 +89,11 @@ Renderer::Renderer(VkDevice device, VkPhysicalDevice physicalDevice, VkCommandPo
     createGraphicsPipeline();
     createFramebuffer();
     createCubeBuffers();
-    createUniformBuffers();
-    createDescriptorPool();
+    createFrameData();
     createDescriptorSets();
-    
-    // Register the offscreen texture with ImGui
-    m_sceneTextureId = (ImTextureID)ImGui_ImplVulkan_AddTexture(m_sceneSampler, m_sceneImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    createCommandBuffers();
+    createGpuCulling();
+    createUpscaler(createInfo.upscalePreset);
 }
 
 Renderer::~Renderer()
@@ -68,38 +101,38 @@ Renderer::~Renderer()
     Log::GetCoreLogger()->info("Destroying Renderer...");
     vkDeviceWaitIdle(m_device); // Ensure no operations are running
 
-    // Unregister the texture from ImGui
-    if (m_sceneTextureId) {
-        ImGui_ImplVulkan_RemoveTexture((VkDescriptorSet)m_sceneTextureId);
-        m_sceneTextureId = 0;
+    // Return the per-frame command buffers to the pool (the pool itself is owned by Application)
+    if (!m_commandBuffers.empty()) {
+        vkFreeCommandBuffers(m_device, m_commandPool, static_cast<uint32_t>(m_commandBuffers.size()), m_commandBuffers.data());
+        m_commandBuffers.clear();
     }
 
     // Destroy depth buffer resources
     vkDestroyImageView(m_device, m_depthImageView, nullptr);
-    vkDestroyImage(m_device, m_depthImage, nullptr);
-    vkFreeMemory(m_device, m_depthImageMemory, nullptr);
+    m_allocator->DestroyImage(m_depthImage, m_depthImageMemory);
 
     // Destroy resources in reverse order of creation
-    for (size_t i = 0; i < m_framesInFlight; i++) {
-        vkDestroyBuffer(m_device, m_uniformBuffers[i], nullptr);
-        vkFreeMemory(m_device, m_uniformBuffersMemory[i], nullptr);
-    }
+    m_upscaler.reset();
+    m_gpuCulling.reset();
+    m_frameData.reset();
 
-    vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
-    vkDestroyDescriptorSetLayout(m_device, m_descriptorSetLayout, nullptr);
 
-    vkDestroyBuffer(m_device, m_indexBuffer, nullptr);
-    vkFreeMemory(m_device, m_indexBufferMemory, nullptr);
-    vkDestroyBuffer(m_device, m_vertexBuffer, nullptr);
-    vkFreeMemory(m_device, m_vertexBufferMemory, nullptr);
+    m_allocator->DestroyBuffer(m_lodStateBuffer, m_lodStateBufferMemory);
+    m_allocator->DestroyBuffer(m_meshBuffer, m_meshBufferMemory);
+    m_allocator->DestroyBuffer(m_boundsBuffer, m_boundsBufferMemory);
+    m_allocator->DestroyBuffer(m_instanceBuffer, m_instanceBufferMemory);
+    m_allocator->DestroyBuffer(m_cubeMesh.indexBuffer, m_cubeMesh.indexMemory);
+    m_allocator->DestroyBuffer(m_cubeMesh.vertexBuffer, m_cubeMesh.vertexMemory);
 
     vkDestroySampler(m_device, m_sceneSampler, nullptr);
     vkDestroyImageView(m_device, m_sceneImageView, nullptr);
-    vkDestroyImage(m_device, m_sceneImage, nullptr);
-    vkFreeMemory(m_device, m_sceneImageMemory, nullptr);
+    m_allocator->DestroyImage(m_sceneImage, m_sceneImageMemory);
     vkDestroyFramebuffer(m_device, m_sceneFramebuffer, nullptr);
     vkDestroyRenderPass(m_device, m_sceneRenderPass, nullptr);
-    vkDestroyPipeline(m_device, m_graphicsPipeline, nullptr);
+    for (uint32_t layout = 0; layout < VertexLayoutCount; layout++) {
+        vkDestroyPipeline(m_device, m_graphicsPipelines[layout], nullptr);
+        vkDestroyPipeline(m_device, m_instancedPipelines[layout], nullptr);
+    }
     vkDestroyPipelineLayout(m_device, m_pipelineLayout, nullptr);
 }
 
@@ -107,26 +140,85 @@ Renderer::~Renderer()
 // Public Methods
 // =================================================================================
 
-void Renderer::Render(uint32_t currentFrame)
+VkCommandBuffer Renderer::Render(uint32_t currentFrame)
 {
-    // Update the uniform buffer with the latest transformation matrices
-    updateUniformBuffer(currentFrame);
+    ENGINE_PROFILE_FUNCTION();
+
+    // Buffer uploads staged since the last frame are submitted ahead of this frame's commands. On a
+    // dedicated transfer queue they must also have been handed over to the graphics queue before use.
+    m_uploadQueue->Submit();
+    m_uploadQueue->WaitAvailable(m_uploadBatch);
+
+    // Rewind this frame's partition of the ring buffer (its fence has been waited on) and
+    // write the latest transformation matrices into it
+    m_frameData->BeginFrame(currentFrame);
+    m_bindless->BeginFrame(currentFrame);
+    uint32_t uniformOffset = updateUniformBuffer();
+
+    // The profiler has just resolved the frame this slot rendered last time; its GPU time sets the
+    // size of the part of the scene image shaded now, which the UI stretches over the viewport
+    if (m_dynamicResolution.IsEnabled() && m_profiler) {
+        m_dynamicResolution.Update(m_profiler->GetFrameStats().lastMilliseconds);
+    }
+    m_renderExtent = DynamicResolution::ScaleExtent(m_sceneExtent, getRenderScale());
+
+    // The UI samples the scene through a set of this frame's transient pools, so recreating the
+    // image never invalidates a set a frame in flight still reads (there is no UI in headless mode)
+    if (m_imGuiEnabled && m_upscaler->IsActive()) {
+        m_sceneTextureId = (ImTextureID)m_descriptorAllocator->AllocateTransientTexture(m_sceneSampler, m_upscaler->GetOutputView(),
+            Upscaler::OutputLayout);
+    } else if (m_imGuiEnabled) {
+        m_sceneTextureId = (ImTextureID)m_descriptorAllocator->AllocateTransientTexture(m_sceneSampler, m_sceneImageView,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
 
-    // This function uses a temporary command buffer for rendering the offscreen scene.
-    // This is simple but less optimal than reusing command buffers.
-    // For a single offscreen pass, it's an acceptable approach.
-    VkCommandBufferAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandPool = m_commandPool;
-    allocInfo.commandBufferCount = 1;
-    VkCommandBuffer commandBuffer;
-    vkAllocateCommandBuffers(m_device, &allocInfo, &commandBuffer);
+    bool instanced = m_instanceCount > 0;
+    bool culled = instanced && IsGpuCullingActive();
+    if (m_gpuCulling) {
+        m_gpuCulling->BeginFrame(currentFrame);
+    }
+
+    // Without GPU culling, the visible instances are culled and gathered on the CPU, grouped by
+    // level of detail; without any culling, all instances use the finest level
+    VkBuffer instanceBuffer = m_instanceBuffer;
+    VkDeviceSize instanceOffset = 0;
+    std::fill(m_lodInstanceCounts.begin(), m_lodInstanceCounts.end(), 0u);
+    if (instanced && !culled) {
+        if (IsCpuCullingActive()) {
+            cullInstancesOnCpu(instanceBuffer, instanceOffset);
+        } else {
+            m_lodInstanceCounts[0] = m_instanceCount;
+        }
+    }
+
+    // Re-record the persistent command buffer of this frame slot. The caller has already
+    // waited on this slot's fence, so the buffer is no longer in use by the GPU.
+    VkCommandBuffer commandBuffer = m_commandBuffers[currentFrame];
+    vkResetCommandBuffer(commandBuffer, 0);
 
     VkCommandBufferBeginInfo beginInfo{};
     beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
     beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("failed to begin recording scene command buffer!");
+    }
+
+    // Cull before the render pass: the compute pass writes the indirect draw commands
+    if (culled) {
+        ENGINE_PROFILE_SCOPE("Culling");
+        uint32_t cullOffset = updateCullParams();
+        if (m_profiler) {
+            m_profiler->BeginScope(commandBuffer, "Culling");
+        }
+        m_gpuCulling->Dispatch(commandBuffer, currentFrame, cullOffset);
+        if (m_profiler) {
+            m_profiler->EndScope(commandBuffer);
+        }
+    }
+
+    if (m_profiler) {
+        m_profiler->BeginScope(commandBuffer, "Scene");
+    }
 
     // Begin the render pass for the offscreen framebuffer
     VkRenderPassBeginInfo renderPassInfo{};
@@ -134,7 +226,7 @@ void Renderer::Render(uint32_t currentFrame)
     renderPassInfo.renderPass = m_sceneRenderPass;
     renderPassInfo.framebuffer = m_sceneFramebuffer;
     renderPassInfo.renderArea.offset = {0, 0};
-    renderPassInfo.renderArea.extent = m_sceneExtent;
+    renderPassInfo.renderArea.extent = m_renderExtent;
 
     std::array<VkClearValue, 2> clearValues{};
     clearValues[0].color = {{0.05f, 0.05f, 0.05f, 1.0f}};
@@ -144,50 +236,76 @@ void Renderer::Render(uint32_t currentFrame)
 
     vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
         
-        // Bind the graphics pipeline
-        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_graphicsPipeline);
+        // Bind the instanced pipeline when a scene has been uploaded, otherwise draw the single cube
+        const uint32_t layout = static_cast<uint32_t>(m_mesh->vertexLayout);
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, instanced ? m_instancedPipelines[layout] : m_graphicsPipelines[layout]);
         
         // Set dynamic viewport and scissor states
         VkViewport viewport{};
         viewport.x = 0.0f;
         viewport.y = 0.0f;
-        viewport.width = static_cast<float>(m_sceneExtent.width);
-        viewport.height = static_cast<float>(m_sceneExtent.height);
+        viewport.width = static_cast<float>(m_renderExtent.width);
+        viewport.height = static_cast<float>(m_renderExtent.height);
         viewport.minDepth = 0.0f;
         viewport.maxDepth = 1.0f;
         vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
         
         VkRect2D scissor{};
         scissor.offset = {0, 0};
-        scissor.extent = m_sceneExtent;
+        scissor.extent = m_renderExtent;
         vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
 
-        // Bind vertex and index buffers
-        VkBuffer vertexBuffers[] = {m_vertexBuffer};
-        VkDeviceSize offsets[] = {0};
-        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
-        vkCmdBindIndexBuffer(commandBuffer, m_indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+        // Bind vertex and index buffers (binding 1 holds the per-instance data)
+        VkBuffer vertexBuffers[] = {m_mesh->vertexBuffer, instanceBuffer};
+        VkDeviceSize offsets[] = {0, instanceOffset};
+        vkCmdBindVertexBuffers(commandBuffer, 0, instanced ? 2 : 1, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(commandBuffer, m_mesh->indexBuffer, 0, m_mesh->indexType);
         
-        // Bind the descriptor set for the current frame (contains the UBO)
-        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout, 0, 1, &m_descriptorSets[currentFrame], 0, nullptr);
+        // Bind the UBO descriptor at this frame's chunk of the ring buffer and the bindless table; the material
+        // only selects slots of the table, so no draw ever binds a set of its own
+        VkDescriptorSet descriptorSets[] = {m_descriptorSet, m_bindless->GetDescriptorSet(currentFrame)};
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout, 0, 2, descriptorSets, 1, &uniformOffset);
+        vkCmdPushConstants(commandBuffer, m_pipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(MaterialConstants), &m_material);
         
-        // Draw the indexed cube
-        vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(cube_indices.size()), 1, 0, 0, 0);
+        // Draw the mesh from the culling pass's commands, with one instanced draw per level of detail, or once
+        if (culled) {
+            m_gpuCulling->Draw(commandBuffer, currentFrame);
+        } else if (instanced) {
+            const std::vector<MeshLod>& lods = m_mesh->lods;
+            uint32_t firstInstance = 0;
+            for (size_t lod = 0; lod < m_lodInstanceCounts.size(); lod++) {
+                uint32_t count = m_lodInstanceCounts[lod];
+                if (count > 0) {
+                    vkCmdDrawIndexed(commandBuffer, lods[lod].indexCount, count, lods[lod].firstIndex, 0, firstInstance);
+                }
+                firstInstance += count;
+            }
+        } else {
+            vkCmdDrawIndexed(commandBuffer, m_mesh->lods[0].indexCount, 1, m_mesh->lods[0].firstIndex, 0, 0);
+        }
 
     vkCmdEndRenderPass(commandBuffer);
-    
-    vkEndCommandBuffer(commandBuffer);
-
-    // Submit the command buffer to the graphics queue
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &commandBuffer;
-    vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(m_graphicsQueue); // Wait for rendering to finish
-    
-    // Free the temporary command buffer
-    vkFreeCommandBuffers(m_device, m_commandPool, 1, &commandBuffer);
+
+    if (m_profiler) {
+        m_profiler->EndScope(commandBuffer);
+    }
+
+    // Stretches the rendered part over the whole scene extent for the UI
+    if (m_upscaler->IsActive()) {
+        if (m_profiler) {
+            m_profiler->BeginScope(commandBuffer, "Upscale");
+        }
+        m_upscaler->Dispatch(commandBuffer, m_sceneImage, m_sceneImageView, m_renderExtent);
+        if (m_profiler) {
+            m_profiler->EndScope(commandBuffer);
+        }
+    }
+    if (vkEndCommandBuffer(commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to record scene command buffer!");
+    }
+
+    // Submission is left to the caller so the scene pass can be batched with the UI pass
+    return commandBuffer;
 }
 
 void Renderer::SetViewProjection(const glm::mat4& view, const glm::mat4& projection)
@@ -196,29 +314,150 @@ void Renderer::SetViewProjection(const glm::mat4& view, const glm::mat4& project
     m_projectionMatrix = projection;
 }
 
+void Renderer::SetInstances(const std::vector<InstanceData>& instances)
+{
+    ENGINE_PROFILE_FUNCTION();
+    // The old buffers may still be read by frames in flight
+    m_deletionQueue->DestroyBuffer(m_instanceBuffer, m_instanceBufferMemory);
+    m_deletionQueue->DestroyBuffer(m_boundsBuffer, m_boundsBufferMemory);
+    m_deletionQueue->DestroyBuffer(m_meshBuffer, m_meshBufferMemory);
+    m_deletionQueue->DestroyBuffer(m_lodStateBuffer, m_lodStateBufferMemory);
+    m_instanceCount = 0;
+    m_instances.clear();
+    m_instanceBounds.Clear();
+    m_instanceLods.clear();
+    m_instanceBvh.Build({});
+    m_cpuCullingEnabled = false;
+    if (instances.empty()) {
+        if (m_gpuCulling) {
+            m_gpuCulling->SetScene(VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, VK_NULL_HANDLE);
+        }
+        return;
+    }
+
+    // The culling pass also reads the instances as a storage buffer
+    VkDeviceSize bufferSize = sizeof(InstanceData) * instances.size();
+    uploadBuffer(instances.data(), bufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, m_instanceBuffer, m_instanceBufferMemory);
+    m_instanceCount = static_cast<uint32_t>(instances.size());
+    m_instances = instances;
+    m_instanceLods.assign(instances.size(), 0);
+
+    // Every instance draws the same mesh, bounded by its sphere
+    const glm::vec4& meshSphere = m_mesh->boundingSphere;
+    if (m_cpuCullingAvailable) {
+        // Keep the spheres moved by each instance's model matrix
+        m_instanceBounds.Reserve(instances.size());
+        for (const InstanceData& instance : instances) {
+            const glm::mat4& model = instance.model;
+            float scale = std::max(glm::length(glm::vec3(model[0])), std::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+            m_instanceBounds.Add(glm::vec3(model * glm::vec4(glm::vec3(meshSphere), 1.0f)), meshSphere.w * scale);
+        }
+        m_cpuCullingEnabled = true;
+    }
+
+    // The BVH works on the tight boxes, which both culling and picking benefit from
+    std::vector<Aabb> boxes;
+    boxes.reserve(instances.size());
+    for (const InstanceData& instance : instances) {
+        boxes.push_back(m_mesh->bounds.Transformed(instance.model));
+    }
+    auto buildStart = std::chrono::steady_clock::now();
+    m_instanceBvh.Build(boxes, m_threadPool);
+    double buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+    Log::GetCoreLogger()->info("Built instance BVH: {0} nodes, depth {1}, {2:.2f} ms.", m_instanceBvh.GetNodeCount(), m_instanceBvh.GetDepth(), buildMs);
+
+    if (m_gpuCulling) {
+        ObjectBounds meshBounds{};
+        meshBounds.sphere = meshSphere;
+        meshBounds.lodCount = static_cast<uint32_t>(m_mesh->lods.size());
+        std::vector<ObjectBounds> bounds(instances.size(), meshBounds);
+        uploadBuffer(bounds.data(), sizeof(ObjectBounds) * bounds.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, m_boundsBuffer, m_boundsBufferMemory);
+
+        // One mesh table entry per level of detail, selected by the culling pass
+        std::vector<MeshDrawInfo> lods(m_mesh->lods.size());
+        for (size_t i = 0; i < lods.size(); i++) {
+            lods[i].indexCount = m_mesh->lods[i].indexCount;
+            lods[i].firstIndex = m_mesh->lods[i].firstIndex;
+            lods[i].error = m_mesh->lods[i].error;
+        }
+        uploadBuffer(lods.data(), sizeof(MeshDrawInfo) * lods.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, m_meshBuffer, m_meshBufferMemory);
+        std::vector<uint32_t> lodStates(instances.size(), 0);
+        uploadBuffer(lodStates.data(), sizeof(uint32_t) * lodStates.size(), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, m_lodStateBuffer, m_lodStateBufferMemory);
+
+        m_gpuCulling->SetScene(m_instanceBuffer, m_boundsBuffer, m_meshBuffer, m_lodStateBuffer, m_instanceCount, m_frameData->GetBuffer());
+    }
+    Log::GetCoreLogger()->info("Renderer uploaded {0} instances ({1} KiB).", m_instanceCount, bufferSize / 1024);
+}
+
+void Renderer::SetMesh(const GpuMesh* mesh)
+{
+    ENGINE_PROFILE_FUNCTION();
+    if (mesh && (mesh->vertexBuffer == VK_NULL_HANDLE || mesh->lods.empty())) {
+        throw std::runtime_error("failed to set mesh: it is not loaded!");
+    }
+    m_mesh = mesh ? mesh : &m_cubeMesh;
+    m_lodInstanceCounts.assign(m_mesh->lods.size(), 0);
+    Log::GetCoreLogger()->info("Renderer draws mesh '{0}' ({1} triangles, {2} LODs).", m_mesh->name, m_mesh->lods[0].indexCount / 3, m_mesh->lods.size());
+
+    // The instance bounds and the culling pass's mesh table depend on the mesh
+    if (!m_instances.empty()) {
+        std::vector<InstanceData> instances = std::move(m_instances);
+        SetInstances(instances);
+    }
+}
+
+uint32_t Renderer::GetVisibleCount() const
+{
+    if (m_instanceCount > 0 && IsGpuCullingActive()) {
+        return m_gpuCulling->GetVisibleCount();
+    }
+    return m_instanceCount > 0 && IsCpuCullingActive() ? m_cpuVisibleCount : m_instanceCount;
+}
+
+int Renderer::PickInstance(const glm::vec3& origin, const glm::vec3& direction) const
+{
+    if (m_instanceBvh.IsEmpty()) {
+        return -1;
+    }
+
+    // Hit distances stay comparable because the direction is transformed along with the origin
+    glm::mat4 toInstanceSpace = glm::inverse(getSceneTransform());
+    Ray ray;
+    ray.origin = glm::vec3(toInstanceSpace * glm::vec4(origin, 1.0f));
+    ray.direction = glm::vec3(toInstanceSpace * glm::vec4(direction, 0.0f));
+    RayHit hit;
+    return m_instanceBvh.Raycast(ray, hit) ? static_cast<int>(hit.objectIndex) : -1;
+}
+
+glm::vec2 Renderer::GetSceneUvScale() const
+{
+    if (m_upscaler->IsActive()) {
+        return { 1.0f, 1.0f };
+    }
+    return { static_cast<float>(m_renderExtent.width) / static_cast<float>(m_sceneExtent.width),
+             static_cast<float>(m_renderExtent.height) / static_cast<float>(m_sceneExtent.height) };
+}
+
 void Renderer::OnResize(VkExtent2D newSize)
 {
+    ENGINE_PROFILE_FUNCTION();
     Log::GetCoreLogger()->info("Renderer resizing scene to {0}x{1}...", newSize.width, newSize.height);
     m_sceneExtent = newSize;
-
-    vkDeviceWaitIdle(m_device);
-
-    // Destroy old resources that depend on size
-    ImGui_ImplVulkan_RemoveTexture((VkDescriptorSet)m_sceneTextureId);
-    vkDestroySampler(m_device, m_sceneSampler, nullptr);
-    vkDestroyImageView(m_device, m_sceneImageView, nullptr);
-    vkDestroyImage(m_device, m_sceneImage, nullptr);
-    vkFreeMemory(m_device, m_sceneImageMemory, nullptr);
-    vkDestroyImageView(m_device, m_depthImageView, nullptr);
-    vkDestroyImage(m_device, m_depthImage, nullptr);
-    vkFreeMemory(m_device, m_depthImageMemory, nullptr);
-    vkDestroyFramebuffer(m_device, m_sceneFramebuffer, nullptr);
+    m_renderExtent = DynamicResolution::ScaleExtent(m_sceneExtent, getRenderScale());
+
+    // Retire old resources that depend on size, which frames in flight may still render to or sample;
+    // the next Render() points the UI at the new image
+    m_sceneTextureId = 0;
+    m_deletionQueue->DestroySampler(m_sceneSampler);
+    m_deletionQueue->DestroyImageView(m_sceneImageView);
+    m_deletionQueue->DestroyImage(m_sceneImage, m_sceneImageMemory);
+    m_deletionQueue->DestroyImageView(m_depthImageView);
+    m_deletionQueue->DestroyImage(m_depthImage, m_depthImageMemory);
+    m_deletionQueue->DestroyFramebuffer(m_sceneFramebuffer);
 
     // Recreate them with the new size
     createFramebuffer();
-    
-    // Register the new texture with ImGui
-    m_sceneTextureId = (ImTextureID)ImGui_ImplVulkan_AddTexture(m_sceneSampler, m_sceneImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    m_upscaler->Resize(m_sceneExtent);
 }
 
 // =================================================================================
@@ -264,14 +503,26 @@ void Renderer::createRenderPass()
     subpass.pColorAttachments = &colorAttachmentRef;
     subpass.pDepthStencilAttachment = &depthAttachmentRef;
 
-    // Subpass dependency
-    VkSubpassDependency dependency{};
-    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-    dependency.dstSubpass = 0;
-    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-    dependency.srcAccessMask = 0;
-    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    // Subpass dependencies
+    std::array<VkSubpassDependency, 2> dependencies{};
+
+    // Incoming: the previous frame's UI pass may still be sampling the scene image, and the
+    // previous scene pass may still be writing depth. Wait for both before writing again.
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dependencies[0].srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+    // Outgoing: make the color writes visible to the UI pass, which samples the scene image
+    // in its fragment shader later in the same submission.
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
 
     // Render Pass
     std::array<VkAttachmentDescription, 2> attachments = {colorAttachment, depthAttachment};
@@ -281,8 +532,8 @@ void Renderer::createRenderPass()
     renderPassInfo.pAttachments = attachments.data();
     renderPassInfo.subpassCount = 1;
     renderPassInfo.pSubpasses = &subpass;
-    renderPassInfo.dependencyCount = 1;
-    renderPassInfo.pDependencies = &dependency;
+    renderPassInfo.dependencyCount = static_cast<uint32_t>(dependencies.size());
+    renderPassInfo.pDependencies = dependencies.data();
 
     if (vkCreateRenderPass(m_device, &renderPassInfo, nullptr, &m_sceneRenderPass) != VK_SUCCESS) {
         throw std::runtime_error("failed to create scene render pass!");
@@ -293,27 +544,63 @@ void Renderer::createDescriptorSetLayout()
 {
     VkDescriptorSetLayoutBinding uboLayoutBinding{};
     uboLayoutBinding.binding = 0; // Corresponds to "layout(binding = 0)" in the shader
-    uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC; // Offset chosen at bind time
     uboLayoutBinding.descriptorCount = 1;
     uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT; // UBO is used in the vertex shader
+    m_descriptorSetLayout = m_descriptorAllocator->GetLayout({ uboLayoutBinding });
+}
 
-    VkDescriptorSetLayoutCreateInfo layoutInfo{};
-    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-    layoutInfo.bindingCount = 1;
-    layoutInfo.pBindings = &uboLayoutBinding;
+void Renderer::createGraphicsPipeline()
+{
+    Log::GetCoreLogger()->info("Creating graphics pipeline...");
+
+    // --- Pipeline Layout (shared by the single-object and instanced pipelines) ---
+    // Set 0 holds the per-frame uniforms, set 1 the bindless table the material constants index
+    VkDescriptorSetLayout setLayouts[] = {m_descriptorSetLayout, m_bindless->GetLayout()};
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(MaterialConstants);
 
-    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_descriptorSetLayout) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create descriptor set layout!");
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 2;
+    pipelineLayoutInfo.pSetLayouts = setLayouts;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create pipeline layout!");
+    }
+
+    // The shaders read every vertex layout as floats, so only the vertex input differs per layout
+    for (uint32_t layout = 0; layout < VertexLayoutCount; layout++) {
+        m_graphicsPipelines[layout] = createScenePipeline("shaders/simple.vert.spv", false, static_cast<VertexLayout>(layout));
+        m_instancedPipelines[layout] = createScenePipeline("shaders/instanced.vert.spv", true, static_cast<VertexLayout>(layout));
     }
 }
 
-void Renderer::createGraphicsPipeline()
+VkPipeline Renderer::createScenePipeline(const std::string& vertexShaderPath, bool instanced, VertexLayout layout)
 {
-    Log::GetCoreLogger()->info("Creating graphics pipeline...");
-    auto vertShaderCode = ReadFile("shaders/vert.spv");
-    auto fragShaderCode = ReadFile("shaders/frag.spv");
-    VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
-    VkShaderModule fragShaderModule = createShaderModule(fragShaderCode);
+    VkShaderModule vertShaderModule = Shader::LoadModule(m_device, vertexShaderPath);
+    // Without dynamic indexing the table is in its fallback mode, and the static variant reads each of its
+    // slots with a constant index instead of indexing with the material's push constant
+    static_assert(BindlessTable::FallbackTextureCapacity == 16, "simple_static.frag has one case per fallback texture slot");
+    const char* fragmentShaderPath = m_features.dynamicArrayIndexing ? "shaders/simple.frag.spv" : "shaders/simple_static.frag.spv";
+    VkShaderModule fragShaderModule = Shader::LoadModule(m_device, fragmentShaderPath);
+
+    // The fragment shader sizes the bindless arrays with specialization constants 0 and 1
+    const uint32_t tableCapacities[] = {m_bindless->GetTextureCapacity(), m_bindless->GetBufferCapacity()};
+    VkSpecializationMapEntry specializationEntries[2]{};
+    for (uint32_t i = 0; i < 2; i++) {
+        specializationEntries[i].constantID = i;
+        specializationEntries[i].offset = sizeof(uint32_t) * i;
+        specializationEntries[i].size = sizeof(uint32_t);
+    }
+    VkSpecializationInfo specializationInfo{};
+    specializationInfo.mapEntryCount = 2;
+    specializationInfo.pMapEntries = specializationEntries;
+    specializationInfo.dataSize = sizeof(tableCapacities);
+    specializationInfo.pData = tableCapacities;
 
     VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
     vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -326,28 +613,42 @@ void Renderer::createGraphicsPipeline()
     fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
     fragShaderStageInfo.module = fragShaderModule;
     fragShaderStageInfo.pName = "main";
+    fragShaderStageInfo.pSpecializationInfo = &specializationInfo;
     VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
 
-    // --- Vertex Input ---
-    auto bindingDescription = VkVertexInputBindingDescription{};
-    bindingDescription.binding = 0;
-    bindingDescription.stride = sizeof(Vertex);
-    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-
-    std::array<VkVertexInputAttributeDescription, 2> attributeDescriptions{};
-    attributeDescriptions[0].binding = 0;
-    attributeDescriptions[0].location = 0; // layout(location = 0) in shader
-    attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
-    attributeDescriptions[0].offset = offsetof(Vertex, pos);
-    attributeDescriptions[1].binding = 0;
-    attributeDescriptions[1].location = 1; // layout(location = 1) in shader
-    attributeDescriptions[1].format = VK_FORMAT_R32G32B32_SFLOAT;
-    attributeDescriptions[1].offset = offsetof(Vertex, color);
+    // --- Vertex Input (binding 0 holds the mesh's vertices in the given layout) ---
+    std::vector<VkVertexInputBindingDescription> bindingDescriptions;
+    std::vector<VkVertexInputAttributeDescription> attributeDescriptions;
+    VertexFormat::GetInputDescription(layout, 0, bindingDescriptions, attributeDescriptions);
+
+    if (instanced) {
+        // Binding 1 advances once per instance: a mat4 model matrix (locations 2-5) and a color (location 6)
+        VkVertexInputBindingDescription instanceBinding{};
+        instanceBinding.binding = 1;
+        instanceBinding.stride = sizeof(InstanceData);
+        instanceBinding.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        bindingDescriptions.push_back(instanceBinding);
+
+        for (uint32_t column = 0; column < 4; column++) {
+            VkVertexInputAttributeDescription attribute{};
+            attribute.binding = 1;
+            attribute.location = 2 + column;
+            attribute.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+            attribute.offset = static_cast<uint32_t>(offsetof(InstanceData, model) + sizeof(glm::vec4) * column);
+            attributeDescriptions.push_back(attribute);
+        }
+        VkVertexInputAttributeDescription colorAttribute{};
+        colorAttribute.binding = 1;
+        colorAttribute.location = 6;
+        colorAttribute.format = VK_FORMAT_R32G32B32A32_SFLOAT;
+        colorAttribute.offset = offsetof(InstanceData, color);
+        attributeDescriptions.push_back(colorAttribute);
+    }
 
     VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
     vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+    vertexInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(bindingDescriptions.size());
+    vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
     vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
     vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
 
@@ -406,15 +707,6 @@ void Renderer::createGraphicsPipeline()
     colorBlending.attachmentCount = 1;
     colorBlending.pAttachments = &colorBlendAttachment;
 
-    // --- Pipeline Layout ---
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = 1;
-    pipelineLayoutInfo.pSetLayouts = &m_descriptorSetLayout;
-    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create pipeline layout!");
-    }
-
     // --- Graphics Pipeline Creation ---
     VkGraphicsPipelineCreateInfo pipelineInfo{};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
@@ -432,13 +724,15 @@ void Renderer::createGraphicsPipeline()
     pipelineInfo.renderPass = m_sceneRenderPass;
     pipelineInfo.subpass = 0;
 
-    if (vkCreateGraphicsPipelines(m_device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_graphicsPipeline) != VK_SUCCESS) {
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    if (vkCreateGraphicsPipelines(m_device, m_pipelineCache, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
         throw std::runtime_error("failed to create graphics pipeline!");
     }
 
     // Clean up shader modules after pipeline creation
     vkDestroyShaderModule(m_device, fragShaderModule, nullptr);
     vkDestroyShaderModule(m_device, vertShaderModule, nullptr);
+    return pipeline;
 }
 
 void Renderer::createFramebuffer()
@@ -456,20 +750,11 @@ void Renderer::createFramebuffer()
     colorImageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
     colorImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     colorImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    if (vkCreateImage(m_device, &colorImageInfo, nullptr, &m_sceneImage) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create scene image!");
-    }
 
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(m_device, m_sceneImage, &memRequirements);
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-    if (vkAllocateMemory(m_device, &allocInfo, nullptr, &m_sceneImageMemory) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate scene image memory!");
-    }
-    vkBindImageMemory(m_device, m_sceneImage, m_sceneImageMemory, 0);
+    // Render targets are recreated on every resize, so they get dedicated memory instead of fragmenting a block
+    GpuAllocationInfo targetAllocInfo{};
+    targetAllocInfo.dedicated = true;
+    m_allocator->CreateImage(colorImageInfo, targetAllocInfo, m_sceneImage, m_sceneImageMemory);
 
     // 2. Create Color Image View
     VkImageViewCreateInfo colorViewInfo{};
@@ -500,17 +785,7 @@ void Renderer::createFramebuffer()
     depthImageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
     depthImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     depthImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-    if (vkCreateImage(m_device, &depthImageInfo, nullptr, &m_depthImage) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create depth image!");
-    }
-
-    vkGetImageMemoryRequirements(m_device, m_depthImage, &memRequirements);
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-    if (vkAllocateMemory(m_device, &allocInfo, nullptr, &m_depthImageMemory) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate depth image memory!");
-    }
-    vkBindImageMemory(m_device, m_depthImage, m_depthImageMemory, 0);
+    m_allocator->CreateImage(depthImageInfo, targetAllocInfo, m_depthImage, m_depthImageMemory);
 
     // 4. Create Depth Image View
     VkImageViewCreateInfo depthViewInfo{};
@@ -532,9 +807,10 @@ void Renderer::createFramebuffer()
     samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
     samplerInfo.magFilter = VK_FILTER_LINEAR;
     samplerInfo.minFilter = VK_FILTER_LINEAR;
-    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    // Clamped, so stretching a scaled-down frame over the viewport does not wrap the opposite edge in
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
     samplerInfo.anisotropyEnable = VK_FALSE;
     samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
     samplerInfo.unnormalizedCoordinates = VK_FALSE;
@@ -562,204 +838,237 @@ void Renderer::createFramebuffer()
 
 void Renderer::createCubeBuffers()
 {
-    VkDeviceSize vertexBufferSize = sizeof(cube_vertices[0]) * cube_vertices.size();
-    VkDeviceSize indexBufferSize = sizeof(cube_indices[0]) * cube_indices.size();
-
-    // Create staging buffers (CPU-visible)
-    VkBuffer stagingVertexBuffer, stagingIndexBuffer;
-    VkDeviceMemory stagingVertexBufferMemory, stagingIndexBufferMemory;
-    createBuffer(vertexBufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingVertexBuffer, stagingVertexBufferMemory);
-    createBuffer(indexBufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingIndexBuffer, stagingIndexBufferMemory);
-
-    // Copy data to staging buffers
-    void* data;
-    vkMapMemory(m_device, stagingVertexBufferMemory, 0, vertexBufferSize, 0, &data);
-    memcpy(data, cube_vertices.data(), (size_t)vertexBufferSize);
-    vkUnmapMemory(m_device, stagingVertexBufferMemory);
-
-    vkMapMemory(m_device, stagingIndexBufferMemory, 0, indexBufferSize, 0, &data);
-    memcpy(data, cube_indices.data(), (size_t)indexBufferSize);
-    vkUnmapMemory(m_device, stagingIndexBufferMemory);
-
-    // Create final device-local buffers (GPU-only)
-    createBuffer(vertexBufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_vertexBuffer, m_vertexBufferMemory);
-    createBuffer(indexBufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_indexBuffer, m_indexBufferMemory);
-
-    // Copy from staging buffers to device-local buffers
-    copyBuffer(stagingVertexBuffer, m_vertexBuffer, vertexBufferSize);
-    copyBuffer(stagingIndexBuffer, m_indexBuffer, indexBufferSize);
-
-    // Clean up staging buffers
-    vkDestroyBuffer(m_device, stagingVertexBuffer, nullptr);
-    vkFreeMemory(m_device, stagingVertexBufferMemory, nullptr);
-    vkDestroyBuffer(m_device, stagingIndexBuffer, nullptr);
-    vkFreeMemory(m_device, stagingIndexBufferMemory, nullptr);
+    // The cube cannot be simplified without changing its shape, so it has a single level
+    MeshData cube;
+    cube.name = "cube";
+    cube.vertices = cube_vertices;
+    cube.indices.assign(cube_indices.begin(), cube_indices.end());
+    cube.ComputeBounds();
+    cube.ResetLods();
+
+    m_cubeMesh.name = cube.name;
+    m_cubeMesh.vertexCount = static_cast<uint32_t>(cube.vertices.size());
+    m_cubeMesh.indexCount = static_cast<uint32_t>(cube.indices.size());
+    m_cubeMesh.lods = cube.lods;
+    m_cubeMesh.bounds = cube.bounds;
+    m_cubeMesh.boundingSphere = cube.boundingSphere;
+    uploadBuffer(cube.vertices.data(), sizeof(Vertex) * cube.vertices.size(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, m_cubeMesh.vertexBuffer, m_cubeMesh.vertexMemory);
+    m_cubeMesh.indexType = VK_INDEX_TYPE_UINT16;
+    uploadBuffer(cube_indices.data(), sizeof(uint16_t) * cube_indices.size(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT, m_cubeMesh.indexBuffer, m_cubeMesh.indexMemory);
+    m_lodInstanceCounts.assign(m_cubeMesh.lods.size(), 0);
 }
 
-void Renderer::createUniformBuffers()
+void Renderer::createFrameData()
 {
-    VkDeviceSize bufferSize = sizeof(UniformBufferObject);
-    m_uniformBuffers.resize(m_framesInFlight);
-    m_uniformBuffersMemory.resize(m_framesInFlight);
-    for (size_t i = 0; i < m_framesInFlight; i++) {
-        createBuffer(bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, m_uniformBuffers[i], m_uniformBuffersMemory[i]);
-    }
+    m_frameData = std::make_unique<FrameRingBuffer>(*m_allocator, m_physicalDevice, m_frameDataBytes, m_framesInFlight);
 }
 
-void Renderer::createDescriptorPool()
+void Renderer::createDescriptorSets()
 {
-    VkDescriptorPoolSize poolSize{};
-    poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    poolSize.descriptorCount = static_cast<uint32_t>(m_framesInFlight);
+    // A single persistent set serves every frame: the frame's ring buffer partition is selected by the dynamic offset
+    m_descriptorSet = m_descriptorAllocator->Allocate(m_descriptorSetLayout);
+
+    // Point the set at the start of the ring buffer; the real offset is supplied at bind time
+    VkDescriptorBufferInfo bufferInfo{};
+    bufferInfo.buffer = m_frameData->GetBuffer();
+    bufferInfo.offset = 0;
+    bufferInfo.range = sizeof(UniformBufferObject);
+
+    VkWriteDescriptorSet descriptorWrite{};
+    descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptorWrite.dstSet = m_descriptorSet;
+    descriptorWrite.dstBinding = 0;
+    descriptorWrite.dstArrayElement = 0;
+    descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    descriptorWrite.descriptorCount = 1;
+    descriptorWrite.pBufferInfo = &bufferInfo;
+
+    vkUpdateDescriptorSets(m_device, 1, &descriptorWrite, 0, nullptr);
+}
 
-    VkDescriptorPoolCreateInfo poolInfo{};
-    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    poolInfo.poolSizeCount = 1;
-    poolInfo.pPoolSizes = &poolSize;
-    poolInfo.maxSets = static_cast<uint32_t>(m_framesInFlight);
+void Renderer::createCommandBuffers()
+{
+    m_commandBuffers.resize(m_framesInFlight);
+    VkCommandBufferAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool = m_commandPool;
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandBufferCount = static_cast<uint32_t>(m_commandBuffers.size());
 
-    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create descriptor pool!");
+    if (vkAllocateCommandBuffers(m_device, &allocInfo, m_commandBuffers.data()) != VK_SUCCESS) {
+        throw std::runtime_error("failed to allocate scene command buffers!");
     }
 }
 
-void Renderer::createDescriptorSets()
+void Renderer::createGpuCulling()
 {
-    std::vector<VkDescriptorSetLayout> layouts(m_framesInFlight, m_descriptorSetLayout);
-    VkDescriptorSetAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-    allocInfo.descriptorPool = m_descriptorPool;
-    allocInfo.descriptorSetCount = static_cast<uint32_t>(m_framesInFlight);
-    allocInfo.pSetLayouts = layouts.data();
-    
-    m_descriptorSets.resize(m_framesInFlight);
-    if (vkAllocateDescriptorSets(m_device, &allocInfo, m_descriptorSets.data()) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate descriptor sets!");
-    }
-
-    // Update each descriptor set to point to its corresponding uniform buffer
-    for (size_t i = 0; i < m_framesInFlight; i++) {
-        VkDescriptorBufferInfo bufferInfo{};
-        bufferInfo.buffer = m_uniformBuffers[i];
-        bufferInfo.offset = 0;
-        bufferInfo.range = sizeof(UniformBufferObject);
-
-        VkWriteDescriptorSet descriptorWrite{};
-        descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        descriptorWrite.dstSet = m_descriptorSets[i];
-        descriptorWrite.dstBinding = 0;
-        descriptorWrite.dstArrayElement = 0;
-        descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        descriptorWrite.descriptorCount = 1;
-        descriptorWrite.pBufferInfo = &bufferInfo;
-
-        vkUpdateDescriptorSets(m_device, 1, &descriptorWrite, 0, nullptr);
+    if (!m_gpuCullingEnabled) {
+        return;
+    }
+    if (!GpuCulling::IsSupported(m_features)) {
+        Log::GetCoreLogger()->warn("GPU culling requires multiDrawIndirect and drawIndirectFirstInstance, using CPU-side instanced draws.");
+        m_gpuCullingEnabled = false;
+        return;
     }
+    m_gpuCulling = std::make_unique<GpuCulling>(m_device, *m_allocator, *m_descriptorAllocator, *m_deletionQueue, m_features, m_framesInFlight, m_pipelineCache);
+}
+
+void Renderer::createUpscaler(UpscalePreset preset)
+{
+    m_upscaler = std::make_unique<Upscaler>(m_device, *m_allocator, *m_descriptorAllocator, *m_deletionQueue, m_sceneExtent, m_pipelineCache);
+    m_upscaler->SetPreset(preset);
 }
 
 // =================================================================================
 // Private Update Methods
 // =================================================================================
 
-void Renderer::updateUniformBuffer(uint32_t currentFrame)
+uint32_t Renderer::updateUniformBuffer()
 {
-    UniformBufferObject ubo{};
-
-    // Start with an identity matrix
-    glm::mat4 model(1.0f);
-
-    // Apply transformations in Scale -> Rotate -> Translate order
-    model = glm::translate(model, m_cubePosition);
-    model = glm::rotate(model, glm::radians(m_cubeRotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-    model = glm::rotate(model, glm::radians(m_cubeRotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
-    model = glm::rotate(model, glm::radians(m_cubeRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::scale(model, m_cubeScale);
+    ENGINE_PROFILE_FUNCTION();
 
-    ubo.model = model;
+    UniformBufferObject ubo{};
+    ubo.model = getSceneTransform();
     ubo.view = m_viewMatrix;       // View matrix from the camera
     ubo.proj = m_projectionMatrix; // Projection matrix from the camera
+    ubo.positionScale = m_mesh->quantization.scale;
+    ubo.positionOffset = m_mesh->quantization.offset;
 
-    // Copy data to the current frame's uniform buffer
-    void* data;
-    vkMapMemory(m_device, m_uniformBuffersMemory[currentFrame], 0, sizeof(ubo), 0, &data);
-    memcpy(data, &ubo, sizeof(ubo));
-    vkUnmapMemory(m_device, m_uniformBuffersMemory[currentFrame]);
+    // Copy data into the current frame's partition of the ring buffer (persistently mapped)
+    return m_frameData->Push(ubo).offset;
 }
 
-// =================================================================================
-// Private Helper Methods
-// =================================================================================
-
-void Renderer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory)
+uint32_t Renderer::updateCullParams()
 {
-    VkBufferCreateInfo bufferInfo{};
-    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    bufferInfo.size = size;
-    bufferInfo.usage = usage;
-    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    Frustum frustum = Frustum::FromMatrix(m_projectionMatrix * m_viewMatrix);
+    m_lodSelector.SetCamera(m_viewMatrix, m_projectionMatrix, static_cast<float>(m_renderExtent.height));
 
-    if (vkCreateBuffer(m_device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create buffer!");
+    CullParams params{};
+    params.sceneTransform = getSceneTransform();
+    for (uint32_t i = 0; i < Frustum::PlaneCount; i++) {
+        params.planes[i] = frustum.planes[i];
     }
+    params.objectCount = m_instanceCount;
+    params.compact = m_gpuCulling->UsesDrawCount() ? 1 : 0;
+    // A threshold of 0 keeps every instance at the finest level
+    params.lodPixelError = m_lodEnabled ? m_lodSelector.GetPixelError() : 0.0f;
+    params.lodHysteresis = m_lodSelector.GetHysteresis();
+    params.lodCamera = glm::vec4(m_lodSelector.GetCameraPosition(), m_lodSelector.GetPixelsPerUnit());
+    return m_frameData->Push(params).offset;
+}
 
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(m_device, buffer, &memRequirements);
+void Renderer::cullInstancesOnCpu(VkBuffer& buffer, VkDeviceSize& offset)
+{
+    ENGINE_PROFILE_FUNCTION();
+
+    // The planes of view-projection * scene transform are in the space the bounds are stored in
+    Frustum frustum = Frustum::FromMatrix(m_projectionMatrix * m_viewMatrix * getSceneTransform());
+    size_t visibleCount = m_bvhCullingEnabled
+        ? m_instanceBvh.QueryFrustum(frustum, m_visibleInstances)
+        : m_cpuCulling.CullSpheres(frustum, m_instanceBounds, m_visibleInstances);
+    m_cpuVisibleCount = static_cast<uint32_t>(visibleCount);
+    if (visibleCount == 0) {
+        return;
+    }
 
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
+    // Too many survivors for this frame's ring buffer partition: draw everything from the persistent buffer,
+    // unculled and at full detail, and report it as such
+    VkDeviceSize bytes = sizeof(InstanceData) * visibleCount;
+    if (bytes + alignof(InstanceData) > m_frameData->GetFrameRemaining()) {
+        if (!m_cullingOverflowLogged) {
+            Log::GetCoreLogger()->warn("{0} visible instances do not fit into the per-frame ring buffer, drawing all {1} unculled; raise frame-data-mb.",
+                visibleCount, m_instanceCount);
+            m_cullingOverflowLogged = true;
+        }
+        m_cpuVisibleCount = m_instanceCount;
+        m_lodInstanceCounts[0] = m_instanceCount;
+        return;
+    }
 
-    if (vkAllocateMemory(m_device, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate buffer memory!");
+    RingAllocation allocation = m_frameData->Allocate(bytes, alignof(InstanceData));
+    InstanceData* visible = static_cast<InstanceData*>(allocation.data);
+    buffer = allocation.buffer;
+    offset = allocation.offset;
+    if (!m_lodEnabled || m_mesh->lods.size() <= 1) {
+        for (size_t i = 0; i < visibleCount; i++) {
+            visible[i] = m_instances[m_visibleInstances[i]];
+        }
+        m_lodInstanceCounts[0] = m_cpuVisibleCount;
+        return;
     }
 
-    vkBindBufferMemory(m_device, buffer, bufferMemory, 0);
+    // Counting sort by level, so each level is one contiguous instance range
+    selectInstanceLods();
+    for (size_t i = 0; i < visibleCount; i++) {
+        m_lodInstanceCounts[m_instanceLods[m_visibleInstances[i]]]++;
+    }
+    m_lodOffsets.assign(m_lodInstanceCounts.size(), 0);
+    for (size_t lod = 1; lod < m_lodOffsets.size(); lod++) {
+        m_lodOffsets[lod] = m_lodOffsets[lod - 1] + m_lodInstanceCounts[lod - 1];
+    }
+    for (size_t i = 0; i < visibleCount; i++) {
+        uint32_t instance = m_visibleInstances[i];
+        visible[m_lodOffsets[m_instanceLods[instance]]++] = m_instances[instance];
+    }
 }
 
-void Renderer::copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
+void Renderer::selectInstanceLods()
 {
-    // Create a temporary command buffer for the copy operation
-    VkCommandBufferAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandPool = m_commandPool;
-    allocInfo.commandBufferCount = 1;
-    VkCommandBuffer commandBuffer;
-    vkAllocateCommandBuffers(m_device, &allocInfo, &commandBuffer);
-
-    VkCommandBufferBeginInfo beginInfo{};
-    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    vkBeginCommandBuffer(commandBuffer, &beginInfo);
-
-    VkBufferCopy copyRegion{};
-    copyRegion.size = size;
-    vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
-
-    vkEndCommandBuffer(commandBuffer);
+    ENGINE_PROFILE_FUNCTION();
+
+    // Select in the space the bounds are stored in: the camera is moved there instead
+    m_lodSelector.SetCamera(m_viewMatrix * getSceneTransform(), m_projectionMatrix, static_cast<float>(m_renderExtent.height));
+    float meshRadius = std::max(m_mesh->boundingSphere.w, std::numeric_limits<float>::min());
+    auto select = [this, meshRadius](uint32_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            uint32_t instance = m_visibleInstances[i];
+            glm::vec3 center(m_instanceBounds.centerX[instance], m_instanceBounds.centerY[instance], m_instanceBounds.centerZ[instance]);
+            float radius = m_instanceBounds.radius[instance];
+            m_instanceLods[instance] = static_cast<uint8_t>(m_lodSelector.Select(m_mesh->lods, center, radius, radius / meshRadius, m_instanceLods[instance]));
+        }
+    };
+    if (m_threadPool) {
+        m_threadPool->ParallelFor(m_visibleInstances.size(), CullingSystem::MinBatchSize, select);
+    } else {
+        select(0, 0, m_visibleInstances.size());
+    }
+}
 
-    // Submit the command buffer and wait for it to complete
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &commandBuffer;
-    vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(m_graphicsQueue);
+glm::mat4 Renderer::getSceneTransform() const
+{
+    // Start with an identity matrix
+    glm::mat4 model(1.0f);
 
-    vkFreeCommandBuffers(m_device, m_commandPool, 1, &commandBuffer);
+    // Apply transformations in Scale -> Rotate -> Translate order
+    model = glm::translate(model, m_cubePosition);
+    model = glm::rotate(model, glm::radians(m_cubeRotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
+    model = glm::rotate(model, glm::radians(m_cubeRotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
+    model = glm::rotate(model, glm::radians(m_cubeRotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+    model = glm::scale(model, m_cubeScale);
+    return model;
 }
 
-uint32_t Renderer::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
+float Renderer::getRenderScale() const
 {
-    VkPhysicalDeviceMemoryProperties memProperties;
-    vkGetPhysicalDeviceMemoryProperties(m_physicalDevice, &memProperties);
-    for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
-        if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
-            return i;
-        }
+    // Dynamic resolution takes over the preset's scale; the upscaler then fills in whatever it dropped
+    if (m_dynamicResolution.IsEnabled()) {
+        return m_dynamicResolution.GetScale();
     }
-    throw std::runtime_error("failed to find suitable memory type!");
+    return m_upscaler ? m_upscaler->GetRenderScale() : 1.0f;
+}
+
+// =================================================================================
+// Private Helper Methods
+// =================================================================================
+
+void Renderer::uploadBuffer(const void* data, VkDeviceSize size, VkBufferUsageFlags usage, VkBuffer& buffer, GpuAllocation& allocation)
+{
+    // Create the final device-local (GPU-only) buffer and stage the copy into it; the copy is
+    // submitted with the next frame (or earlier if the staging ring fills up), never waited on here
+    GpuAllocationInfo deviceAllocInfo{};
+    m_allocator->CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage, deviceAllocInfo, buffer, allocation);
+    m_uploadQueue->UploadBuffer(data, size, buffer);
+    m_uploadBatch = m_uploadQueue->GetRecordingBatch();
 }
 
 VkFormat Renderer::findDepthFormat()
@@ -774,32 +1083,3 @@ VkFormat Renderer::findDepthFormat()
     }
     throw std::runtime_error("failed to find supported depth format!");
 }
-
-VkShaderModule Renderer::createShaderModule(const std::vector<char>& code)
-{
-    VkShaderModuleCreateInfo createInfo{};
-    createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    createInfo.codeSize = code.size();
-    createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
-
-    VkShaderModule shaderModule;
-    if (vkCreateShaderModule(m_device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
-        throw std::runtime_error("failed to create shader module!");
-    }
-    return shaderModule;
-}
-
-std::vector<char> Renderer::ReadFile(const std::string& filename)
-{
-    std::ifstream file(filename, std::ios::ate | std::ios::binary);
-    if (!file.is_open()) {
-        Log::GetCoreLogger()->error("Failed to open file: {0}", filename);
-        throw std::runtime_error("failed to open file: " + filename);
-    }
-    size_t fileSize = (size_t)file.tellg();
-    std::vector<char> buffer(fileSize);
-    file.seekg(0);
-    file.read(buffer.data(), fileSize);
-    file.close();
-    return buffer;
-}
@@ -0,0 +1,55 @@
+#include "EngineCore/Rendering/DynamicResolution.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void DynamicResolution::SetEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (!enabled) {
+        m_scale = 1.0f;
+        m_smoothedMilliseconds = 0.0f;
+    }
+}
+
+void DynamicResolution::SetMinScale(float scale)
+{
+    m_minScale = std::clamp(scale, MinScaleLimit, 1.0f);
+    m_scale = std::max(m_scale, m_minScale);
+}
+
+float DynamicResolution::Update(double gpuMilliseconds)
+{
+    if (!m_enabled || !(gpuMilliseconds > 0.0) || !(m_targetMilliseconds > 0.0f)) {
+        return m_scale;
+    }
+
+    float milliseconds = static_cast<float>(gpuMilliseconds);
+    m_smoothedMilliseconds = m_smoothedMilliseconds > 0.0f
+        ? m_smoothedMilliseconds + (milliseconds - m_smoothedMilliseconds) * Smoothing
+        : milliseconds;
+
+    // Inside the band the scale stays put, so small timing noise never shows up as shimmering edges
+    float ratio = m_targetMilliseconds / m_smoothedMilliseconds;
+    if (std::abs(ratio - 1.0f) <= Tolerance) {
+        return m_scale;
+    }
+
+    // The time spent shading grows with the pixel count, the square of the scale
+    float step = std::clamp(std::sqrt(ratio), 1.0f - MaxStep, 1.0f + MaxStep);
+    m_scale = std::clamp(m_scale * step, m_minScale, 1.0f);
+    return m_scale;
+}
+
+VkExtent2D DynamicResolution::ScaleExtent(VkExtent2D targetExtent, float scale)
+{
+    auto scaleAxis = [scale](uint32_t size) {
+        uint32_t scaled = static_cast<uint32_t>(std::lround(static_cast<float>(size) * scale));
+        return std::clamp(scaled, 1u, std::max(size, 1u));
+    };
+    return { scaleAxis(targetExtent.width), scaleAxis(targetExtent.height) };
+}
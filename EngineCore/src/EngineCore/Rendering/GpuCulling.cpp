@@ -0,0 +1,214 @@
+#include "EngineCore/Rendering/GpuCulling.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Vulkan/Shader.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+bool GpuCulling::IsSupported(const DeviceFeatures& features)
+{
+    return features.multiDrawIndirect && features.drawIndirectFirstInstance;
+}
+
+GpuCulling::GpuCulling(VkDevice device, GpuAllocator& allocator, DescriptorAllocator& descriptorAllocator, DeletionQueue& deletionQueue,
+    const DeviceFeatures& features, uint32_t framesInFlight, VkPipelineCache pipelineCache)
+    : m_device(device), m_allocator(allocator), m_descriptorAllocator(descriptorAllocator), m_deletionQueue(deletionQueue),
+      m_features(features), m_framesInFlight(framesInFlight)
+{
+    // Binding 0: CullParams (dynamic UBO), 1: instances, 2: bounds, 3: meshes, 4: draw commands, 5: draw count, 6: LOD states
+    std::vector<VkDescriptorSetLayoutBinding> bindings(7);
+    for (uint32_t i = 0; i < bindings.size(); i++) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = i == 0 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+    m_descriptorSetLayout = descriptorAllocator.GetLayout(bindings);
+
+    createPipeline(pipelineCache);
+    Log::GetCoreLogger()->info("GPU culling enabled ({0}).",
+        m_features.drawIndirectCount ? "vkCmdDrawIndexedIndirectCount" : "vkCmdDrawIndexedIndirect fallback");
+}
+
+GpuCulling::~GpuCulling()
+{
+    destroyFrameBuffers();
+    vkDestroyPipeline(m_device, m_pipeline, nullptr);
+    vkDestroyPipelineLayout(m_device, m_pipelineLayout, nullptr);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void GpuCulling::SetScene(VkBuffer instanceBuffer, VkBuffer boundsBuffer, VkBuffer meshBuffer, VkBuffer lodStateBuffer, uint32_t objectCount, VkBuffer paramsBuffer)
+{
+    destroyFrameBuffers();
+    m_instanceBuffer = instanceBuffer;
+    m_boundsBuffer = boundsBuffer;
+    m_meshBuffer = meshBuffer;
+    m_lodStateBuffer = lodStateBuffer;
+    m_paramsBuffer = paramsBuffer;
+    m_objectCount = objectCount;
+    m_visibleCount = 0;
+    m_compact = m_features.drawIndirectCount && objectCount <= m_features.maxDrawIndirectCount;
+    if (objectCount == 0) {
+        return;
+    }
+
+    GpuAllocationInfo commandAllocInfo{};
+    GpuAllocationInfo countAllocInfo{};
+    countAllocInfo.properties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    m_commandBuffers.resize(m_framesInFlight, VK_NULL_HANDLE);
+    m_commandMemory.resize(m_framesInFlight);
+    m_countBuffers.resize(m_framesInFlight, VK_NULL_HANDLE);
+    m_countMemory.resize(m_framesInFlight);
+
+    for (uint32_t i = 0; i < m_framesInFlight; i++) {
+        m_allocator.CreateBuffer(sizeof(VkDrawIndexedIndirectCommand) * objectCount,
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+            commandAllocInfo, m_commandBuffers[i], m_commandMemory[i]);
+        m_allocator.CreateBuffer(sizeof(uint32_t),
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            countAllocInfo, m_countBuffers[i], m_countMemory[i]);
+
+        // Read back by BeginFrame() before the slot's first dispatch has written it
+        *static_cast<uint32_t*>(m_countMemory[i].mappedData) = 0;
+    }
+}
+
+void GpuCulling::BeginFrame(uint32_t frameIndex)
+{
+    if (m_objectCount == 0) {
+        return;
+    }
+    // The fence of this slot has been waited on, so the count written by its last use is final
+    m_visibleCount = *static_cast<const uint32_t*>(m_countMemory[frameIndex].mappedData);
+}
+
+void GpuCulling::Dispatch(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint32_t paramsOffset)
+{
+    if (m_objectCount == 0) {
+        return;
+    }
+
+    // Reset the draw count, then make the reset visible to the compute shader. The LOD states are
+    // shared by all frame slots and read-modified-written every dispatch, so the previous frame's
+    // dispatch (earlier in submission order on this queue) must also finish writing them first
+    vkCmdFillBuffer(commandBuffer, m_countBuffers[frameIndex], 0, sizeof(uint32_t), 0);
+    VkMemoryBarrier resetBarrier{};
+    resetBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    resetBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    resetBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0, 1, &resetBarrier, 0, nullptr, 0, nullptr);
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipeline);
+    VkDescriptorSet descriptorSet = writeDescriptorSet(frameIndex);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelineLayout, 0, 1, &descriptorSet, 1, &paramsOffset);
+    vkCmdDispatch(commandBuffer, (m_objectCount + WorkgroupSize - 1) / WorkgroupSize, 1, 1);
+
+    // The draw commands and count are consumed by the indirect draw, and the count by the host
+    VkMemoryBarrier cullBarrier{};
+    cullBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    cullBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    cullBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_HOST_BIT,
+        0, 1, &cullBarrier, 0, nullptr, 0, nullptr);
+}
+
+void GpuCulling::Draw(VkCommandBuffer commandBuffer, uint32_t frameIndex)
+{
+    if (m_objectCount == 0) {
+        return;
+    }
+
+    const uint32_t stride = sizeof(VkDrawIndexedIndirectCommand);
+    if (m_compact) {
+        vkCmdDrawIndexedIndirectCount(commandBuffer, m_commandBuffers[frameIndex], 0,
+            m_countBuffers[frameIndex], 0, m_objectCount, stride);
+        return;
+    }
+
+    // One slot per object; a single call covers them all unless the device limits the draw count
+    uint32_t maxDraws = std::max(m_features.maxDrawIndirectCount, 1u);
+    for (uint32_t first = 0; first < m_objectCount; first += maxDraws) {
+        uint32_t drawCount = std::min(maxDraws, m_objectCount - first);
+        vkCmdDrawIndexedIndirect(commandBuffer, m_commandBuffers[frameIndex], static_cast<VkDeviceSize>(first) * stride, drawCount, stride);
+    }
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+void GpuCulling::createPipeline(VkPipelineCache pipelineCache)
+{
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_descriptorSetLayout;
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create culling pipeline layout!");
+    }
+
+    VkShaderModule computeModule = Shader::LoadModule(m_device, "shaders/cull.comp.spv");
+
+    VkComputePipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = computeModule;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.layout = m_pipelineLayout;
+    VkResult result = vkCreateComputePipelines(m_device, pipelineCache, 1, &pipelineInfo, nullptr, &m_pipeline);
+    vkDestroyShaderModule(m_device, computeModule, nullptr);
+    if (result != VK_SUCCESS) {
+        throw std::runtime_error("failed to create culling pipeline!");
+    }
+}
+
+void GpuCulling::destroyFrameBuffers()
+{
+    // Frames in flight may still be culling into them
+    for (size_t i = 0; i < m_commandBuffers.size(); i++) {
+        m_deletionQueue.DestroyBuffer(m_commandBuffers[i], m_commandMemory[i]);
+        m_deletionQueue.DestroyBuffer(m_countBuffers[i], m_countMemory[i]);
+    }
+    m_commandBuffers.clear();
+    m_commandMemory.clear();
+    m_countBuffers.clear();
+    m_countMemory.clear();
+}
+
+VkDescriptorSet GpuCulling::writeDescriptorSet(uint32_t frameIndex)
+{
+    // A transient set per frame, so a new scene never rewrites a set that a frame in flight is reading
+    VkDescriptorSet descriptorSet = m_descriptorAllocator.AllocateTransient(m_descriptorSetLayout);
+
+    std::array<VkDescriptorBufferInfo, 7> bufferInfos{};
+    bufferInfos[0] = { m_paramsBuffer, 0, sizeof(CullParams) };
+    bufferInfos[1] = { m_instanceBuffer, 0, VK_WHOLE_SIZE };
+    bufferInfos[2] = { m_boundsBuffer, 0, VK_WHOLE_SIZE };
+    bufferInfos[3] = { m_meshBuffer, 0, VK_WHOLE_SIZE };
+    bufferInfos[4] = { m_commandBuffers[frameIndex], 0, VK_WHOLE_SIZE };
+    bufferInfos[5] = { m_countBuffers[frameIndex], 0, VK_WHOLE_SIZE };
+    bufferInfos[6] = { m_lodStateBuffer, 0, VK_WHOLE_SIZE };
+
+    std::array<VkWriteDescriptorSet, 7> writes{};
+    for (uint32_t binding = 0; binding < writes.size(); binding++) {
+        writes[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[binding].dstSet = descriptorSet;
+        writes[binding].dstBinding = binding;
+        writes[binding].descriptorCount = 1;
+        writes[binding].descriptorType = binding == 0 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[binding].pBufferInfo = &bufferInfos[binding];
+    }
+    vkUpdateDescriptorSets(m_device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    return descriptorSet;
+}
@@ -0,0 +1,296 @@
+#include "EngineCore/Rendering/Upscaler.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Vulkan/Shader.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    // Scales follow FSR 1's modes; lower resolutions lose more detail, so they are sharpened harder
+    const std::array<UpscalePresetInfo, UpscalePresetCount> Presets = { {
+        { "off", "Off", 1.0f, 0.0f },
+        { "ultra-quality", "Ultra Quality", 0.77f, 0.3f },
+        { "quality", "Quality", 0.67f, 0.4f },
+        { "balanced", "Balanced", 0.59f, 0.5f },
+        { "performance", "Performance", 0.5f, 0.6f },
+    } };
+
+    /// Both passes read and write 8-bit color; RGBA8 storage images are supported by every device.
+    constexpr VkFormat ImageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+
+    VkImageMemoryBarrier imageBarrier(VkImage image, VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkImageLayout oldLayout, VkImageLayout newLayout)
+    {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.oldLayout = oldLayout;
+        barrier.newLayout = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image;
+        barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+        return barrier;
+    }
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+Upscaler::Upscaler(VkDevice device, GpuAllocator& allocator, DescriptorAllocator& descriptorAllocator, DeletionQueue& deletionQueue,
+    VkExtent2D outputExtent, VkPipelineCache pipelineCache)
+    : m_device(device), m_allocator(allocator), m_descriptorAllocator(descriptorAllocator), m_deletionQueue(deletionQueue),
+      m_extent(outputExtent)
+{
+    // Binding 0: the image read (texelFetch only), 1: the image written
+    std::vector<VkDescriptorSetLayoutBinding> bindings(2);
+    bindings[0].binding = 0;
+    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    bindings[0].descriptorCount = 1;
+    bindings[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    bindings[1].binding = 1;
+    bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    bindings[1].descriptorCount = 1;
+    bindings[1].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    m_descriptorSetLayout = descriptorAllocator.GetLayout(bindings);
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &m_sampler) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create upscaler sampler!");
+    }
+
+    createPipelines(pipelineCache);
+}
+
+Upscaler::~Upscaler()
+{
+    destroyImages();
+    vkDestroyPipeline(m_device, m_sharpenPipeline, nullptr);
+    vkDestroyPipeline(m_device, m_upscalePipeline, nullptr);
+    vkDestroyPipelineLayout(m_device, m_pipelineLayout, nullptr);
+    vkDestroySampler(m_device, m_sampler, nullptr);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+const UpscalePresetInfo& Upscaler::GetPresetInfo(UpscalePreset preset)
+{
+    return Presets[std::min(static_cast<uint32_t>(preset), UpscalePresetCount - 1)];
+}
+
+bool Upscaler::ParsePreset(const std::string& name, UpscalePreset& preset)
+{
+    for (uint32_t i = 0; i < UpscalePresetCount; i++) {
+        if (name == Presets[i].name) {
+            preset = static_cast<UpscalePreset>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Upscaler::SetPreset(UpscalePreset preset)
+{
+    bool wasActive = IsActive();
+    m_preset = preset;
+    m_sharpness = GetPresetInfo(preset).sharpness;
+    if (IsActive() && !wasActive) {
+        createImages();
+    } else if (!IsActive() && wasActive) {
+        destroyImages();
+    }
+    Log::GetCoreLogger()->info("Upscaler preset: {0}.", GetPresetInfo(preset).label);
+}
+
+void Upscaler::SetSharpness(float sharpness)
+{
+    m_sharpness = std::clamp(sharpness, 0.0f, 1.0f);
+}
+
+void Upscaler::Resize(VkExtent2D outputExtent)
+{
+    m_extent = outputExtent;
+    if (IsActive()) {
+        destroyImages();
+        createImages();
+    }
+}
+
+void Upscaler::Dispatch(VkCommandBuffer commandBuffer, VkImage inputImage, VkImageView inputView, VkExtent2D inputExtent)
+{
+    UpscaleConstants constants{};
+    constants.inputWidth = inputExtent.width;
+    constants.inputHeight = inputExtent.height;
+    constants.outputWidth = m_extent.width;
+    constants.outputHeight = m_extent.height;
+    constants.sharpness = m_sharpness;
+    bool sharpen = m_sharpness > 0.0f;
+    VkImage upscaleTarget = sharpen ? m_upscaledImage : m_outputImage;
+    VkImageView upscaleTargetView = sharpen ? m_upscaledView : m_outputView;
+    uint32_t groupsX = (m_extent.width + WorkgroupSize - 1) / WorkgroupSize;
+    uint32_t groupsY = (m_extent.height + WorkgroupSize - 1) / WorkgroupSize;
+
+    // The scene pass's color writes must be visible to the compute reads. The images written are
+    // overwritten completely, so their old contents are discarded; waiting for the stages that read
+    // them in earlier frames (the sharpening pass and the UI) is enough to avoid overwriting them early.
+    std::array<VkImageMemoryBarrier, 3> barriers = {
+        imageBarrier(inputImage, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL),
+        imageBarrier(m_outputImage, 0, VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED, OutputLayout),
+        imageBarrier(m_upscaledImage, 0, VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL),
+    };
+    vkCmdPipelineBarrier(commandBuffer,
+        VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr,
+        sharpen ? 3 : 2, barriers.data());
+
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_upscalePipeline);
+    VkDescriptorSet upscaleSet = writeDescriptorSet(inputView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, upscaleTargetView);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelineLayout, 0, 1, &upscaleSet, 0, nullptr);
+    vkCmdPushConstants(commandBuffer, m_pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(UpscaleConstants), &constants);
+    vkCmdDispatch(commandBuffer, groupsX, groupsY, 1);
+
+    if (sharpen) {
+        VkImageMemoryBarrier upscaled = imageBarrier(upscaleTarget, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+            VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL);
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &upscaled);
+
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_sharpenPipeline);
+        VkDescriptorSet sharpenSet = writeDescriptorSet(m_upscaledView, VK_IMAGE_LAYOUT_GENERAL, m_outputView);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelineLayout, 0, 1, &sharpenSet, 0, nullptr);
+        vkCmdDispatch(commandBuffer, groupsX, groupsY, 1);
+    }
+
+    // The UI samples the result in its render pass
+    VkImageMemoryBarrier output = imageBarrier(m_outputImage, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, OutputLayout, OutputLayout);
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        0, 0, nullptr, 0, nullptr, 1, &output);
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+void Upscaler::createPipelines(VkPipelineCache pipelineCache)
+{
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(UpscaleConstants);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_descriptorSetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    if (vkCreatePipelineLayout(m_device, &pipelineLayoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create upscaler pipeline layout!");
+    }
+
+    m_upscalePipeline = createPipeline("shaders/upscale.comp.spv", pipelineCache);
+    m_sharpenPipeline = createPipeline("shaders/sharpen.comp.spv", pipelineCache);
+}
+
+VkPipeline Upscaler::createPipeline(const char* shaderPath, VkPipelineCache pipelineCache)
+{
+    VkShaderModule computeModule = Shader::LoadModule(m_device, shaderPath);
+
+    VkComputePipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipelineInfo.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = computeModule;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.layout = m_pipelineLayout;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkResult result = vkCreateComputePipelines(m_device, pipelineCache, 1, &pipelineInfo, nullptr, &pipeline);
+    vkDestroyShaderModule(m_device, computeModule, nullptr);
+    if (result != VK_SUCCESS) {
+        throw std::runtime_error("failed to create upscaler pipeline!");
+    }
+    return pipeline;
+}
+
+void Upscaler::createImages()
+{
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.extent = { m_extent.width, m_extent.height, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.format = ImageFormat;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    // Recreated with the scene image on every resize, so they get dedicated memory like it
+    GpuAllocationInfo allocInfo{};
+    allocInfo.dedicated = true;
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = ImageFormat;
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+    m_allocator.CreateImage(imageInfo, allocInfo, m_upscaledImage, m_upscaledMemory);
+    viewInfo.image = m_upscaledImage;
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &m_upscaledView) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create upscaler image view!");
+    }
+    m_allocator.CreateImage(imageInfo, allocInfo, m_outputImage, m_outputMemory);
+    viewInfo.image = m_outputImage;
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &m_outputView) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create upscaler image view!");
+    }
+}
+
+void Upscaler::destroyImages()
+{
+    // Frames in flight may still be writing or sampling them
+    m_deletionQueue.DestroyImageView(m_upscaledView);
+    m_deletionQueue.DestroyImage(m_upscaledImage, m_upscaledMemory);
+    m_deletionQueue.DestroyImageView(m_outputView);
+    m_deletionQueue.DestroyImage(m_outputImage, m_outputMemory);
+}
+
+VkDescriptorSet Upscaler::writeDescriptorSet(VkImageView inputView, VkImageLayout inputLayout, VkImageView outputView)
+{
+    // Transient, so a resize never rewrites a set a frame in flight still uses
+    VkDescriptorSet descriptorSet = m_descriptorAllocator.AllocateTransient(m_descriptorSetLayout);
+
+    VkDescriptorImageInfo inputInfo{ m_sampler, inputView, inputLayout };
+    VkDescriptorImageInfo outputInfo{ VK_NULL_HANDLE, outputView, VK_IMAGE_LAYOUT_GENERAL };
+
+    std::array<VkWriteDescriptorSet, 2> writes{};
+    for (uint32_t binding = 0; binding < writes.size(); binding++) {
+        writes[binding].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[binding].dstSet = descriptorSet;
+        writes[binding].dstBinding = binding;
+        writes[binding].descriptorCount = 1;
+    }
+    writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    writes[0].pImageInfo = &inputInfo;
+    writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    writes[1].pImageInfo = &outputInfo;
+    vkUpdateDescriptorSets(m_device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    return descriptorSet;
+}
@@ -0,0 +1,87 @@
+#include "EngineCore/Scene/BenchmarkScene.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+std::vector<InstanceData> BenchmarkScene::CreateCubeGrid(uint32_t gridSize)
+{
+    std::vector<InstanceData> instances;
+    instances.reserve(static_cast<size_t>(gridSize) * gridSize * gridSize);
+
+    // Center the grid on the origin
+    float halfExtent = (gridSize - 1) * GridSpacing * 0.5f;
+    float colorScale = gridSize > 1 ? 1.0f / (gridSize - 1) : 0.0f;
+
+    for (uint32_t z = 0; z < gridSize; z++) {
+        for (uint32_t y = 0; y < gridSize; y++) {
+            for (uint32_t x = 0; x < gridSize; x++) {
+                glm::vec3 position(x * GridSpacing - halfExtent, y * GridSpacing - halfExtent, z * GridSpacing - halfExtent);
+
+                InstanceData instance;
+                instance.model = glm::translate(glm::mat4(1.0f), position);
+                instance.color = glm::vec4(0.25f + 0.75f * x * colorScale, 0.25f + 0.75f * y * colorScale, 0.25f + 0.75f * z * colorScale, 1.0f);
+                instances.push_back(instance);
+            }
+        }
+    }
+    return instances;
+}
+
+float BenchmarkScene::GetGridRadius(uint32_t gridSize)
+{
+    // Half the diagonal of the grid plus the half-diagonal of one unit cube
+    float halfExtent = (gridSize - 1) * GridSpacing * 0.5f;
+    return std::sqrt(3.0f) * (halfExtent + 0.5f);
+}
+
+MeshData BenchmarkScene::CreateSphereMesh(uint32_t segments)
+{
+    segments = std::max(segments, 3u);
+    uint32_t rings = std::max(segments / 2, 2u);
+    const float pi = 3.14159265358979f;
+
+    MeshData mesh;
+    mesh.name = "sphere_" + std::to_string(segments);
+
+    // A single vertex per pole and one per ring/segment crossing, shared by all adjacent triangles
+    mesh.vertices.push_back({ glm::vec3(0.0f, 0.5f, 0.0f), glm::vec3(0.5f, 1.0f, 0.5f) });
+    for (uint32_t ring = 1; ring < rings; ring++) {
+        float polar = pi * ring / rings;
+        for (uint32_t segment = 0; segment < segments; segment++) {
+            float azimuth = 2.0f * pi * segment / segments;
+            glm::vec3 normal(std::sin(polar) * std::cos(azimuth), std::cos(polar), std::sin(polar) * std::sin(azimuth));
+            mesh.vertices.push_back({ normal * 0.5f, normal * 0.5f + 0.5f });
+        }
+    }
+    uint32_t southPole = static_cast<uint32_t>(mesh.vertices.size());
+    mesh.vertices.push_back({ glm::vec3(0.0f, -0.5f, 0.0f), glm::vec3(0.5f, 0.0f, 0.5f) });
+
+    // Clockwise when seen from outside, like the cube
+    auto ringVertex = [segments](uint32_t ring, uint32_t segment) { return 1 + (ring - 1) * segments + segment % segments; };
+    for (uint32_t segment = 0; segment < segments; segment++) {
+        mesh.indices.insert(mesh.indices.end(), { 0, ringVertex(1, segment), ringVertex(1, segment + 1) });
+    }
+    for (uint32_t ring = 1; ring + 1 < rings; ring++) {
+        for (uint32_t segment = 0; segment < segments; segment++) {
+            uint32_t a = ringVertex(ring, segment);
+            uint32_t b = ringVertex(ring, segment + 1);
+            uint32_t c = ringVertex(ring + 1, segment);
+            uint32_t d = ringVertex(ring + 1, segment + 1);
+            mesh.indices.insert(mesh.indices.end(), { a, c, b, b, c, d });
+        }
+    }
+    for (uint32_t segment = 0; segment < segments; segment++) {
+        mesh.indices.insert(mesh.indices.end(), { southPole, ringVertex(rings - 1, segment + 1), ringVertex(rings - 1, segment) });
+    }
+
+    mesh.ComputeBounds();
+    mesh.ResetLods();
+    return mesh;
+}
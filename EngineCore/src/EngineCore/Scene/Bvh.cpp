@@ -0,0 +1,513 @@
+#include "EngineCore/Scene/Bvh.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace
+{
+    /// Nodes with at least this many objects bin their centroids on the thread pool.
+    constexpr size_t ParallelBinThreshold = 64 * 1024;
+    /// Traversal stack size; the depth is bounded by MaxSahDepth plus the median splits below it.
+    constexpr size_t StackSize = 128;
+
+    struct Bin
+    {
+        Aabb bounds;
+        uint32_t count = 0;
+    };
+    using BinGrid = std::array<std::array<Bin, Bvh::BinCount>, 3>;
+
+    uint32_t binIndex(float centroid, float minimum, float scale)
+    {
+        int bin = static_cast<int>((centroid - minimum) * scale);
+        return static_cast<uint32_t>(std::clamp(bin, 0, static_cast<int>(Bvh::BinCount) - 1));
+    }
+
+    // Slab test; returns the entry distance, or a negative value if the box is missed or further than maxDistance.
+    float intersectRay(const Aabb& box, const glm::vec3& origin, const glm::vec3& inverseDirection, float maxDistance)
+    {
+        glm::vec3 t1 = (box.min - origin) * inverseDirection;
+        glm::vec3 t2 = (box.max - origin) * inverseDirection;
+        glm::vec3 tNear = glm::min(t1, t2);
+        glm::vec3 tFar = glm::max(t1, t2);
+        float entry = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        float exit = std::min(std::min(tFar.x, tFar.y), tFar.z);
+        return entry <= exit && entry < maxDistance ? entry : -1.0f;
+    }
+}
+
+// =================================================================================
+// Building
+// =================================================================================
+
+void Bvh::Build(const std::vector<Aabb>& bounds, ThreadPool* threadPool)
+{
+    ENGINE_PROFILE_FUNCTION();
+    m_nodes.clear();
+    m_slotBounds.clear();
+    m_slotObjects.clear();
+    m_objectSlots.clear();
+    m_slotLeaves.clear();
+    m_parents.clear();
+    m_depth = 0;
+    if (bounds.empty()) {
+        return;
+    }
+
+    uint32_t objectCount = static_cast<uint32_t>(bounds.size());
+    m_buildBounds = &bounds;
+    m_centroids.resize(objectCount);
+    for (uint32_t i = 0; i < objectCount; i++) {
+        m_centroids[i] = bounds[i].Center();
+    }
+    m_slotObjects.resize(objectCount);
+    std::iota(m_slotObjects.begin(), m_slotObjects.end(), 0u);
+
+    BvhNode root;
+    root.objectCount = objectCount;
+    m_nodes.push_back(root);
+
+    // Top levels: split on the calling thread (binning large nodes in parallel) until the
+    // remaining subtrees are small enough to be built as independent jobs
+    std::vector<Subtree> pending = { { 0, 0, objectCount, 0 } };
+    std::vector<Subtree> jobs;
+    while (!pending.empty()) {
+        Subtree subtree = pending.back();
+        pending.pop_back();
+        if (!threadPool || subtree.end - subtree.begin <= SubtreeSize) {
+            jobs.push_back(subtree);
+            continue;
+        }
+
+        m_nodes[subtree.node].bounds = computeBounds(subtree.begin, subtree.end);
+        uint32_t middle = partition(m_nodes[subtree.node].bounds, subtree.begin, subtree.end, subtree.depth, threadPool);
+        uint32_t left = static_cast<uint32_t>(m_nodes.size());
+        m_nodes[subtree.node].leftChild = left;
+
+        BvhNode leftNode, rightNode;
+        leftNode.firstSlot = subtree.begin;
+        leftNode.objectCount = middle - subtree.begin;
+        rightNode.firstSlot = middle;
+        rightNode.objectCount = subtree.end - middle;
+        m_nodes.push_back(leftNode);
+        m_nodes.push_back(rightNode);
+        pending.push_back({ left, subtree.begin, middle, subtree.depth + 1 });
+        pending.push_back({ left + 1, middle, subtree.end, subtree.depth + 1 });
+        m_depth = std::max(m_depth, subtree.depth + 1);
+    }
+
+    // Subtrees touch disjoint slot ranges, so they can be built concurrently
+    std::vector<std::vector<BvhNode>> subtreeNodes(jobs.size());
+    std::vector<uint32_t> subtreeDepths(jobs.size(), 0);
+    if (threadPool && jobs.size() > 1) {
+        // Through ParallelFor, so queued background work on the pool never holds up the build
+        threadPool->ParallelFor(jobs.size(), 1, [this, &jobs, &subtreeNodes, &subtreeDepths](uint32_t, size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                subtreeNodes[i] = buildSubtree(jobs[i].begin, jobs[i].end, jobs[i].depth, subtreeDepths[i]);
+            }
+        });
+    } else {
+        for (size_t i = 0; i < jobs.size(); i++) {
+            subtreeNodes[i] = buildSubtree(jobs[i].begin, jobs[i].end, jobs[i].depth, subtreeDepths[i]);
+        }
+    }
+
+    // Splice each subtree in: its root replaces the placeholder, the rest is appended
+    for (size_t i = 0; i < jobs.size(); i++) {
+        uint32_t base = static_cast<uint32_t>(m_nodes.size());
+        uint32_t placeholder = jobs[i].node;
+        auto globalIndex = [base, placeholder](uint32_t local) { return local == 0 ? placeholder : base + local - 1; };
+        for (size_t local = 0; local < subtreeNodes[i].size(); local++) {
+            BvhNode node = subtreeNodes[i][local];
+            if (!node.IsLeaf()) {
+                node.leftChild = globalIndex(node.leftChild);
+            }
+            if (local == 0) {
+                m_nodes[placeholder] = node;
+            } else {
+                m_nodes.push_back(node);
+            }
+        }
+        m_depth = std::max(m_depth, subtreeDepths[i]);
+    }
+
+    // Store the object bounds in leaf order for cache-friendly queries
+    m_slotBounds.resize(objectCount);
+    m_objectSlots.resize(objectCount);
+    for (uint32_t slot = 0; slot < objectCount; slot++) {
+        m_slotBounds[slot] = bounds[m_slotObjects[slot]];
+        m_objectSlots[m_slotObjects[slot]] = slot;
+    }
+    linkParents();
+
+    m_centroids.clear();
+    m_centroids.shrink_to_fit();
+    m_buildBounds = nullptr;
+}
+
+std::vector<BvhNode> Bvh::buildSubtree(uint32_t begin, uint32_t end, uint32_t depth, uint32_t& maxDepth)
+{
+    std::vector<BvhNode> nodes(1);
+    nodes[0].firstSlot = begin;
+    nodes[0].objectCount = end - begin;
+    maxDepth = depth;
+
+    std::vector<Subtree> stack = { { 0, begin, end, depth } };
+    while (!stack.empty()) {
+        Subtree subtree = stack.back();
+        stack.pop_back();
+        nodes[subtree.node].bounds = computeBounds(subtree.begin, subtree.end);
+        uint32_t middle = partition(nodes[subtree.node].bounds, subtree.begin, subtree.end, subtree.depth, nullptr);
+        if (middle == subtree.end) {
+            continue; // Leaf
+        }
+
+        uint32_t left = static_cast<uint32_t>(nodes.size());
+        nodes[subtree.node].leftChild = left;
+        BvhNode leftNode, rightNode;
+        leftNode.firstSlot = subtree.begin;
+        leftNode.objectCount = middle - subtree.begin;
+        rightNode.firstSlot = middle;
+        rightNode.objectCount = subtree.end - middle;
+        nodes.push_back(leftNode);
+        nodes.push_back(rightNode);
+        stack.push_back({ left, subtree.begin, middle, subtree.depth + 1 });
+        stack.push_back({ left + 1, middle, subtree.end, subtree.depth + 1 });
+        maxDepth = std::max(maxDepth, subtree.depth + 1);
+    }
+    return nodes;
+}
+
+uint32_t Bvh::partition(const Aabb& nodeBounds, uint32_t begin, uint32_t end, uint32_t depth, ThreadPool* threadPool)
+{
+    uint32_t count = end - begin;
+    if (count <= 1) {
+        return end;
+    }
+
+    Aabb centroidBounds;
+    for (uint32_t slot = begin; slot < end; slot++) {
+        centroidBounds.Grow(m_centroids[m_slotObjects[slot]]);
+    }
+    glm::vec3 extent = centroidBounds.Extent();
+    int largestAxis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+
+    // Median split along the widest axis: bounds the depth and handles coincident centroids
+    auto medianSplit = [&]() {
+        if (count <= MaxLeafSize) {
+            return end;
+        }
+        uint32_t middle = begin + count / 2;
+        std::nth_element(m_slotObjects.begin() + begin, m_slotObjects.begin() + middle, m_slotObjects.begin() + end,
+            [this, largestAxis](uint32_t a, uint32_t b) { return m_centroids[a][largestAxis] < m_centroids[b][largestAxis]; });
+        return middle;
+    };
+    if (depth >= MaxSahDepth || extent[largestAxis] <= 0.0f) {
+        return medianSplit();
+    }
+
+    // Bin the centroids on all three axes
+    glm::vec3 scale;
+    for (int axis = 0; axis < 3; axis++) {
+        scale[axis] = extent[axis] > 0.0f ? BinCount / extent[axis] : 0.0f;
+    }
+    auto fillBins = [&](BinGrid& bins, size_t first, size_t last) {
+        for (size_t slot = first; slot < last; slot++) {
+            uint32_t object = m_slotObjects[slot];
+            const Aabb& box = (*m_buildBounds)[object];
+            for (int axis = 0; axis < 3; axis++) {
+                Bin& bin = bins[axis][binIndex(m_centroids[object][axis], centroidBounds.min[axis], scale[axis])];
+                bin.bounds.Grow(box);
+                bin.count++;
+            }
+        }
+    };
+    BinGrid bins{};
+    if (threadPool && count >= ParallelBinThreshold) {
+        std::vector<BinGrid> partialBins(threadPool->GetThreadCount() + 1);
+        uint32_t batchCount = threadPool->ParallelFor(count, ParallelBinThreshold / 4, [&](uint32_t batch, size_t first, size_t last) {
+            fillBins(partialBins[batch], begin + first, begin + last);
+        });
+        for (uint32_t batch = 0; batch < batchCount; batch++) {
+            for (int axis = 0; axis < 3; axis++) {
+                for (uint32_t i = 0; i < BinCount; i++) {
+                    bins[axis][i].bounds.Grow(partialBins[batch][axis][i].bounds);
+                    bins[axis][i].count += partialBins[batch][axis][i].count;
+                }
+            }
+        }
+    } else {
+        fillBins(bins, begin, end);
+    }
+
+    // Evaluate the SAH for each split plane between bins: sweep from the right, then from the left
+    float bestCost = std::numeric_limits<float>::max();
+    int bestAxis = -1;
+    uint32_t bestSplit = 0;
+    for (int axis = 0; axis < 3; axis++) {
+        if (extent[axis] <= 0.0f) {
+            continue;
+        }
+        std::array<float, BinCount> rightCost{};
+        Aabb rightBounds;
+        uint32_t rightCount = 0;
+        for (uint32_t i = BinCount - 1; i > 0; i--) {
+            rightBounds.Grow(bins[axis][i].bounds);
+            rightCount += bins[axis][i].count;
+            rightCost[i - 1] = rightBounds.SurfaceArea() * rightCount;
+        }
+        Aabb leftBounds;
+        uint32_t leftCount = 0;
+        for (uint32_t i = 0; i + 1 < BinCount; i++) {
+            leftBounds.Grow(bins[axis][i].bounds);
+            leftCount += bins[axis][i].count;
+            float cost = leftBounds.SurfaceArea() * leftCount + rightCost[i];
+            if (leftCount > 0 && leftCount < count && cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = i;
+            }
+        }
+    }
+
+    // Small nodes stay leaves when splitting is not expected to pay off (intersection and traversal cost 1)
+    float nodeArea = nodeBounds.SurfaceArea();
+    if (bestAxis < 0) {
+        return medianSplit();
+    }
+    if (count <= MaxLeafSize && nodeArea > 0.0f && 1.0f + bestCost / nodeArea >= static_cast<float>(count)) {
+        return end;
+    }
+
+    float minimum = centroidBounds.min[bestAxis];
+    float axisScale = scale[bestAxis];
+    auto middle = std::partition(m_slotObjects.begin() + begin, m_slotObjects.begin() + end,
+        [this, bestAxis, bestSplit, minimum, axisScale](uint32_t object) {
+            return binIndex(m_centroids[object][bestAxis], minimum, axisScale) <= bestSplit;
+        });
+    return static_cast<uint32_t>(middle - m_slotObjects.begin());
+}
+
+Aabb Bvh::computeBounds(uint32_t begin, uint32_t end) const
+{
+    Aabb bounds;
+    for (uint32_t slot = begin; slot < end; slot++) {
+        bounds.Grow((*m_buildBounds)[m_slotObjects[slot]]);
+    }
+    return bounds;
+}
+
+void Bvh::linkParents()
+{
+    m_parents.assign(m_nodes.size(), 0);
+    m_slotLeaves.resize(m_slotObjects.size());
+    for (uint32_t index = 0; index < m_nodes.size(); index++) {
+        const BvhNode& node = m_nodes[index];
+        if (node.IsLeaf()) {
+            std::fill(m_slotLeaves.begin() + node.firstSlot, m_slotLeaves.begin() + node.firstSlot + node.objectCount, index);
+        } else {
+            m_parents[node.leftChild] = index;
+            m_parents[node.leftChild + 1] = index;
+        }
+    }
+}
+
+// =================================================================================
+// Refitting
+// =================================================================================
+
+void Bvh::UpdateObject(uint32_t objectIndex, const Aabb& bounds)
+{
+    uint32_t slot = m_objectSlots[objectIndex];
+    m_slotBounds[slot] = bounds;
+
+    // Walk towards the root until a node's bounds stay the same
+    uint32_t index = m_slotLeaves[slot];
+    for (;;) {
+        Aabb previous = m_nodes[index].bounds;
+        refitNode(m_nodes[index]);
+        if (m_nodes[index].bounds == previous || index == 0) {
+            break;
+        }
+        index = m_parents[index];
+    }
+}
+
+void Bvh::Refit(const std::vector<Aabb>& bounds)
+{
+    ENGINE_PROFILE_FUNCTION();
+    for (uint32_t slot = 0; slot < m_slotObjects.size(); slot++) {
+        m_slotBounds[slot] = bounds[m_slotObjects[slot]];
+    }
+    // Children always come after their parent, so a reverse sweep refits bottom-up
+    for (size_t index = m_nodes.size(); index-- > 0;) {
+        refitNode(m_nodes[index]);
+    }
+}
+
+void Bvh::refitNode(BvhNode& node)
+{
+    Aabb bounds;
+    if (node.IsLeaf()) {
+        for (uint32_t slot = node.firstSlot; slot < node.firstSlot + node.objectCount; slot++) {
+            bounds.Grow(m_slotBounds[slot]);
+        }
+    } else {
+        bounds.Grow(m_nodes[node.leftChild].bounds);
+        bounds.Grow(m_nodes[node.leftChild + 1].bounds);
+    }
+    node.bounds = bounds;
+}
+
+// =================================================================================
+// Queries
+// =================================================================================
+
+size_t Bvh::QueryFrustum(const Frustum& frustum, std::vector<uint32_t>& visible, BvhQueryStats* stats) const
+{
+    ENGINE_PROFILE_FUNCTION();
+    visible.clear();
+    if (m_nodes.empty()) {
+        return 0;
+    }
+
+    BvhQueryStats counters;
+    uint32_t stack[StackSize];
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const BvhNode& node = m_nodes[stack[--stackSize]];
+        counters.visitedNodes++;
+
+        Frustum::Containment containment = frustum.ClassifyAabb(node.bounds.min, node.bounds.max);
+        if (containment == Frustum::Outside) {
+            continue;
+        }
+        if (containment == Frustum::Inside) {
+            // The whole subtree is visible: emit its slot range without descending
+            visible.insert(visible.end(), m_slotObjects.begin() + node.firstSlot, m_slotObjects.begin() + node.firstSlot + node.objectCount);
+            continue;
+        }
+        if (node.IsLeaf()) {
+            for (uint32_t slot = node.firstSlot; slot < node.firstSlot + node.objectCount; slot++) {
+                counters.testedObjects++;
+                if (frustum.IntersectsAabb(m_slotBounds[slot].min, m_slotBounds[slot].max)) {
+                    visible.push_back(m_slotObjects[slot]);
+                }
+            }
+        } else {
+            stack[stackSize++] = node.leftChild + 1;
+            stack[stackSize++] = node.leftChild;
+        }
+    }
+
+    if (stats) {
+        *stats = counters;
+    }
+    return visible.size();
+}
+
+size_t Bvh::QueryAabb(const Aabb& box, std::vector<uint32_t>& overlapping, BvhQueryStats* stats) const
+{
+    overlapping.clear();
+    if (m_nodes.empty()) {
+        return 0;
+    }
+
+    BvhQueryStats counters;
+    uint32_t stack[StackSize];
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const BvhNode& node = m_nodes[stack[--stackSize]];
+        counters.visitedNodes++;
+
+        if (!box.Overlaps(node.bounds)) {
+            continue;
+        }
+        if (box.Contains(node.bounds)) {
+            overlapping.insert(overlapping.end(), m_slotObjects.begin() + node.firstSlot, m_slotObjects.begin() + node.firstSlot + node.objectCount);
+            continue;
+        }
+        if (node.IsLeaf()) {
+            for (uint32_t slot = node.firstSlot; slot < node.firstSlot + node.objectCount; slot++) {
+                counters.testedObjects++;
+                if (box.Overlaps(m_slotBounds[slot])) {
+                    overlapping.push_back(m_slotObjects[slot]);
+                }
+            }
+        } else {
+            stack[stackSize++] = node.leftChild + 1;
+            stack[stackSize++] = node.leftChild;
+        }
+    }
+
+    if (stats) {
+        *stats = counters;
+    }
+    return overlapping.size();
+}
+
+bool Bvh::Raycast(const Ray& ray, RayHit& hit, float maxDistance, BvhQueryStats* stats) const
+{
+    hit = RayHit{};
+    if (m_nodes.empty()) {
+        return false;
+    }
+
+    // Zero direction components become huge reciprocals instead of infinities, which keeps the slab test NaN-free
+    glm::vec3 inverseDirection;
+    for (int axis = 0; axis < 3; axis++) {
+        float component = ray.direction[axis];
+        inverseDirection[axis] = 1.0f / (std::abs(component) > 1e-20f ? component : 1e-20f);
+    }
+
+    BvhQueryStats counters;
+    float closest = maxDistance;
+    uint32_t stack[StackSize];
+    size_t stackSize = 0;
+    if (intersectRay(m_nodes[0].bounds, ray.origin, inverseDirection, closest) >= 0.0f) {
+        stack[stackSize++] = 0;
+    }
+    while (stackSize > 0) {
+        const BvhNode& node = m_nodes[stack[--stackSize]];
+        counters.visitedNodes++;
+
+        if (node.IsLeaf()) {
+            for (uint32_t slot = node.firstSlot; slot < node.firstSlot + node.objectCount; slot++) {
+                counters.testedObjects++;
+                float distance = intersectRay(m_slotBounds[slot], ray.origin, inverseDirection, closest);
+                if (distance >= 0.0f) {
+                    closest = distance;
+                    hit.objectIndex = m_slotObjects[slot];
+                    hit.distance = distance;
+                }
+            }
+            continue;
+        }
+
+        // Visit the nearer child first by pushing it last; boxes beyond the closest hit are skipped
+        uint32_t nearChild = node.leftChild;
+        uint32_t farChild = node.leftChild + 1;
+        float nearDistance = intersectRay(m_nodes[nearChild].bounds, ray.origin, inverseDirection, closest);
+        float farDistance = intersectRay(m_nodes[farChild].bounds, ray.origin, inverseDirection, closest);
+        if (farDistance >= 0.0f && (nearDistance < 0.0f || farDistance < nearDistance)) {
+            std::swap(nearChild, farChild);
+            std::swap(nearDistance, farDistance);
+        }
+        if (farDistance >= 0.0f) {
+            stack[stackSize++] = farChild;
+        }
+        if (nearDistance >= 0.0f) {
+            stack[stackSize++] = nearChild;
+        }
+    }
+
+    if (stats) {
+        *stats = counters;
+    }
+    return hit.objectIndex != std::numeric_limits<uint32_t>::max();
+}
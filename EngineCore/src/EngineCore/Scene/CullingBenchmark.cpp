@@ -0,0 +1,142 @@
+#include "EngineCore/Scene/CullingBenchmark.hpp"
+#include "EngineCore/Scene/CullingSystem.hpp"
+#include "EngineCore/Scene/Bvh.hpp"
+#include "EngineCore/Camera.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Times repeated calls of a culling pass and returns the median duration in seconds.
+    template<typename Pass>
+    double medianSeconds(const Pass& pass)
+    {
+        pass(); // Warm up caches and the scratch buffers
+        std::vector<double> samples;
+        samples.reserve(CullingBenchmark::Iterations);
+        for (uint32_t i = 0; i < CullingBenchmark::Iterations; i++) {
+            auto start = std::chrono::steady_clock::now();
+            pass();
+            auto end = std::chrono::steady_clock::now();
+            samples.push_back(std::chrono::duration<double>(end - start).count());
+        }
+        return TimingSummary::FromSamples(samples).median;
+    }
+
+    double objectsPerSecond(size_t objectCount, double seconds)
+    {
+        return seconds > 0.0 ? objectCount / seconds : 0.0;
+    }
+
+    /// The number of rays and boxes per timed query pass.
+    constexpr size_t QueriesPerPass = 1000;
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+BenchmarkReport CullingBenchmark::Run()
+{
+    ThreadPool threadPool;
+    SimdLevel supported = CullingSystem::GetSupportedSimdLevel();
+    Log::GetCoreLogger()->info("Running culling benchmark ({0}, {1} worker threads)...", ToString(supported), threadPool.GetThreadCount());
+
+    BenchmarkReport report("culling");
+    report.AddValue("threads", static_cast<double>(threadPool.GetThreadCount() + 1));
+    report.AddValue("simd_level", static_cast<double>(supported));
+
+    const size_t objectCounts[] = { 10000, 100000, 1000000 };
+    for (size_t objectCount : objectCounts) {
+        // Scatter the objects in a cube whose volume grows with their number, so density stays constant
+        float halfExtent = std::cbrt(static_cast<float>(objectCount)) * 2.0f;
+        std::mt19937 random(12345);
+        std::uniform_real_distribution<float> position(-halfExtent, halfExtent);
+        std::uniform_real_distribution<float> size(0.25f, 1.0f);
+
+        SphereBoundsSoA spheres;
+        AabbBoundsSoA boxes;
+        std::vector<Aabb> objectBounds;
+        spheres.Reserve(objectCount);
+        boxes.Reserve(objectCount);
+        objectBounds.reserve(objectCount);
+        for (size_t i = 0; i < objectCount; i++) {
+            glm::vec3 center(position(random), position(random), position(random));
+            float radius = size(random);
+            spheres.Add(center, radius);
+            boxes.Add(center - glm::vec3(radius), center + glm::vec3(radius));
+            objectBounds.push_back({ center - glm::vec3(radius), center + glm::vec3(radius) });
+        }
+
+        // Orbit the middle of the volume from inside it, so a realistic fraction is visible
+        Camera camera(45.0f, 16.0f / 9.0f, 0.1f, halfExtent * 2.0f);
+        camera.Focus(glm::vec3(0.0f), halfExtent * 0.5f);
+        Frustum frustum = camera.GetFrustum();
+
+        std::vector<uint32_t> visible;
+        for (SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE, SimdLevel::AVX2 }) {
+            if (level > supported) {
+                continue;
+            }
+            for (bool threaded : { false, true }) {
+                CullingSystem culling(threaded ? &threadPool : nullptr);
+                culling.SetSimdLevel(level);
+                std::string prefix = std::string(ToString(level)) + (threaded ? "_mt_" : "_st_") + std::to_string(objectCount);
+
+                double sphereSeconds = medianSeconds([&]() { culling.CullSpheres(frustum, spheres, visible); });
+                report.AddValue("spheres_" + prefix + "_objects_per_sec", objectsPerSecond(objectCount, sphereSeconds));
+                report.AddValue("spheres_" + prefix + "_visible", static_cast<double>(visible.size()));
+
+                double boxSeconds = medianSeconds([&]() { culling.CullAabbs(frustum, boxes, visible); });
+                report.AddValue("aabbs_" + prefix + "_objects_per_sec", objectsPerSecond(objectCount, boxSeconds));
+                report.AddValue("aabbs_" + prefix + "_visible", static_cast<double>(visible.size()));
+            }
+        }
+
+        // BVH build on one thread and on the pool, then queries against the threaded build
+        std::string suffix = "_" + std::to_string(objectCount);
+        Bvh bvh;
+        double buildSeconds = medianSeconds([&]() { bvh.Build(objectBounds); });
+        report.AddValue("bvh_build_st_ms" + suffix, buildSeconds * 1000.0);
+        buildSeconds = medianSeconds([&]() { bvh.Build(objectBounds, &threadPool); });
+        report.AddValue("bvh_build_mt_ms" + suffix, buildSeconds * 1000.0);
+        report.AddValue("bvh_nodes" + suffix, static_cast<double>(bvh.GetNodeCount()));
+        report.AddValue("bvh_depth" + suffix, static_cast<double>(bvh.GetDepth()));
+
+        // Objects per second relates the hierarchical query to the linear passes above
+        BvhQueryStats stats;
+        double frustumSeconds = medianSeconds([&]() { bvh.QueryFrustum(frustum, visible, &stats); });
+        report.AddValue("bvh_frustum" + suffix + "_objects_per_sec", objectsPerSecond(objectCount, frustumSeconds));
+        report.AddValue("bvh_frustum" + suffix + "_visible", static_cast<double>(visible.size()));
+        report.AddValue("bvh_frustum" + suffix + "_visited_nodes", static_cast<double>(stats.visitedNodes));
+
+        std::vector<Ray> rays;
+        std::vector<Aabb> queryBoxes;
+        for (size_t i = 0; i < QueriesPerPass; i++) {
+            glm::vec3 origin(position(random), position(random), position(random));
+            glm::vec3 target(position(random), position(random), position(random));
+            rays.push_back({ origin, target - origin });
+            queryBoxes.push_back({ origin - glm::vec3(2.0f), origin + glm::vec3(2.0f) });
+        }
+        double raySeconds = medianSeconds([&]() {
+            RayHit hit;
+            for (const Ray& ray : rays) {
+                bvh.Raycast(ray, hit);
+            }
+        });
+        report.AddValue("bvh_rays" + suffix + "_per_sec", objectsPerSecond(QueriesPerPass, raySeconds));
+        double overlapSeconds = medianSeconds([&]() {
+            for (const Aabb& box : queryBoxes) {
+                bvh.QueryAabb(box, visible);
+            }
+        });
+        report.AddValue("bvh_aabb_queries" + suffix + "_per_sec", objectsPerSecond(QueriesPerPass, overlapSeconds));
+    }
+    return report;
+}
@@ -0,0 +1,363 @@
+#include "EngineCore/Scene/CullingSystem.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define ENGINE_CULLING_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define ENGINE_CULLING_X86 0
+#endif
+
+// GCC and Clang only emit instructions for the targets a function is compiled for,
+// so the wider kernels are compiled per function and selected at runtime. MSVC
+// allows any intrinsic without extra flags.
+#if defined(__GNUC__) || defined(__clang__)
+#define ENGINE_TARGET_SSE __attribute__((target("sse2")))
+#define ENGINE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define ENGINE_TARGET_SSE
+#define ENGINE_TARGET_AVX2
+#endif
+
+// =================================================================================
+// Bounding Volume Containers
+// =================================================================================
+
+void SphereBoundsSoA::Reserve(size_t count)
+{
+    centerX.reserve(count);
+    centerY.reserve(count);
+    centerZ.reserve(count);
+    radius.reserve(count);
+}
+
+void SphereBoundsSoA::Clear()
+{
+    centerX.clear();
+    centerY.clear();
+    centerZ.clear();
+    radius.clear();
+}
+
+void SphereBoundsSoA::Add(const glm::vec3& center, float sphereRadius)
+{
+    centerX.push_back(center.x);
+    centerY.push_back(center.y);
+    centerZ.push_back(center.z);
+    radius.push_back(sphereRadius);
+}
+
+void AabbBoundsSoA::Reserve(size_t count)
+{
+    minX.reserve(count);
+    minY.reserve(count);
+    minZ.reserve(count);
+    maxX.reserve(count);
+    maxY.reserve(count);
+    maxZ.reserve(count);
+}
+
+void AabbBoundsSoA::Clear()
+{
+    minX.clear();
+    minY.clear();
+    minZ.clear();
+    maxX.clear();
+    maxY.clear();
+    maxZ.clear();
+}
+
+void AabbBoundsSoA::Add(const glm::vec3& min, const glm::vec3& max)
+{
+    minX.push_back(min.x);
+    minY.push_back(min.y);
+    minZ.push_back(min.z);
+    maxX.push_back(max.x);
+    maxY.push_back(max.y);
+    maxZ.push_back(max.z);
+}
+
+const char* ToString(SimdLevel level)
+{
+    switch (level) {
+        case SimdLevel::SSE: return "sse";
+        case SimdLevel::AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+// =================================================================================
+// Kernels
+// =================================================================================
+
+namespace
+{
+    size_t cullSpheresScalar(const Frustum& frustum, const SphereBoundsSoA& bounds, size_t begin, size_t end, uint32_t* out)
+    {
+        size_t count = 0;
+        for (size_t i = begin; i < end; i++) {
+            glm::vec3 center(bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i]);
+            out[count] = static_cast<uint32_t>(i);
+            count += frustum.IntersectsSphere(center, bounds.radius[i]) ? 1 : 0;
+        }
+        return count;
+    }
+
+    size_t cullAabbsScalar(const Frustum& frustum, const AabbBoundsSoA& bounds, size_t begin, size_t end, uint32_t* out)
+    {
+        size_t count = 0;
+        for (size_t i = begin; i < end; i++) {
+            glm::vec3 min(bounds.minX[i], bounds.minY[i], bounds.minZ[i]);
+            glm::vec3 max(bounds.maxX[i], bounds.maxY[i], bounds.maxZ[i]);
+            out[count] = static_cast<uint32_t>(i);
+            count += frustum.IntersectsAabb(min, max) ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Appends the indices of the set lanes of a movemask result, without branches.
+     */
+    inline size_t appendLanes(int mask, uint32_t lanes, size_t first, uint32_t* out)
+    {
+        size_t count = 0;
+        for (uint32_t lane = 0; lane < lanes; lane++) {
+            out[count] = static_cast<uint32_t>(first + lane);
+            count += (mask >> lane) & 1;
+        }
+        return count;
+    }
+
+#if ENGINE_CULLING_X86
+
+    ENGINE_TARGET_SSE size_t cullSpheresSse(const Frustum& frustum, const SphereBoundsSoA& bounds, size_t begin, size_t end, uint32_t* out)
+    {
+        __m128 planeX[Frustum::PlaneCount], planeY[Frustum::PlaneCount], planeZ[Frustum::PlaneCount], planeW[Frustum::PlaneCount];
+        for (int p = 0; p < Frustum::PlaneCount; p++) {
+            planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+            planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+            planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+            planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+        }
+
+        size_t count = 0;
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            __m128 x = _mm_loadu_ps(&bounds.centerX[i]);
+            __m128 y = _mm_loadu_ps(&bounds.centerY[i]);
+            __m128 z = _mm_loadu_ps(&bounds.centerZ[i]);
+            __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&bounds.radius[i]));
+
+            // Inside unless the signed distance to some plane is below -radius
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int p = 0; p < Frustum::PlaneCount; p++) {
+                __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(planeX[p], x), _mm_mul_ps(planeY[p], y)),
+                                             _mm_add_ps(_mm_mul_ps(planeZ[p], z), planeW[p]));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negRadius));
+            }
+            count += appendLanes(_mm_movemask_ps(inside), 4, i, out + count);
+        }
+        return count + cullSpheresScalar(frustum, bounds, i, end, out + count);
+    }
+
+    ENGINE_TARGET_SSE size_t cullAabbsSse(const Frustum& frustum, const AabbBoundsSoA& bounds, size_t begin, size_t end, uint32_t* out)
+    {
+        size_t count = 0;
+        size_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int p = 0; p < Frustum::PlaneCount; p++) {
+                // The plane is the same for all lanes, so the positive vertex is picked per component array
+                const glm::vec4& plane = frustum.planes[p];
+                __m128 x = _mm_loadu_ps(plane.x >= 0.0f ? &bounds.maxX[i] : &bounds.minX[i]);
+                __m128 y = _mm_loadu_ps(plane.y >= 0.0f ? &bounds.maxY[i] : &bounds.minY[i]);
+                __m128 z = _mm_loadu_ps(plane.z >= 0.0f ? &bounds.maxZ[i] : &bounds.minZ[i]);
+                __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_mul_ps(_mm_set1_ps(plane.y), y)),
+                                             _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.z), z), _mm_set1_ps(plane.w)));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+            }
+            count += appendLanes(_mm_movemask_ps(inside), 4, i, out + count);
+        }
+        return count + cullAabbsScalar(frustum, bounds, i, end, out + count);
+    }
+
+    ENGINE_TARGET_AVX2 size_t cullSpheresAvx2(const Frustum& frustum, const SphereBoundsSoA& bounds, size_t begin, size_t end, uint32_t* out)
+    {
+        __m256 planeX[Frustum::PlaneCount], planeY[Frustum::PlaneCount], planeZ[Frustum::PlaneCount], planeW[Frustum::PlaneCount];
+        for (int p = 0; p < Frustum::PlaneCount; p++) {
+            planeX[p] = _mm256_set1_ps(frustum.planes[p].x);
+            planeY[p] = _mm256_set1_ps(frustum.planes[p].y);
+            planeZ[p] = _mm256_set1_ps(frustum.planes[p].z);
+            planeW[p] = _mm256_set1_ps(frustum.planes[p].w);
+        }
+
+        size_t count = 0;
+        size_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m256 x = _mm256_loadu_ps(&bounds.centerX[i]);
+            __m256 y = _mm256_loadu_ps(&bounds.centerY[i]);
+            __m256 z = _mm256_loadu_ps(&bounds.centerZ[i]);
+            __m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(&bounds.radius[i]));
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (int p = 0; p < Frustum::PlaneCount; p++) {
+                __m256 distance = _mm256_fmadd_ps(planeX[p], x, _mm256_fmadd_ps(planeY[p], y, _mm256_fmadd_ps(planeZ[p], z, planeW[p])));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_GE_OQ));
+            }
+            count += appendLanes(_mm256_movemask_ps(inside), 8, i, out + count);
+        }
+        return count + cullSpheresSse(frustum, bounds, i, end, out + count);
+    }
+
+    ENGINE_TARGET_AVX2 size_t cullAabbsAvx2(const Frustum& frustum, const AabbBoundsSoA& bounds, size_t begin, size_t end, uint32_t* out)
+    {
+        size_t count = 0;
+        size_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (int p = 0; p < Frustum::PlaneCount; p++) {
+                const glm::vec4& plane = frustum.planes[p];
+                __m256 x = _mm256_loadu_ps(plane.x >= 0.0f ? &bounds.maxX[i] : &bounds.minX[i]);
+                __m256 y = _mm256_loadu_ps(plane.y >= 0.0f ? &bounds.maxY[i] : &bounds.minY[i]);
+                __m256 z = _mm256_loadu_ps(plane.z >= 0.0f ? &bounds.maxZ[i] : &bounds.minZ[i]);
+                __m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.x), x,
+                                  _mm256_fmadd_ps(_mm256_set1_ps(plane.y), y,
+                                  _mm256_fmadd_ps(_mm256_set1_ps(plane.z), z, _mm256_set1_ps(plane.w))));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+            }
+            count += appendLanes(_mm256_movemask_ps(inside), 8, i, out + count);
+        }
+        return count + cullAabbsSse(frustum, bounds, i, end, out + count);
+    }
+
+#endif
+
+    SimdLevel detectSimdLevel()
+    {
+#if ENGINE_CULLING_X86
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool osXsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        bool fma = (info[2] & (1 << 12)) != 0;
+        // The OS must also save the YMM registers on context switches
+        if (maxLeaf >= 7 && osXsave && avx && fma && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) {
+                return SimdLevel::AVX2;
+            }
+        }
+        return SimdLevel::SSE;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? SimdLevel::AVX2 : SimdLevel::SSE;
+#endif
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+}
+
+// =================================================================================
+// Constructor
+// =================================================================================
+
+SimdLevel CullingSystem::GetSupportedSimdLevel()
+{
+    static const SimdLevel supported = detectSimdLevel();
+    return supported;
+}
+
+CullingSystem::CullingSystem(ThreadPool* threadPool)
+    : m_threadPool(threadPool), m_simdLevel(GetSupportedSimdLevel())
+{
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void CullingSystem::SetSimdLevel(SimdLevel level)
+{
+    m_simdLevel = std::min(level, GetSupportedSimdLevel());
+}
+
+size_t CullingSystem::CullSpheres(const Frustum& frustum, const SphereBoundsSoA& bounds, std::vector<uint32_t>& visible)
+{
+    ENGINE_PROFILE_FUNCTION();
+    auto kernel = cullSpheresScalar;
+#if ENGINE_CULLING_X86
+    if (m_simdLevel == SimdLevel::AVX2) {
+        kernel = cullSpheresAvx2;
+    } else if (m_simdLevel == SimdLevel::SSE) {
+        kernel = cullSpheresSse;
+    }
+#endif
+    return run(bounds.Size(), visible, [&](size_t begin, size_t end, uint32_t* out) {
+        return kernel(frustum, bounds, begin, end, out);
+    });
+}
+
+size_t CullingSystem::CullAabbs(const Frustum& frustum, const AabbBoundsSoA& bounds, std::vector<uint32_t>& visible)
+{
+    ENGINE_PROFILE_FUNCTION();
+    auto kernel = cullAabbsScalar;
+#if ENGINE_CULLING_X86
+    if (m_simdLevel == SimdLevel::AVX2) {
+        kernel = cullAabbsAvx2;
+    } else if (m_simdLevel == SimdLevel::SSE) {
+        kernel = cullAabbsSse;
+    }
+#endif
+    return run(bounds.Size(), visible, [&](size_t begin, size_t end, uint32_t* out) {
+        return kernel(frustum, bounds, begin, end, out);
+    });
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+template<typename Kernel>
+size_t CullingSystem::run(size_t count, std::vector<uint32_t>& visible, const Kernel& kernel)
+{
+    visible.clear();
+    if (count == 0) {
+        return 0;
+    }
+    if (m_scratch.size() < count) {
+        m_scratch.resize(count);
+    }
+
+    // Each batch compacts into its own slice of the scratch buffer, so no synchronization is needed
+    uint32_t maxBatches = m_threadPool ? m_threadPool->GetThreadCount() + 1 : 1;
+    m_batchBegins.assign(maxBatches, 0);
+    m_batchCounts.assign(maxBatches, 0);
+    auto cullBatch = [this, &kernel](uint32_t batch, size_t begin, size_t end) {
+        m_batchBegins[batch] = begin;
+        m_batchCounts[batch] = kernel(begin, end, m_scratch.data() + begin);
+    };
+
+    uint32_t batchCount = 1;
+    if (m_threadPool && count >= 2 * MinBatchSize) {
+        batchCount = m_threadPool->ParallelFor(count, MinBatchSize, cullBatch);
+    } else {
+        cullBatch(0, 0, count);
+    }
+
+    // Concatenate the batches in order, which keeps the indices sorted
+    for (uint32_t batch = 0; batch < batchCount; batch++) {
+        const uint32_t* first = m_scratch.data() + m_batchBegins[batch];
+        visible.insert(visible.end(), first, first + m_batchCounts[batch]);
+    }
+    return visible.size();
+}
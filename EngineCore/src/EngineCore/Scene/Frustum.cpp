@@ -0,0 +1,75 @@
+#include "EngineCore/Scene/Frustum.hpp"
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+Frustum Frustum::FromMatrix(const glm::mat4& viewProjection)
+{
+    // glm is column-major: row i of the matrix is (m[0][i], m[1][i], m[2][i], m[3][i])
+    auto row = [&viewProjection](int i) {
+        return glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+    };
+    glm::vec4 row0 = row(0), row1 = row(1), row2 = row(2), row3 = row(3);
+
+    Frustum frustum;
+    frustum.planes[Left] = row3 + row0;
+    frustum.planes[Right] = row3 - row0;
+    frustum.planes[Bottom] = row3 + row1;
+    frustum.planes[Top] = row3 - row1;
+    frustum.planes[Near] = row3 + row2;
+    frustum.planes[Far] = row3 - row2;
+
+    for (glm::vec4& plane : frustum.planes) {
+        float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f) {
+            plane /= length;
+        }
+    }
+    return frustum;
+}
+
+bool Frustum::IntersectsSphere(const glm::vec3& center, float radius) const
+{
+    for (const glm::vec4& plane : planes) {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::IntersectsAabb(const glm::vec3& min, const glm::vec3& max) const
+{
+    for (const glm::vec4& plane : planes) {
+        // Test the corner furthest along the plane normal (the "positive vertex")
+        glm::vec3 positive(plane.x >= 0.0f ? max.x : min.x,
+                           plane.y >= 0.0f ? max.y : min.y,
+                           plane.z >= 0.0f ? max.z : min.z);
+        if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Frustum::Containment Frustum::ClassifyAabb(const glm::vec3& min, const glm::vec3& max) const
+{
+    Containment result = Inside;
+    for (const glm::vec4& plane : planes) {
+        glm::vec3 positive(plane.x >= 0.0f ? max.x : min.x,
+                           plane.y >= 0.0f ? max.y : min.y,
+                           plane.z >= 0.0f ? max.z : min.z);
+        if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+            return Outside;
+        }
+        // The opposite ("negative") corner decides whether the box crosses this plane
+        glm::vec3 negative(plane.x >= 0.0f ? min.x : max.x,
+                           plane.y >= 0.0f ? min.y : max.y,
+                           plane.z >= 0.0f ? min.z : max.z);
+        if (glm::dot(glm::vec3(plane), negative) + plane.w < 0.0f) {
+            result = Intersecting;
+        }
+    }
+    return result;
+}
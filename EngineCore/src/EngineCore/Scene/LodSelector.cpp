@@ -0,0 +1,46 @@
+#include "EngineCore/Scene/LodSelector.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    /// Objects closer than this (e.g. with the camera inside their bounds) use the finest level.
+    constexpr float MinDistance = 1e-3f;
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void LodSelector::SetCamera(const glm::mat4& view, const glm::mat4& projection, float viewportHeight)
+{
+    m_cameraPosition = glm::vec3(glm::inverse(view)[3]);
+    // projection[1][1] is 1 / tan(fovY / 2); its sign depends on the clip space Y direction
+    m_pixelsPerUnit = std::abs(projection[1][1]) * viewportHeight * 0.5f;
+}
+
+uint32_t LodSelector::Select(const std::vector<MeshLod>& lods, const glm::vec3& center, float radius, float scale, uint32_t currentLod) const
+{
+    if (lods.size() <= 1) {
+        return 0;
+    }
+
+    // Measure from the nearest point of the bounding sphere, so large objects refine early enough
+    float distance = std::max(glm::length(center - m_cameraPosition) - radius, MinDistance);
+    float pixelsPerError = m_pixelsPerUnit * scale / distance;
+
+    uint32_t lod = std::min(currentLod, static_cast<uint32_t>(lods.size() - 1));
+    if (lods[lod].error * pixelsPerError > m_pixelError) {
+        while (lod > 0 && lods[lod].error * pixelsPerError > m_pixelError) {
+            lod--;
+        }
+        return lod;
+    }
+
+    float coarsenThreshold = m_pixelError * (1.0f - m_hysteresis);
+    while (lod + 1 < lods.size() && lods[lod + 1].error * pixelsPerError <= coarsenThreshold) {
+        lod++;
+    }
+    return lod;
+}
@@ -0,0 +1,144 @@
+#include "EngineCore/ThreadPool.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <string>
+
+namespace
+{
+    /// The batches of one ParallelFor call, shared with its helper jobs, which may outlive the call.
+    struct ParallelForState
+    {
+        const std::function<void(uint32_t, size_t, size_t)>* function = nullptr; ///< Only used while batches are left.
+        size_t count = 0;
+        size_t batchSize = 0;
+        uint32_t batchCount = 0;
+        std::atomic<uint32_t> nextBatch{ 0 };
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        uint32_t finishedCount = 0;
+        std::exception_ptr error;
+    };
+
+    /// Claims and runs batches until none are left unclaimed.
+    void runBatches(ParallelForState& state)
+    {
+        for (uint32_t batch = state.nextBatch.fetch_add(1); batch < state.batchCount; batch = state.nextBatch.fetch_add(1)) {
+            size_t begin = std::min(batch * state.batchSize, state.count);
+            size_t end = std::min(begin + state.batchSize, state.count);
+            std::exception_ptr error;
+            try {
+                (*state.function)(batch, begin, end);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (error && !state.error) {
+                state.error = error;
+            }
+            if (++state.finishedCount == state.batchCount) {
+                state.finished.notify_all();
+            }
+        }
+    }
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+    if (threadCount == 0) {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+    m_workers.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; i++) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+uint32_t ThreadPool::ParallelFor(size_t count, size_t minBatchSize, const std::function<void(uint32_t, size_t, size_t)>& function)
+{
+    if (count == 0) {
+        return 0;
+    }
+    size_t maxBatches = std::max<size_t>(count / std::max<size_t>(minBatchSize, 1), 1);
+    uint32_t batchCount = static_cast<uint32_t>(std::min<size_t>(maxBatches, m_workers.size() + 1));
+    size_t batchSize = (count + batchCount - 1) / batchCount;
+    if (batchCount == 1) {
+        function(0, 0, count);
+        return 1;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->function = &function;
+    state->count = count;
+    state->batchSize = batchSize;
+    state->batchCount = batchCount;
+    for (uint32_t helper = 1; helper < batchCount; helper++) {
+        enqueue([state]() { runBatches(*state); }, JobPriority::Normal);
+    }
+
+    // The calling thread works through the batches too, taking back any whose helper has not started
+    runBatches(*state);
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&state]() { return state->finishedCount == state->batchCount; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+    return batchCount;
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+void ThreadPool::enqueue(std::function<void()> job, JobPriority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        (priority == JobPriority::Background ? m_backgroundJobs : m_jobs).push(std::move(job));
+    }
+    m_condition.notify_one();
+}
+
+void ThreadPool::workerLoop(uint32_t index)
+{
+    CpuProfiler::SetThreadName("Worker " + std::to_string(index));
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_stopping || !m_jobs.empty() || !m_backgroundJobs.empty(); });
+            std::queue<std::function<void()>>& queue = !m_jobs.empty() ? m_jobs : m_backgroundJobs;
+            if (queue.empty()) {
+                return; // Stopping, and every queued job has run
+            }
+            job = std::move(queue.front());
+            queue.pop();
+        }
+        job();
+    }
+}
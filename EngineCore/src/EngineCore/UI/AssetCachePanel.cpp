@@ -0,0 +1,57 @@
+#include "EngineCore/UI/AssetCachePanel.hpp"
+#include "EngineCore/Assets/AssetCache.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "imgui.h"
+
+#include <cstdio>
+
+namespace
+{
+    float toMegabytes(uint64_t bytes)
+    {
+        return static_cast<float>(bytes) / (1024.0f * 1024.0f);
+    }
+}
+
+/**
+ * @brief Constructs the AssetCachePanel.
+ * @param cache A reference to the asset cache whose stats are displayed.
+ */
+AssetCachePanel::AssetCachePanel(AssetCache& cache)
+    : m_cache(cache)
+{
+}
+
+/**
+ * @brief Renders the Asset Cache panel using ImGui.
+ */
+void AssetCachePanel::OnImGuiRender()
+{
+    ENGINE_PROFILE_SCOPE("AssetCachePanel::OnImGuiRender");
+    if (!ImGui::Begin("Asset Cache")) {
+        ImGui::End();
+        return;
+    }
+
+    AssetCacheStats stats = m_cache.GetStats();
+    ImGui::Text("Directory: %s", m_cache.GetDirectory().c_str());
+    ImGui::Text("Entries: %u (%.1f MiB)", stats.entryCount, toMegabytes(stats.diskBytes));
+    ImGui::Separator();
+
+    const uint64_t lookups = stats.hits + stats.misses;
+    char overlay[64];
+    snprintf(overlay, sizeof(overlay), "%llu / %llu hits", (unsigned long long)stats.hits, (unsigned long long)lookups);
+    ImGui::ProgressBar(lookups > 0 ? static_cast<float>(stats.hits) / lookups : 0.0f, ImVec2(-1.0f, 0.0f), overlay);
+    ImGui::Text("Misses: %llu   Failures: %llu", (unsigned long long)stats.misses, (unsigned long long)stats.failures);
+    ImGui::Text("Hashed: %.1f MiB in %.1f ms", toMegabytes(stats.hashedBytes), stats.hashMilliseconds);
+    ImGui::Text("Written: %.1f MiB", toMegabytes(stats.writtenBytes));
+    ImGui::Separator();
+
+    if (ImGui::Button("Clear Cache")) {
+        m_cache.Clear();
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("Assets are imported again on their next load");
+
+    ImGui::End();
+}
@@ -1,4 +1,5 @@
 #include "EngineCore/UI/ConsolePanel.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "imgui.h"
 
 // Initialize the static message buffer for the console.
@@ -24,6 +25,7 @@ void ConsolePanel::AddLog(const std::string& message)
  */
 void ConsolePanel::OnImGuiRender()
 {
+    ENGINE_PROFILE_SCOPE("ConsolePanel::OnImGuiRender");
     ImGui::Begin("Console");
     
     // Display all messages from the buffer.
@@ -1,4 +1,5 @@
 #include "EngineCore/UI/DeviceInfoPanel.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "imgui.h"
 
 /**
@@ -18,6 +19,7 @@ DeviceInfoPanel::DeviceInfoPanel(const VkPhysicalDeviceProperties& properties)
  */
 void DeviceInfoPanel::OnImGuiRender()
 {
+    ENGINE_PROFILE_SCOPE("DeviceInfoPanel::OnImGuiRender");
     ImGui::Begin("Device Info");
 
     // Display basic device info
@@ -0,0 +1,68 @@
+#include "EngineCore/UI/GpuProfilerPanel.hpp"
+#include "EngineCore/Profiling/GpuProfiler.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "imgui.h"
+
+#include <algorithm>
+#include <numeric>
+
+/**
+ * @brief Constructs the GpuProfilerPanel.
+ * @param profiler A reference to the GPU profiler whose results are displayed.
+ */
+GpuProfilerPanel::GpuProfilerPanel(GpuProfiler& profiler)
+    : m_profiler(profiler)
+{
+}
+
+/**
+ * @brief Renders the GPU Profiler panel using ImGui.
+ *
+ * Averages and peaks are computed over the rolling history window, so they
+ * follow recent behavior rather than the whole session.
+ */
+void GpuProfilerPanel::OnImGuiRender()
+{
+    ENGINE_PROFILE_SCOPE("GpuProfilerPanel::OnImGuiRender");
+    ImGui::Begin("GPU Profiler");
+
+    if (!m_profiler.IsSupported()) {
+        ImGui::TextUnformatted("Timestamp queries are not supported on this queue.");
+        ImGui::End();
+        return;
+    }
+
+    // Plot the total GPU frame time history
+    const GpuScopeStats& frame = m_profiler.GetFrameStats();
+    float framePeak = *std::max_element(frame.history.begin(), frame.history.end());
+    ImGui::Text("GPU Frame: %.3f ms", frame.lastMilliseconds);
+    ImGui::PlotLines("##gpuframe", frame.history.data(), (int)frame.history.size(), 0, NULL, 0.0f, std::max(framePeak * 1.2f, 1.0f), ImVec2(0, 80));
+    ImGui::Separator();
+
+    // Per-pass timings
+    if (ImGui::BeginTable("##gpuscopes", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("Pass");
+        ImGui::TableSetupColumn("Last (ms)");
+        ImGui::TableSetupColumn("Avg (ms)");
+        ImGui::TableSetupColumn("Max (ms)");
+        ImGui::TableHeadersRow();
+        for (const GpuScopeStats& scope : m_profiler.GetScopes()) {
+            float average = std::accumulate(scope.history.begin(), scope.history.end(), 0.0f) / scope.history.size();
+            float peak = *std::max_element(scope.history.begin(), scope.history.end());
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(scope.name.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", scope.lastMilliseconds);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", average);
+            ImGui::TableNextColumn(); ImGui::Text("%.3f", peak);
+        }
+        ImGui::EndTable();
+    }
+
+    // A small rolling graph per pass
+    for (const GpuScopeStats& scope : m_profiler.GetScopes()) {
+        float peak = *std::max_element(scope.history.begin(), scope.history.end());
+        ImGui::PlotLines(scope.name.c_str(), scope.history.data(), (int)scope.history.size(), 0, NULL, 0.0f, std::max(peak * 1.2f, 0.1f), ImVec2(0, 40));
+    }
+
+    ImGui::End();
+}
@@ -1,5 +1,6 @@
 #include "EngineCore/UI/InspectorPanel.hpp"
 #include "EngineCore/Renderer.hpp" // Include the full Renderer definition
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "imgui.h"
 
 /**
@@ -21,6 +22,7 @@ InspectorPanel::InspectorPanel(Renderer& renderer)
  */
 void InspectorPanel::OnImGuiRender()
 {
+    ENGINE_PROFILE_SCOPE("InspectorPanel::OnImGuiRender");
     ImGui::Begin("Inspector");
 
     // Get references to the cube's transformation properties from the renderer.
@@ -34,6 +36,15 @@ void InspectorPanel::OnImGuiRender()
     ImGui::DragFloat3("Position", &position.x, 0.1f);
     ImGui::DragFloat3("Rotation", &rotation.x, 1.0f); // Rotation is in degrees
     ImGui::DragFloat3("Scale", &scale.x, 0.1f);
+
+    // The material only holds slots of the bindless table, so editing it never touches a descriptor
+    MaterialConstants material = m_renderer.GetMaterial();
+    ImGui::Separator();
+    ImGui::Text("Material");
+    ImGui::Text("Albedo Texture: slot %u%s", material.albedoTexture, material.albedoTexture == BindlessTable::DefaultTexture ? " (white)" : "");
+    if (ImGui::DragFloat("Texture Scale", &material.textureScale, 0.05f, 0.01f, 100.0f)) {
+        m_renderer.SetMaterial(material);
+    }
     
     ImGui::End();
 }
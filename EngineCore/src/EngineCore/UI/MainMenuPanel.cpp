@@ -1,5 +1,6 @@
 #include "EngineCore/UI/MainMenuPanel.hpp"
 #include "EngineCore/Application.hpp" // Include the full Application definition
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "imgui.h"
 
 /**
@@ -15,16 +16,29 @@ MainMenuPanel::MainMenuPanel(Application* app)
  * @brief Renders the main menu bar using ImGui.
  *
  * This function creates the main menu bar at the top of the application window.
- * It currently contains a "File" menu with an "Exit" option that closes the application.
+ * The "File" menu opens a mesh or texture file in the background or closes the application.
  */
 void MainMenuPanel::OnImGuiRender()
 {
+    ENGINE_PROFILE_SCOPE("MainMenuPanel::OnImGuiRender");
     // Begin the main menu bar. This will span the top of the main viewport.
     if (ImGui::BeginMainMenuBar())
     {
         // Create the "File" menu.
         if (ImGui::BeginMenu("File"))
         {
+            // Ask for a mesh file to load in the background.
+            if (ImGui::MenuItem("Open Mesh..."))
+            {
+                m_openMeshRequested = true;
+            }
+
+            // Ask for a texture file to stream in the background.
+            if (ImGui::MenuItem("Open Texture..."))
+            {
+                m_openTextureRequested = true;
+            }
+
             // Add an "Exit" menu item.
             if (ImGui::MenuItem("Exit"))
             {
@@ -33,6 +47,62 @@ void MainMenuPanel::OnImGuiRender()
             }
             ImGui::EndMenu();
         }
+
+        // Create the "Profiler" menu.
+        if (ImGui::BeginMenu("Profiler"))
+        {
+            // Dump the most recent CPU zones of all threads to a Chrome trace file.
+            if (ImGui::MenuItem("Capture CPU Trace"))
+            {
+                m_app->captureCpuTrace();
+            }
+            ImGui::EndMenu();
+        }
         ImGui::EndMainMenuBar();
     }
+
+    // Popups opened from inside a menu would close with it, so open them here.
+    if (m_openMeshRequested)
+    {
+        ImGui::OpenPopup("Open Mesh");
+        m_openMeshRequested = false;
+    }
+    if (ImGui::BeginPopupModal("Open Mesh", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+    {
+        ImGui::TextUnformatted("Path to an .obj, .glb or .emesh file:");
+        bool submitted = ImGui::InputText("##MeshPath", m_meshPath, sizeof(m_meshPath), ImGuiInputTextFlags_EnterReturnsTrue);
+        if (ImGui::Button("Load") || submitted)
+        {
+            m_app->loadMesh(m_meshPath);
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Cancel"))
+        {
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::EndPopup();
+    }
+
+    if (m_openTextureRequested)
+    {
+        ImGui::OpenPopup("Open Texture");
+        m_openTextureRequested = false;
+    }
+    if (ImGui::BeginPopupModal("Open Texture", nullptr, ImGuiWindowFlags_AlwaysAutoResize))
+    {
+        ImGui::TextUnformatted("Path to a .ktx2 or .dds file:");
+        bool submitted = ImGui::InputText("##TexturePath", m_texturePath, sizeof(m_texturePath), ImGuiInputTextFlags_EnterReturnsTrue);
+        if (ImGui::Button("Load") || submitted)
+        {
+            m_app->loadTexture(m_texturePath);
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Cancel"))
+        {
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::EndPopup();
+    }
 }
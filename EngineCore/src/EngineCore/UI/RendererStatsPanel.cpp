@@ -0,0 +1,147 @@
+#include "EngineCore/UI/RendererStatsPanel.hpp"
+#include "EngineCore/Renderer.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "imgui.h"
+
+#include <algorithm>
+
+/**
+ * @brief Constructs the RendererStatsPanel.
+ * @param renderer A reference to the renderer whose statistics are displayed.
+ */
+RendererStatsPanel::RendererStatsPanel(Renderer& renderer)
+    : m_renderer(renderer)
+{
+    // Initialize the history buffer with 100 zero values.
+    m_frameTimeHistory.resize(100, 0.0f);
+}
+
+/**
+ * @brief Renders the Renderer Stats panel using ImGui.
+ */
+void RendererStatsPanel::OnImGuiRender()
+{
+    ENGINE_PROFILE_SCOPE("RendererStatsPanel::OnImGuiRender");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Update the frame time history
+    m_frameTimeHistory.erase(m_frameTimeHistory.begin());
+    m_frameTimeHistory.push_back(io.DeltaTime * 1000.0f);
+
+    ImGui::Begin("Renderer Stats");
+
+    ImGui::Text("FPS: %.1f (%.2f ms)", io.Framerate, io.Framerate > 0.0f ? 1000.0f / io.Framerate : 0.0f);
+    ImGui::Text("Frames in Flight: %u", m_renderer.GetFramesInFlight());
+    VkExtent2D sceneExtent = m_renderer.GetSceneExtent();
+    VkExtent2D renderExtent = m_renderer.GetRenderExtent();
+    ImGui::Text("Scene Resolution: %ux%u (rendered at %ux%u)", sceneExtent.width, sceneExtent.height, renderExtent.width, renderExtent.height);
+
+    // Dynamic resolution trades sharpness for a steady GPU frame time; it needs GPU timestamps
+    DynamicResolution& dynamicResolution = m_renderer.GetDynamicResolution();
+    bool dynamic = dynamicResolution.IsEnabled();
+    if (ImGui::Checkbox("Dynamic Resolution", &dynamic)) {
+        dynamicResolution.SetEnabled(dynamic);
+    }
+    if (dynamic) {
+        ImGui::SameLine();
+        ImGui::Text("%.0f%% (GPU %.2f ms)", dynamicResolution.GetScale() * 100.0f, dynamicResolution.GetSmoothedMilliseconds());
+        float target = dynamicResolution.GetTargetMilliseconds();
+        if (ImGui::SliderFloat("Target GPU ms", &target, 2.0f, 50.0f, "%.1f")) {
+            dynamicResolution.SetTargetMilliseconds(target);
+        }
+        float minScale = dynamicResolution.GetMinScale();
+        if (ImGui::SliderFloat("Min Scale", &minScale, DynamicResolution::MinScaleLimit, 1.0f, "%.2f")) {
+            dynamicResolution.SetMinScale(minScale);
+        }
+    }
+
+    // The upscaler renders below the viewport's resolution and reconstructs it in compute passes
+    Upscaler& upscaler = m_renderer.GetUpscaler();
+    const char* currentLabel = Upscaler::GetPresetInfo(upscaler.GetPreset()).label;
+    if (ImGui::BeginCombo("Upscaling", currentLabel)) {
+        for (uint32_t i = 0; i < UpscalePresetCount; i++) {
+            UpscalePreset preset = static_cast<UpscalePreset>(i);
+            bool selected = preset == upscaler.GetPreset();
+            if (ImGui::Selectable(Upscaler::GetPresetInfo(preset).label, selected) && !selected) {
+                upscaler.SetPreset(preset);
+            }
+        }
+        ImGui::EndCombo();
+    }
+    if (upscaler.IsActive()) {
+        float sharpness = upscaler.GetSharpness();
+        if (ImGui::SliderFloat("Sharpness", &sharpness, 0.0f, 1.0f, "%.2f")) {
+            upscaler.SetSharpness(sharpness);
+        }
+    }
+    if (m_renderer.IsGpuCullingActive() && m_renderer.GetInstanceCount() > 0) {
+        ImGui::Text("Instances: %u (%u visible, 1 indirect draw)", m_renderer.GetInstanceCount(), m_renderer.GetVisibleCount());
+    } else if (m_renderer.IsCpuCullingActive() && m_renderer.GetInstanceCount() > 0) {
+        ImGui::Text("Instances: %u (%u visible)", m_renderer.GetInstanceCount(), m_renderer.GetVisibleCount());
+        const Bvh& bvh = m_renderer.GetInstanceBvh();
+        ImGui::Text("BVH: %zu nodes, depth %u", bvh.GetNodeCount(), bvh.GetDepth());
+    } else {
+        ImGui::Text("Instances: %u (1 draw call)", std::max(m_renderer.GetInstanceCount(), 1u));
+    }
+    bool gpuCulling = m_renderer.IsGpuCullingActive();
+    if (ImGui::Checkbox("GPU Culling", &gpuCulling)) {
+        m_renderer.SetGpuCullingEnabled(gpuCulling);
+    }
+    if (!m_renderer.IsGpuCullingActive()) {
+        ImGui::SameLine();
+        bool cpuCulling = m_renderer.IsCpuCullingActive();
+        if (ImGui::Checkbox("CPU Culling", &cpuCulling)) {
+            m_renderer.SetCpuCullingEnabled(cpuCulling);
+        }
+        if (m_renderer.IsCpuCullingActive()) {
+            ImGui::SameLine();
+            bool bvhCulling = m_renderer.IsBvhCullingEnabled();
+            if (ImGui::Checkbox("BVH", &bvhCulling)) {
+                m_renderer.SetBvhCullingEnabled(bvhCulling);
+            }
+        }
+    }
+
+    const GpuMesh& mesh = m_renderer.GetMesh();
+    const uint32_t stride = VertexFormat::GetStride(mesh.vertexLayout);
+    ImGui::Text("Vertices: %u x %u B (%s), %.2f MiB", mesh.vertexCount, stride, VertexFormat::GetName(mesh.vertexLayout),
+        static_cast<double>(stride) * mesh.vertexCount / (1024.0 * 1024.0));
+    const uint32_t indexSize = mesh.indexType == VK_INDEX_TYPE_UINT16 ? 2 : 4;
+    ImGui::Text("Indices: %u x %u B, %.2f MiB", mesh.indexCount, indexSize, static_cast<double>(indexSize) * mesh.indexCount / (1024.0 * 1024.0));
+
+    // Levels of detail are only selected for culled instances
+    const std::vector<MeshLod>& lods = m_renderer.GetMeshLods();
+    if (lods.size() > 1 && m_renderer.GetInstanceCount() > 0 && (m_renderer.IsGpuCullingActive() || m_renderer.IsCpuCullingActive())) {
+        bool lodEnabled = m_renderer.IsLodEnabled();
+        if (ImGui::Checkbox("LOD", &lodEnabled)) {
+            m_renderer.SetLodEnabled(lodEnabled);
+        }
+        ImGui::SameLine();
+        ImGui::Text("%zu levels, %u -> %u triangles", lods.size(), lods.front().indexCount / 3, lods.back().indexCount / 3);
+        if (m_renderer.IsCpuCullingActive() && lodEnabled) {
+            const std::vector<uint32_t>& counts = m_renderer.GetLodInstanceCounts();
+            for (size_t lod = 0; lod < counts.size(); lod++) {
+                ImGui::Text("  LOD %zu: %u instances", lod, counts[lod]);
+            }
+        }
+    }
+    ImGui::Separator();
+
+    // GPU memory usage of the renderer's allocator
+    GpuAllocatorStats memoryStats = m_renderer.GetAllocator().GetStats();
+    constexpr double MiB = 1024.0 * 1024.0;
+    ImGui::Text("GPU Memory Objects: %u (%u blocks, %u dedicated)", memoryStats.deviceMemoryCount, memoryStats.blockCount, memoryStats.dedicatedCount);
+    ImGui::Text("Allocations: %u", memoryStats.allocationCount);
+    ImGui::Text("Block Usage: %.2f / %.2f MiB (%.2f MiB free)", memoryStats.usedBytes / MiB, memoryStats.blockBytes / MiB, memoryStats.freeBytes / MiB);
+    ImGui::Text("Dedicated: %.2f MiB", memoryStats.dedicatedBytes / MiB);
+    ImGui::Text("Fragmentation: %.1f%%", memoryStats.fragmentation * 100.0f);
+    const FrameRingBuffer& frameData = m_renderer.GetFrameData();
+    ImGui::Text("Frame Data: %.1f / %.1f KiB", frameData.GetLastFrameUsage() / 1024.0, frameData.GetFrameCapacity() / 1024.0);
+    ImGui::Separator();
+
+    // Plot frame time history
+    ImGui::Text("Frame Time (ms)");
+    ImGui::PlotLines("##frametime", m_frameTimeHistory.data(), (int)m_frameTimeHistory.size(), 0, NULL, 0.0f, 50.0f, ImVec2(0, 80));
+
+    ImGui::End();
+}
@@ -1,4 +1,5 @@
 #include "EngineCore/UI/SceneHierarchyPanel.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "imgui.h"
 
 /**
@@ -10,6 +11,7 @@
  */
 void SceneHierarchyPanel::OnImGuiRender()
 {
+    ENGINE_PROFILE_SCOPE("SceneHierarchyPanel::OnImGuiRender");
     ImGui::Begin("Scene Hierarchy");
     
     // TODO: Implement the actual scene hierarchy tree here.
@@ -1,4 +1,5 @@
 #include "EngineCore/UI/SystemInfoPanel.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "imgui.h"
 #include <chrono>
 #include <cmath>
@@ -90,6 +91,7 @@ void SystemInfoPanel::update()
  */
 void SystemInfoPanel::OnImGuiRender()
 {
+    ENGINE_PROFILE_SCOPE("SystemInfoPanel::OnImGuiRender");
     // Refresh the data on each render call.
     update();
 
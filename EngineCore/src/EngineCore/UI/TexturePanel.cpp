@@ -0,0 +1,149 @@
+#include "EngineCore/UI/TexturePanel.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+#include "imgui.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    const char* formatName(VkFormat format)
+    {
+        switch (format) {
+        case VK_FORMAT_R8_UNORM: return "R8";
+        case VK_FORMAT_R8G8_UNORM: return "RG8";
+        case VK_FORMAT_R8G8B8A8_UNORM: return "RGBA8";
+        case VK_FORMAT_R8G8B8A8_SRGB: return "RGBA8 sRGB";
+        case VK_FORMAT_R8G8B8A8_SNORM: return "RGBA8 SNORM";
+        case VK_FORMAT_B8G8R8A8_UNORM: return "BGRA8";
+        case VK_FORMAT_B8G8R8A8_SRGB: return "BGRA8 sRGB";
+        case VK_FORMAT_R16G16B16A16_SFLOAT: return "RGBA16F";
+        case VK_FORMAT_R32G32B32A32_SFLOAT: return "RGBA32F";
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK: return "BC1";
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK: return "BC1 sRGB";
+        case VK_FORMAT_BC2_UNORM_BLOCK: return "BC2";
+        case VK_FORMAT_BC2_SRGB_BLOCK: return "BC2 sRGB";
+        case VK_FORMAT_BC3_UNORM_BLOCK: return "BC3";
+        case VK_FORMAT_BC3_SRGB_BLOCK: return "BC3 sRGB";
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+        case VK_FORMAT_BC4_SNORM_BLOCK: return "BC4";
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+        case VK_FORMAT_BC5_SNORM_BLOCK: return "BC5";
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK: return "BC6H";
+        case VK_FORMAT_BC7_UNORM_BLOCK: return "BC7";
+        case VK_FORMAT_BC7_SRGB_BLOCK: return "BC7 sRGB";
+        default: return "-";
+        }
+    }
+
+    float toMegabytes(VkDeviceSize bytes)
+    {
+        return static_cast<float>(bytes) / (1024.0f * 1024.0f);
+    }
+}
+
+/**
+ * @brief Constructs the TexturePanel.
+ * @param streamer The texture streamer whose textures are displayed.
+ * @param descriptorAllocator The allocator the preview's transient descriptor sets come from.
+ */
+TexturePanel::TexturePanel(TextureStreamer& streamer, DescriptorAllocator& descriptorAllocator)
+    : m_streamer(streamer),
+      m_descriptorAllocator(descriptorAllocator)
+{
+}
+
+/**
+ * @brief Renders the Textures panel using ImGui.
+ *
+ * The preview only requests its level while the window is visible, so a
+ * collapsed panel leaves the texture to be evicted like any unused one.
+ */
+void TexturePanel::OnImGuiRender()
+{
+    ENGINE_PROFILE_SCOPE("TexturePanel::OnImGuiRender");
+
+    if (!ImGui::Begin("Textures")) {
+        ImGui::End();
+        return;
+    }
+
+    // Budget and totals
+    TextureStreamerStats stats = m_streamer.GetStats();
+    int budget = static_cast<int>(stats.budget / (1024 * 1024));
+    if (ImGui::SliderInt("Budget (MiB)", &budget, 1, 4096)) {
+        m_streamer.SetBudget(static_cast<VkDeviceSize>(budget) * 1024 * 1024);
+    }
+    char overlay[64];
+    snprintf(overlay, sizeof(overlay), "%.1f / %.0f MiB", toMegabytes(stats.residentBytes), toMegabytes(stats.budget));
+    ImGui::ProgressBar(std::min(1.0f, toMegabytes(stats.residentBytes) / std::max(toMegabytes(stats.budget), 1.0f)), ImVec2(-1.0f, 0.0f), overlay);
+    ImGui::Text("Streaming: %u   Levels streamed: %llu   Levels evicted: %llu", stats.streamingCount,
+        (unsigned long long)stats.streamedLevels, (unsigned long long)stats.evictedLevels);
+    ImGui::Separator();
+
+    // Select textures as they are loaded
+    if (stats.textureCount > m_knownCount) {
+        m_selected = stats.textureCount;
+        m_knownCount = stats.textureCount;
+    }
+
+    if (ImGui::BeginTable("##textures", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Size");
+        ImGui::TableSetupColumn("Format");
+        ImGui::TableSetupColumn("Resident");
+        ImGui::TableSetupColumn("MiB");
+        ImGui::TableHeadersRow();
+        for (TextureHandle handle = 1; handle <= stats.textureCount; handle++) {
+            TextureInfo info = m_streamer.GetInfo(handle);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::PushID(static_cast<int>(handle));
+            if (ImGui::Selectable(info.name.c_str(), m_selected == handle, ImGuiSelectableFlags_SpanAllColumns)) {
+                m_selected = handle;
+            }
+            ImGui::PopID();
+            ImGui::TableNextColumn(); ImGui::Text("%ux%u", info.width, info.height);
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(formatName(info.format));
+            ImGui::TableNextColumn();
+            if (info.state == TextureState::Loading) {
+                ImGui::TextUnformatted("loading");
+            } else if (info.state == TextureState::Failed) {
+                ImGui::TextUnformatted("failed");
+            } else {
+                ImGui::Text("%u-%u%s", info.residentLevel, info.levelCount - 1, info.streamable ? "" : " (all)");
+            }
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", toMegabytes(info.residentBytes));
+        }
+        ImGui::EndTable();
+    }
+
+    // Preview of the selected texture
+    TextureInfo info = m_streamer.GetInfo(m_selected);
+    if (info.state == TextureState::Failed) {
+        ImGui::TextWrapped("%s", m_streamer.GetError(m_selected).c_str());
+    } else if (info.state == TextureState::Ready) {
+        ImGui::Separator();
+        ImGui::SliderFloat("Preview size", &m_previewSize, 16.0f, 2048.0f, "%.0f px", ImGuiSliderFlags_Logarithmic);
+
+        // The least detailed level that still covers the preview texel for pixel
+        const uint32_t longest = std::max(info.width, info.height);
+        uint32_t level = 0;
+        while (level + 1 < info.levelCount && static_cast<float>(longest >> (level + 1)) >= m_previewSize) {
+            level++;
+        }
+        m_streamer.Request(m_selected, level);
+        ImGui::Text("Needs level %u, resident from level %u", level, info.residentLevel);
+
+        // Valid for this frame only, which is all the draw list needs
+        VkDescriptorSet preview = m_descriptorAllocator.AllocateTransientTexture(m_streamer.GetSampler(),
+            m_streamer.GetImageView(m_selected), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        ImGui::Image((ImTextureID)preview,
+            ImVec2(m_previewSize * info.width / longest, m_previewSize * info.height / longest));
+    }
+
+    ImGui::End();
+}
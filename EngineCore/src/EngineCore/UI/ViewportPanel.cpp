@@ -1,5 +1,6 @@
 #include "EngineCore/UI/ViewportPanel.hpp"
 #include "EngineCore/Renderer.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
 #include "imgui.h"
 
 /**
@@ -20,23 +21,37 @@ ViewportPanel::ViewportPanel(Renderer& renderer)
  */
 void ViewportPanel::OnImGuiRender()
 {
+    ENGINE_PROFILE_SCOPE("ViewportPanel::OnImGuiRender");
     // Remove padding so the image fills the entire window.
     ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
-    ImGui::Begin("Viewport");
+    bool visible = ImGui::Begin("Viewport");
 
     // Update the hovered state each frame.
     m_isHovered = ImGui::IsWindowHovered();
 
+    // A hidden or collapsed window reports no size, so the scene image is not resized to nothing
+    ImVec2 contentSize = visible ? ImGui::GetContentRegionAvail() : ImVec2(0, 0);
+    m_contentSize = { contentSize.x, contentSize.y };
+
     // Get the texture ID for the rendered scene from the renderer.
     ImTextureID textureId = m_renderer.GetImGuiTextureId();
     if (textureId)
     {
         // Get the available content region size to make the image fill the panel.
         ImVec2 viewportSize = ImGui::GetContentRegionAvail();
+
+        // Remember where the mouse is relative to the image, so clicks can be turned into rays
+        ImVec2 imagePosition = ImGui::GetCursorScreenPos();
+        ImVec2 mousePosition = ImGui::GetIO().MousePos;
+        if (viewportSize.x > 0.0f && viewportSize.y > 0.0f) {
+            m_mouseImagePosition = { (mousePosition.x - imagePosition.x) / viewportSize.x, (mousePosition.y - imagePosition.y) / viewportSize.y };
+        }
         
         // Display the image. The UV coordinates are flipped vertically (from (0,0)-(1,1) to (0,1)-(1,0))
         // because Vulkan's screen coordinates are often inverted compared to ImGui's texture coordinates.
-        ImGui::Image(textureId, viewportSize, ImVec2(0, 1), ImVec2(1, 0));
+        // Only the rendered part is shown, so a frame at a lower render scale is upsampled to fill the panel.
+        glm::vec2 uvScale = m_renderer.GetSceneUvScale();
+        ImGui::Image(textureId, viewportSize, ImVec2(0, uvScale.y), ImVec2(uvScale.x, 0));
     }
 
     ImGui::End();
@@ -0,0 +1,321 @@
+#include "EngineCore/Vulkan/BindlessTable.hpp"
+#include "EngineCore/Vulkan/UploadQueue.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace
+{
+    constexpr uint32_t TextureBinding = 0;
+    constexpr uint32_t BufferBinding = 1;
+
+    /// Large enough for any std430 struct a shader reads from the default buffer.
+    constexpr VkDeviceSize DefaultBufferSize = 256;
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+BindlessTable::BindlessTable(const BindlessTableCreateInfo& createInfo)
+    : m_device(createInfo.device),
+      m_allocator(*createInfo.allocator),
+      m_framesInFlight(createInfo.framesInFlight),
+      m_bindless(createInfo.descriptorIndexing)
+{
+    const uint32_t textureCapacity = m_bindless ? std::max(createInfo.textureCapacity, 1u) : FallbackTextureCapacity;
+    const uint32_t bufferCapacity = m_bindless ? std::max(createInfo.bufferCapacity, 1u) : FallbackBufferCapacity;
+
+    createDefaults(*createInfo.uploadQueue);
+    m_textures.assign(textureCapacity, VkDescriptorImageInfo{ m_defaultSampler, m_defaultView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL });
+    m_buffers.assign(bufferCapacity, VkDescriptorBufferInfo{ m_defaultBuffer, 0, VK_WHOLE_SIZE });
+
+    // Handed out lowest first, so the arrays fill from the front
+    for (uint32_t index = textureCapacity - 1; index > DefaultTexture; index--) {
+        m_freeTextures.push_back(index);
+    }
+    for (uint32_t index = bufferCapacity - 1; index > DefaultBuffer; index--) {
+        m_freeBuffers.push_back(index);
+    }
+
+    createSets();
+    Log::GetCoreLogger()->info("Bindless table: {0} texture and {1} storage buffer slots ({2}).", textureCapacity, bufferCapacity,
+        m_bindless ? "descriptor indexing" : "fallback, one set per frame in flight");
+}
+
+BindlessTable::~BindlessTable()
+{
+    vkDestroyDescriptorPool(m_device, m_pool, nullptr); // Frees the sets
+    vkDestroyDescriptorSetLayout(m_device, m_layout, nullptr);
+    vkDestroySampler(m_device, m_defaultSampler, nullptr);
+    vkDestroyImageView(m_device, m_defaultView, nullptr);
+    m_allocator.DestroyImage(m_defaultImage, m_defaultImageMemory);
+    m_allocator.DestroyBuffer(m_defaultBuffer, m_defaultBufferMemory);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+uint32_t BindlessTable::RegisterTexture(VkImageView view, VkSampler sampler)
+{
+    uint32_t index = allocateSlot(m_freeTextures, "texture");
+    if (index == DefaultTexture) {
+        return index;
+    }
+    m_textures[index] = { sampler, view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    m_textureCount++;
+    markDirty(TextureBinding, index);
+    return index;
+}
+
+void BindlessTable::ReleaseTexture(uint32_t index)
+{
+    if (index == DefaultTexture || index >= m_textures.size()) {
+        return;
+    }
+    // Without descriptor indexing every slot must stay valid, so it falls back to the default
+    m_textures[index] = { m_defaultSampler, m_defaultView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL };
+    m_textureCount--;
+    if (!m_bindless) {
+        markDirty(TextureBinding, index);
+    }
+    m_retired.push_back({ TextureBinding, index, m_frame });
+}
+
+uint32_t BindlessTable::RegisterBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range)
+{
+    uint32_t index = allocateSlot(m_freeBuffers, "storage buffer");
+    if (index == DefaultBuffer) {
+        return index;
+    }
+    m_buffers[index] = { buffer, offset, range };
+    m_bufferCount++;
+    markDirty(BufferBinding, index);
+    return index;
+}
+
+void BindlessTable::ReleaseBuffer(uint32_t index)
+{
+    if (index == DefaultBuffer || index >= m_buffers.size()) {
+        return;
+    }
+    m_buffers[index] = { m_defaultBuffer, 0, VK_WHOLE_SIZE };
+    m_bufferCount--;
+    if (!m_bindless) {
+        markDirty(BufferBinding, index);
+    }
+    m_retired.push_back({ BufferBinding, index, m_frame });
+}
+
+void BindlessTable::BeginFrame(uint32_t frameIndex)
+{
+    m_frame++;
+
+    // The frames that bound the table before a slot was released have all been waited on by now
+    while (!m_retired.empty() && m_retired.front().frame + m_framesInFlight <= m_frame) {
+        const RetiredSlot& slot = m_retired.front();
+        (slot.binding == TextureBinding ? m_freeTextures : m_freeBuffers).push_back(slot.index);
+        m_retired.pop_front();
+    }
+
+    if (!m_bindless) {
+        std::vector<uint32_t>& textures = m_dirtyTextures[frameIndex];
+        std::vector<uint32_t>& buffers = m_dirtyBuffers[frameIndex];
+        if (!textures.empty() || !buffers.empty()) {
+            writeSlots(m_sets[frameIndex], textures, buffers);
+            textures.clear();
+            buffers.clear();
+        }
+    }
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+void BindlessTable::createDefaults(UploadQueue& uploads)
+{
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    imageInfo.extent = { 1, 1, 1 };
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    m_allocator.CreateImage(imageInfo, GpuAllocationInfo{}, m_defaultImage, m_defaultImageMemory);
+
+    VkImageViewCreateInfo viewInfo{};
+    viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    viewInfo.image = m_defaultImage;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = imageInfo.format;
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    if (vkCreateImageView(m_device, &viewInfo, nullptr, &m_defaultView) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create default texture image view!");
+    }
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = VK_FILTER_NEAREST;
+    samplerInfo.minFilter = VK_FILTER_NEAREST;
+    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    if (vkCreateSampler(m_device, &samplerInfo, nullptr, &m_defaultSampler) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create default texture sampler!");
+    }
+
+    m_allocator.CreateBuffer(DefaultBufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        GpuAllocationInfo{}, m_defaultBuffer, m_defaultBufferMemory);
+
+    // A few bytes, uploaded once: waiting here keeps every frame from having to check for them
+    const uint8_t white[4] = { 255, 255, 255, 255 };
+    const std::array<uint8_t, DefaultBufferSize> zeros{};
+    uploads.BeginImage(m_defaultImage, 0, 1);
+    uploads.UploadImage(white, sizeof(white), m_defaultImage, 0, 1, 1);
+    uploads.FinishImage(m_defaultImage, 0, 1);
+    uploads.UploadBuffer(zeros.data(), zeros.size(), m_defaultBuffer);
+    uploads.WaitAvailable(uploads.GetRecordingBatch());
+}
+
+void BindlessTable::createSets()
+{
+    std::array<VkDescriptorSetLayoutBinding, 2> bindings{};
+    bindings[TextureBinding].binding = TextureBinding;
+    bindings[TextureBinding].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    bindings[TextureBinding].descriptorCount = GetTextureCapacity();
+    bindings[TextureBinding].stageFlags = VK_SHADER_STAGE_ALL;
+    bindings[BufferBinding].binding = BufferBinding;
+    bindings[BufferBinding].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindings[BufferBinding].descriptorCount = GetBufferCapacity();
+    bindings[BufferBinding].stageFlags = VK_SHADER_STAGE_ALL;
+
+    // Slots may be unwritten, and written while the set is bound or used by frames that do not read them
+    const VkDescriptorBindingFlags bindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+        VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+    const std::array<VkDescriptorBindingFlags, 2> flags = { bindingFlags, bindingFlags };
+    VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo{};
+    flagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    flagsInfo.bindingCount = static_cast<uint32_t>(flags.size());
+    flagsInfo.pBindingFlags = flags.data();
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.pNext = m_bindless ? &flagsInfo : nullptr;
+    layoutInfo.flags = m_bindless ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT : 0;
+    layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    layoutInfo.pBindings = bindings.data();
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &m_layout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create bindless descriptor set layout!");
+    }
+
+    const uint32_t setCount = m_bindless ? 1 : m_framesInFlight;
+    std::array<VkDescriptorPoolSize, 2> poolSizes{};
+    poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSizes[0].descriptorCount = GetTextureCapacity() * setCount;
+    poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSizes[1].descriptorCount = GetBufferCapacity() * setCount;
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = m_bindless ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT : 0;
+    poolInfo.maxSets = setCount;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    poolInfo.pPoolSizes = poolSizes.data();
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_pool) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create bindless descriptor pool!");
+    }
+
+    std::vector<VkDescriptorSetLayout> layouts(setCount, m_layout);
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = m_pool;
+    allocInfo.descriptorSetCount = setCount;
+    allocInfo.pSetLayouts = layouts.data();
+    m_sets.resize(setCount);
+    if (vkAllocateDescriptorSets(m_device, &allocInfo, m_sets.data()) != VK_SUCCESS) {
+        throw std::runtime_error("failed to allocate bindless descriptor sets!");
+    }
+
+    // Partially bound arrays only need the defaults; the fallback's sets start out fully valid
+    std::vector<uint32_t> textureSlots = { DefaultTexture };
+    std::vector<uint32_t> bufferSlots = { DefaultBuffer };
+    if (!m_bindless) {
+        textureSlots.resize(GetTextureCapacity());
+        bufferSlots.resize(GetBufferCapacity());
+        for (uint32_t i = 0; i < textureSlots.size(); i++) {
+            textureSlots[i] = i;
+        }
+        for (uint32_t i = 0; i < bufferSlots.size(); i++) {
+            bufferSlots[i] = i;
+        }
+        m_dirtyTextures.resize(m_framesInFlight);
+        m_dirtyBuffers.resize(m_framesInFlight);
+    }
+    for (VkDescriptorSet set : m_sets) {
+        writeSlots(set, textureSlots, bufferSlots);
+    }
+}
+
+uint32_t BindlessTable::allocateSlot(std::vector<uint32_t>& freeSlots, const char* kind)
+{
+    if (freeSlots.empty()) {
+        Log::GetCoreLogger()->warn("The bindless table has no free {0} slot left, using the default.", kind);
+        return 0; // DefaultTexture or DefaultBuffer
+    }
+    uint32_t index = freeSlots.back();
+    freeSlots.pop_back();
+    return index;
+}
+
+void BindlessTable::markDirty(uint32_t binding, uint32_t index)
+{
+    if (m_bindless) {
+        // A slot is only written while it is free, so no frame in flight reads it
+        const std::vector<uint32_t> slot = { index };
+        const std::vector<uint32_t> none;
+        writeSlots(m_sets[0], binding == TextureBinding ? slot : none, binding == BufferBinding ? slot : none);
+        return;
+    }
+    for (uint32_t frame = 0; frame < m_framesInFlight; frame++) {
+        (binding == TextureBinding ? m_dirtyTextures[frame] : m_dirtyBuffers[frame]).push_back(index);
+    }
+}
+
+void BindlessTable::writeSlots(VkDescriptorSet set, const std::vector<uint32_t>& textureSlots, const std::vector<uint32_t>& bufferSlots) const
+{
+    std::vector<VkWriteDescriptorSet> writes;
+    writes.reserve(textureSlots.size() + bufferSlots.size());
+    for (uint32_t index : textureSlots) {
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = set;
+        write.dstBinding = TextureBinding;
+        write.dstArrayElement = index;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.pImageInfo = &m_textures[index];
+        writes.push_back(write);
+    }
+    for (uint32_t index : bufferSlots) {
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = set;
+        write.dstBinding = BufferBinding;
+        write.dstArrayElement = index;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        write.pBufferInfo = &m_buffers[index];
+        writes.push_back(write);
+    }
+    vkUpdateDescriptorSets(m_device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+}
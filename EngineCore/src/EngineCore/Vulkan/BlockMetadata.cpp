@@ -0,0 +1,152 @@
+#include "EngineCore/Vulkan/BlockMetadata.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+    uint64_t alignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+// =================================================================================
+// Constructor
+// =================================================================================
+
+BlockMetadata::BlockMetadata(uint64_t size, Algorithm algorithm)
+    : m_size(size), m_algorithm(algorithm)
+{
+    if (m_algorithm == Algorithm::FreeList && m_size > 0) {
+        m_freeRanges.emplace(0, m_size);
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+bool BlockMetadata::Allocate(uint64_t size, uint64_t alignment, uint64_t& offset)
+{
+    if (size == 0 || alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::invalid_argument("BlockMetadata::Allocate: size must be non-zero and alignment a power of two");
+    }
+
+    if (m_algorithm == Algorithm::Linear) {
+        uint64_t aligned = alignUp(m_linearOffset, alignment);
+        if (aligned + size > m_size || aligned + size < aligned) {
+            return false;
+        }
+        offset = aligned;
+        m_linearOffset = aligned + size;
+        m_usedBytes += size;
+        m_allocationCount++;
+        return true;
+    }
+
+    // Best fit: the smallest free range that still holds the aligned allocation
+    auto best = m_freeRanges.end();
+    for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it) {
+        uint64_t aligned = alignUp(it->first, alignment);
+        uint64_t rangeEnd = it->first + it->second;
+        if (aligned + size > rangeEnd || aligned + size < aligned) {
+            continue;
+        }
+        if (best == m_freeRanges.end() || it->second < best->second) {
+            best = it;
+            if (it->second == size && aligned == it->first) {
+                break; // Exact fit, cannot do better
+            }
+        }
+    }
+    if (best == m_freeRanges.end()) {
+        return false;
+    }
+
+    uint64_t rangeOffset = best->first;
+    uint64_t rangeEnd = best->first + best->second;
+    uint64_t aligned = alignUp(rangeOffset, alignment);
+    m_freeRanges.erase(best);
+
+    // Keep the alignment padding and the tail as separate free ranges
+    if (aligned > rangeOffset) {
+        m_freeRanges.emplace(rangeOffset, aligned - rangeOffset);
+    }
+    if (aligned + size < rangeEnd) {
+        m_freeRanges.emplace(aligned + size, rangeEnd - (aligned + size));
+    }
+
+    offset = aligned;
+    m_usedBytes += size;
+    m_allocationCount++;
+    return true;
+}
+
+void BlockMetadata::Free(uint64_t offset, uint64_t size)
+{
+    if (m_allocationCount == 0 || size == 0 || size > m_usedBytes || offset > m_size || size > m_size - offset) {
+        throw std::logic_error("BlockMetadata::Free: range was not allocated from this block");
+    }
+
+    if (m_algorithm == Algorithm::Linear) {
+        if (offset + size > m_linearOffset) {
+            throw std::logic_error("BlockMetadata::Free: range was not allocated from this block");
+        }
+        m_usedBytes -= size;
+        m_allocationCount--;
+        if (m_allocationCount == 0) {
+            m_linearOffset = 0; // The whole block is reusable again
+        }
+        return;
+    }
+
+    // A double free or a wrong offset shows up as an overlap with a free neighbour; inserting it
+    // anyway would let a later Allocate() hand out memory that is still in use
+    auto next = m_freeRanges.lower_bound(offset);
+    if (next != m_freeRanges.end() && next->first < offset + size) {
+        throw std::logic_error("BlockMetadata::Free: range overlaps a free range (double free?)");
+    }
+    if (next != m_freeRanges.begin()) {
+        auto previous = std::prev(next);
+        if (previous->first + previous->second > offset) {
+            throw std::logic_error("BlockMetadata::Free: range overlaps a free range (double free?)");
+        }
+    }
+    m_usedBytes -= size;
+    m_allocationCount--;
+
+    // Insert the range and merge it with its neighbours
+    auto it = m_freeRanges.emplace_hint(next, offset, size);
+    if (next != m_freeRanges.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        m_freeRanges.erase(next);
+    }
+    if (it != m_freeRanges.begin()) {
+        auto previous = std::prev(it);
+        if (previous->first + previous->second == it->first) {
+            previous->second += it->second;
+            m_freeRanges.erase(it);
+        }
+    }
+}
+
+uint64_t BlockMetadata::GetLargestFreeRange() const
+{
+    if (m_algorithm == Algorithm::Linear) {
+        return m_size - m_linearOffset;
+    }
+    uint64_t largest = 0;
+    for (const auto& [offset, size] : m_freeRanges) {
+        largest = std::max(largest, size);
+    }
+    return largest;
+}
+
+float BlockMetadata::ComputeFragmentation(uint64_t largestFreeRange, uint64_t freeBytes)
+{
+    if (freeBytes == 0) {
+        return 0.0f;
+    }
+    return 1.0f - static_cast<float>(static_cast<double>(largestFreeRange) / static_cast<double>(freeBytes));
+}
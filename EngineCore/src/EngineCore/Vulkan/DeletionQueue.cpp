@@ -0,0 +1,121 @@
+#include "EngineCore/Vulkan/DeletionQueue.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+DeletionQueue::DeletionQueue(const DeletionQueueCreateInfo& createInfo)
+    : m_device(createInfo.device),
+      m_allocator(*createInfo.allocator),
+      m_framesInFlight(createInfo.framesInFlight)
+{
+    if (createInfo.timelineSemaphore) {
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &typeInfo;
+        if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &m_timeline) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create frame timeline semaphore!");
+        }
+    }
+    Log::GetCoreLogger()->info("Deletion queue tracks frames by {0}.", m_timeline != VK_NULL_HANDLE ? "timeline semaphore" : "frame fences");
+}
+
+DeletionQueue::~DeletionQueue()
+{
+    Flush();
+    vkDestroySemaphore(m_device, m_timeline, nullptr);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void DeletionQueue::BeginFrame()
+{
+    m_frame++;
+    const uint64_t completed = getCompletedFrame();
+    while (!m_pending.empty() && m_pending.front().frame <= completed) {
+        m_pending.front().destroy();
+        m_pending.pop_front();
+    }
+}
+
+void DeletionQueue::Defer(std::function<void()> destroy)
+{
+    m_pending.push_back({ m_frame + 1, std::move(destroy) });
+}
+
+void DeletionQueue::DestroyBuffer(VkBuffer& buffer, GpuAllocation& allocation)
+{
+    if (buffer != VK_NULL_HANDLE) {
+        Defer([this, buffer, allocation]() mutable { m_allocator.DestroyBuffer(buffer, allocation); });
+    }
+    buffer = VK_NULL_HANDLE;
+    allocation = GpuAllocation{};
+}
+
+void DeletionQueue::DestroyImage(VkImage& image, GpuAllocation& allocation)
+{
+    if (image != VK_NULL_HANDLE) {
+        Defer([this, image, allocation]() mutable { m_allocator.DestroyImage(image, allocation); });
+    }
+    image = VK_NULL_HANDLE;
+    allocation = GpuAllocation{};
+}
+
+void DeletionQueue::DestroyImageView(VkImageView& view)
+{
+    if (view != VK_NULL_HANDLE) {
+        Defer([device = m_device, view]() { vkDestroyImageView(device, view, nullptr); });
+    }
+    view = VK_NULL_HANDLE;
+}
+
+void DeletionQueue::DestroySampler(VkSampler& sampler)
+{
+    if (sampler != VK_NULL_HANDLE) {
+        Defer([device = m_device, sampler]() { vkDestroySampler(device, sampler, nullptr); });
+    }
+    sampler = VK_NULL_HANDLE;
+}
+
+void DeletionQueue::DestroyFramebuffer(VkFramebuffer& framebuffer)
+{
+    if (framebuffer != VK_NULL_HANDLE) {
+        Defer([device = m_device, framebuffer]() { vkDestroyFramebuffer(device, framebuffer, nullptr); });
+    }
+    framebuffer = VK_NULL_HANDLE;
+}
+
+void DeletionQueue::Flush()
+{
+    for (Entry& entry : m_pending) {
+        entry.destroy();
+    }
+    m_pending.clear();
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+uint64_t DeletionQueue::getCompletedFrame() const
+{
+    if (m_timeline != VK_NULL_HANDLE) {
+        uint64_t value = 0;
+        if (vkGetSemaphoreCounterValue(m_device, m_timeline, &value) != VK_SUCCESS) {
+            throw std::runtime_error("failed to read frame timeline semaphore!");
+        }
+        return value;
+    }
+    // The fence of this frame slot was signaled by the frame framesInFlight earlier
+    return m_frame > m_framesInFlight ? m_frame - m_framesInFlight : 0;
+}
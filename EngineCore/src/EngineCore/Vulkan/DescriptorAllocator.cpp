@@ -0,0 +1,240 @@
+#include "EngineCore/Vulkan/DescriptorAllocator.hpp"
+#include "EngineCore/Hash.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace
+{
+    /// Descriptors of each type a pool holds per set it can allocate.
+    constexpr std::array<VkDescriptorPoolSize, 7> PoolRatios = {{
+        { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 2 },
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1 },
+        { VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1 },
+        { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4 },
+        { VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1 },
+        { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1 },
+        { VK_DESCRIPTOR_TYPE_SAMPLER, 1 },
+    }};
+
+    /**
+     * @brief Hashes the fields of a layout signature, skipping struct padding.
+     */
+    uint64_t hashSignature(const std::vector<VkDescriptorSetLayoutBinding>& bindings, VkDescriptorSetLayoutCreateFlags flags)
+    {
+        uint64_t hash = HashBytes(&flags, sizeof(flags));
+        for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+            hash = HashBytes(&binding.binding, sizeof(binding.binding), hash);
+            hash = HashBytes(&binding.descriptorType, sizeof(binding.descriptorType), hash);
+            hash = HashBytes(&binding.descriptorCount, sizeof(binding.descriptorCount), hash);
+            hash = HashBytes(&binding.stageFlags, sizeof(binding.stageFlags), hash);
+        }
+        return hash;
+    }
+
+    bool sameBinding(const VkDescriptorSetLayoutBinding& a, const VkDescriptorSetLayoutBinding& b)
+    {
+        return a.binding == b.binding && a.descriptorType == b.descriptorType && a.descriptorCount == b.descriptorCount &&
+            a.stageFlags == b.stageFlags;
+    }
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+DescriptorAllocator::DescriptorAllocator(const DescriptorAllocatorCreateInfo& createInfo)
+    : m_device(createInfo.device),
+      m_initialSetsPerPool(std::max(createInfo.initialSetsPerPool, 1u)),
+      m_maxSetsPerPool(std::max(createInfo.maxSetsPerPool, createInfo.initialSetsPerPool)),
+      m_transient(std::max(createInfo.framesInFlight, 1u))
+{
+}
+
+DescriptorAllocator::~DescriptorAllocator()
+{
+    // Destroying a pool frees its sets
+    for (VkDescriptorPool pool : m_persistent.pools) {
+        vkDestroyDescriptorPool(m_device, pool, nullptr);
+    }
+    for (const PoolList& list : m_transient) {
+        for (VkDescriptorPool pool : list.pools) {
+            vkDestroyDescriptorPool(m_device, pool, nullptr);
+        }
+    }
+    for (const auto& [hash, layouts] : m_layouts) {
+        for (const CachedLayout& cached : layouts) {
+            vkDestroyDescriptorSetLayout(m_device, cached.layout, nullptr);
+        }
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+VkDescriptorSetLayout DescriptorAllocator::GetLayout(const std::vector<VkDescriptorSetLayoutBinding>& bindings, VkDescriptorSetLayoutCreateFlags flags)
+{
+    // The cache keeps the bindings but not the sampler arrays they would point into
+    for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+        if (binding.pImmutableSamplers != nullptr) {
+            throw std::runtime_error("failed to create descriptor set layout: immutable samplers are not supported!");
+        }
+    }
+
+    // The order bindings are listed in does not change the layout, so sort them for the signature
+    std::vector<VkDescriptorSetLayoutBinding> sorted = bindings;
+    std::sort(sorted.begin(), sorted.end(), [](const VkDescriptorSetLayoutBinding& a, const VkDescriptorSetLayoutBinding& b) {
+        return a.binding < b.binding;
+    });
+
+    std::vector<CachedLayout>& candidates = m_layouts[hashSignature(sorted, flags)];
+    for (const CachedLayout& cached : candidates) {
+        if (cached.flags == flags && std::equal(cached.bindings.begin(), cached.bindings.end(), sorted.begin(), sorted.end(), sameBinding)) {
+            return cached.layout;
+        }
+    }
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.flags = flags;
+    layoutInfo.bindingCount = static_cast<uint32_t>(sorted.size());
+    layoutInfo.pBindings = sorted.data();
+    VkDescriptorSetLayout layout;
+    if (vkCreateDescriptorSetLayout(m_device, &layoutInfo, nullptr, &layout) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create descriptor set layout!");
+    }
+
+    candidates.push_back({ flags, std::move(sorted), layout });
+    m_layoutCount++;
+    return layout;
+}
+
+VkDescriptorSetLayout DescriptorAllocator::GetTextureLayout()
+{
+    VkDescriptorSetLayoutBinding binding{};
+    binding.binding = 0;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    binding.descriptorCount = 1;
+    binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+    return GetLayout({ binding });
+}
+
+VkDescriptorSet DescriptorAllocator::Allocate(VkDescriptorSetLayout layout)
+{
+    return allocate(m_persistent, layout);
+}
+
+VkDescriptorSet DescriptorAllocator::AllocateTransient(VkDescriptorSetLayout layout)
+{
+    return allocate(m_transient[m_currentFrame], layout);
+}
+
+VkDescriptorSet DescriptorAllocator::AllocateTransientTexture(VkSampler sampler, VkImageView view, VkImageLayout imageLayout)
+{
+    VkDescriptorSet set = AllocateTransient(GetTextureLayout());
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = sampler;
+    imageInfo.imageView = view;
+    imageInfo.imageLayout = imageLayout;
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = set;
+    write.dstBinding = 0;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    write.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(m_device, 1, &write, 0, nullptr);
+    return set;
+}
+
+void DescriptorAllocator::BeginFrame(uint32_t frameIndex)
+{
+    m_currentFrame = frameIndex;
+
+    // Only the pools the frame reached hold sets; the rest are still empty from the last reset
+    PoolList& list = m_transient[frameIndex];
+    for (size_t i = 0; i < list.pools.size() && i <= list.current; i++) {
+        vkResetDescriptorPool(m_device, list.pools[i], 0);
+    }
+    list.current = 0;
+    list.setCount = 0;
+}
+
+DescriptorAllocatorStats DescriptorAllocator::GetStats() const
+{
+    DescriptorAllocatorStats stats;
+    stats.layoutCount = m_layoutCount;
+    stats.persistentPools = static_cast<uint32_t>(m_persistent.pools.size());
+    stats.persistentSets = m_persistent.setCount;
+    for (const PoolList& list : m_transient) {
+        stats.transientPools += static_cast<uint32_t>(list.pools.size());
+    }
+    stats.transientSets = m_transient[m_currentFrame].setCount;
+    return stats;
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+VkDescriptorSet DescriptorAllocator::allocate(PoolList& list, VkDescriptorSetLayout layout)
+{
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &layout;
+
+    // Move on to the next pool, or a new larger one, whenever the current one is full
+    while (true) {
+        bool created = list.current == list.pools.size();
+        if (created) {
+            uint32_t shift = static_cast<uint32_t>(std::min<size_t>(list.pools.size(), 16));
+            uint32_t setCount = std::min(m_initialSetsPerPool << shift, m_maxSetsPerPool);
+            list.pools.push_back(createPool(setCount));
+            Log::GetCoreLogger()->info("Descriptor allocator: new {0} pool of {1} sets ({2} in the list).",
+                &list == &m_persistent ? "persistent" : "transient", setCount, list.pools.size());
+        }
+
+        allocInfo.descriptorPool = list.pools[list.current];
+        VkDescriptorSet set;
+        VkResult result = vkAllocateDescriptorSets(m_device, &allocInfo, &set);
+        if (result == VK_SUCCESS) {
+            list.setCount++;
+            return set;
+        }
+        if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL) {
+            throw std::runtime_error("failed to allocate descriptor set!");
+        }
+
+        // A new pool that cannot hold the set never will, so give up instead of growing forever
+        if (created) {
+            throw std::runtime_error("failed to allocate descriptor set: its layout does not fit a pool!");
+        }
+        list.current++;
+    }
+}
+
+VkDescriptorPool DescriptorAllocator::createPool(uint32_t setCount) const
+{
+    std::array<VkDescriptorPoolSize, PoolRatios.size()> poolSizes{};
+    for (size_t i = 0; i < PoolRatios.size(); i++) {
+        poolSizes[i].type = PoolRatios[i].type;
+        poolSizes[i].descriptorCount = PoolRatios[i].descriptorCount * setCount;
+    }
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.maxSets = setCount;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    poolInfo.pPoolSizes = poolSizes.data();
+    VkDescriptorPool pool;
+    if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create descriptor pool!");
+    }
+    return pool;
+}
@@ -0,0 +1,66 @@
+#include "EngineCore/Vulkan/FrameRingBuffer.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+FrameRingBuffer::FrameRingBuffer(GpuAllocator& allocator, VkPhysicalDevice physicalDevice, VkDeviceSize bytesPerFrame, uint32_t framesInFlight)
+    : m_allocator(allocator)
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    m_defaultAlignment = std::max<VkDeviceSize>({ 16,
+        properties.limits.minUniformBufferOffsetAlignment,
+        properties.limits.minStorageBufferOffsetAlignment });
+
+    // Each partition starts on an aligned offset so chunk offsets stay aligned
+    m_bytesPerFrame = (bytesPerFrame + m_defaultAlignment - 1) / m_defaultAlignment * m_defaultAlignment;
+
+    // Per-frame data only lives for one frame, so the ring comes from a linear block
+    GpuAllocationInfo allocInfo{};
+    allocInfo.properties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    allocInfo.transient = true;
+    VkBufferUsageFlags usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+    m_allocator.CreateBuffer(m_bytesPerFrame * framesInFlight, usage, allocInfo, m_buffer, m_memory);
+    Log::GetCoreLogger()->info("Frame ring buffer created ({0} KiB per frame, {1} frames).", m_bytesPerFrame / 1024, framesInFlight);
+}
+
+FrameRingBuffer::~FrameRingBuffer()
+{
+    m_allocator.DestroyBuffer(m_buffer, m_memory);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void FrameRingBuffer::BeginFrame(uint32_t frameIndex)
+{
+    m_lastFrameUsage = m_head;
+    m_frameIndex = frameIndex;
+    m_head = 0;
+}
+
+RingAllocation FrameRingBuffer::Allocate(VkDeviceSize size, VkDeviceSize alignment)
+{
+    if (alignment == 0) {
+        alignment = m_defaultAlignment;
+    }
+    VkDeviceSize offset = (m_head + alignment - 1) / alignment * alignment;
+    if (offset + size > m_bytesPerFrame) {
+        throw std::runtime_error("frame ring buffer is full, increase frame-data-mb!");
+    }
+    m_head = offset + size;
+
+    VkDeviceSize absoluteOffset = m_frameIndex * m_bytesPerFrame + offset;
+    RingAllocation allocation;
+    allocation.buffer = m_buffer;
+    allocation.offset = static_cast<uint32_t>(absoluteOffset);
+    allocation.data = static_cast<char*>(m_memory.mappedData) + absoluteOffset;
+    return allocation;
+}
@@ -0,0 +1,302 @@
+#include "EngineCore/Vulkan/GpuAllocator.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/// One shared VkDeviceMemory object and the bookkeeping of its sub-ranges.
+struct GpuMemoryBlock
+{
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    uint32_t memoryTypeIndex = 0;
+    bool isImage = false;
+    void* mappedData = nullptr;
+    BlockMetadata metadata;
+
+    GpuMemoryBlock(VkDeviceSize size, BlockMetadata::Algorithm algorithm)
+        : metadata(size, algorithm) {}
+};
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+GpuAllocator::GpuAllocator(VkDevice device, VkPhysicalDevice physicalDevice, uint32_t apiVersion)
+    : m_device(device), m_dedicatedAllocation(apiVersion >= VK_API_VERSION_1_1)
+{
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_memoryProperties);
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+    m_maxAllocationCount = properties.limits.maxMemoryAllocationCount;
+    Log::GetCoreLogger()->info("GPU allocator created ({0} memory types, at most {1} device allocations).",
+        m_memoryProperties.memoryTypeCount, m_maxAllocationCount);
+}
+
+GpuAllocator::~GpuAllocator()
+{
+    for (const auto& block : m_blocks) {
+        if (!block->metadata.IsEmpty()) {
+            Log::GetCoreLogger()->warn("GPU allocator destroyed with {0} live allocations in a block.", block->metadata.GetAllocationCount());
+        }
+        vkFreeMemory(m_device, block->memory, nullptr);
+    }
+    if (m_dedicatedCount > 0) {
+        Log::GetCoreLogger()->warn("GPU allocator destroyed with {0} live dedicated allocations.", m_dedicatedCount);
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+GpuAllocation GpuAllocator::Allocate(const VkMemoryRequirements& requirements, const GpuAllocationInfo& info, bool isImage)
+{
+    return allocate(requirements, info, isImage, nullptr, false);
+}
+
+GpuAllocation GpuAllocator::allocate(const VkMemoryRequirements& requirements, const GpuAllocationInfo& info, bool isImage,
+    const VkMemoryDedicatedAllocateInfo* dedicatedInfo, bool prefersDedicated)
+{
+    uint32_t memoryTypeIndex = findMemoryType(requirements.memoryTypeBits, info.properties);
+    VkDeviceSize blockSize = blockSizeFor(memoryTypeIndex);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    GpuAllocation allocation;
+
+    // Large resources would waste most of a block, give them their own memory; so do resources the
+    // driver can lay out better on their own (e.g. render targets with compression metadata)
+    if (info.dedicated || prefersDedicated || requirements.size > blockSize / 2) {
+        allocation.memory = allocateDeviceMemory(requirements.size, memoryTypeIndex, dedicatedInfo, &allocation.mappedData);
+        allocation.size = requirements.size;
+        m_dedicatedCount++;
+        m_dedicatedBytes += requirements.size;
+        return allocation;
+    }
+
+    BlockMetadata::Algorithm algorithm = info.transient ? BlockMetadata::Algorithm::Linear : BlockMetadata::Algorithm::FreeList;
+    VkDeviceSize alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+
+    GpuMemoryBlock* target = nullptr;
+    VkDeviceSize offset = 0;
+    for (const auto& block : m_blocks) {
+        if (block->memoryTypeIndex == memoryTypeIndex && block->isImage == isImage &&
+            block->metadata.GetAlgorithm() == algorithm &&
+            block->metadata.Allocate(requirements.size, alignment, offset)) {
+            target = block.get();
+            break;
+        }
+    }
+
+    if (target == nullptr) {
+        auto block = std::make_unique<GpuMemoryBlock>(blockSize, algorithm);
+        block->memoryTypeIndex = memoryTypeIndex;
+        block->isImage = isImage;
+        block->memory = allocateDeviceMemory(blockSize, memoryTypeIndex, nullptr, &block->mappedData);
+        if (!block->metadata.Allocate(requirements.size, alignment, offset)) {
+            vkFreeMemory(m_device, block->memory, nullptr);
+            throw std::runtime_error("failed to sub-allocate from a new memory block!");
+        }
+        target = block.get();
+        m_blocks.push_back(std::move(block));
+    }
+
+    allocation.memory = target->memory;
+    allocation.offset = offset;
+    allocation.size = requirements.size;
+    allocation.block = target;
+    if (target->mappedData != nullptr) {
+        allocation.mappedData = static_cast<char*>(target->mappedData) + offset;
+    }
+    return allocation;
+}
+
+void GpuAllocator::Free(GpuAllocation& allocation)
+{
+    if (allocation.memory == VK_NULL_HANDLE) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (allocation.block == nullptr) {
+        vkFreeMemory(m_device, allocation.memory, nullptr); // Implicitly unmaps
+        m_dedicatedCount--;
+        m_dedicatedBytes -= allocation.size;
+        allocation = GpuAllocation();
+        return;
+    }
+
+    GpuMemoryBlock* block = allocation.block;
+    block->metadata.Free(allocation.offset, allocation.size);
+    allocation = GpuAllocation();
+
+    // Release an empty block unless it is the last one of its kind, which is kept to avoid churn
+    if (block->metadata.IsEmpty()) {
+        auto sameKind = [block](const std::unique_ptr<GpuMemoryBlock>& other) {
+            return other.get() != block && other->memoryTypeIndex == block->memoryTypeIndex &&
+                other->isImage == block->isImage && other->metadata.GetAlgorithm() == block->metadata.GetAlgorithm();
+        };
+        if (std::any_of(m_blocks.begin(), m_blocks.end(), sameKind)) {
+            vkFreeMemory(m_device, block->memory, nullptr);
+            m_blocks.erase(std::find_if(m_blocks.begin(), m_blocks.end(),
+                [block](const std::unique_ptr<GpuMemoryBlock>& other) { return other.get() == block; }));
+        }
+    }
+}
+
+void GpuAllocator::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const GpuAllocationInfo& info, VkBuffer& buffer, GpuAllocation& allocation)
+{
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = usage;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (vkCreateBuffer(m_device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create buffer!");
+    }
+
+    if (!m_dedicatedAllocation) {
+        VkMemoryRequirements memRequirements;
+        vkGetBufferMemoryRequirements(m_device, buffer, &memRequirements);
+        allocation = allocate(memRequirements, info, false, nullptr, false);
+        vkBindBufferMemory(m_device, buffer, allocation.memory, allocation.offset);
+        return;
+    }
+
+    VkBufferMemoryRequirementsInfo2 requirementsInfo{};
+    requirementsInfo.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2;
+    requirementsInfo.buffer = buffer;
+    VkMemoryDedicatedRequirements dedicatedRequirements{};
+    dedicatedRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+    VkMemoryRequirements2 memRequirements{};
+    memRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+    memRequirements.pNext = &dedicatedRequirements;
+    vkGetBufferMemoryRequirements2(m_device, &requirementsInfo, &memRequirements);
+
+    VkMemoryDedicatedAllocateInfo dedicatedInfo{};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.buffer = buffer;
+    bool prefersDedicated = dedicatedRequirements.prefersDedicatedAllocation || dedicatedRequirements.requiresDedicatedAllocation;
+    allocation = allocate(memRequirements.memoryRequirements, info, false, &dedicatedInfo, prefersDedicated);
+    vkBindBufferMemory(m_device, buffer, allocation.memory, allocation.offset);
+}
+
+void GpuAllocator::DestroyBuffer(VkBuffer& buffer, GpuAllocation& allocation)
+{
+    if (buffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(m_device, buffer, nullptr);
+        buffer = VK_NULL_HANDLE;
+    }
+    Free(allocation);
+}
+
+void GpuAllocator::CreateImage(const VkImageCreateInfo& imageInfo, const GpuAllocationInfo& info, VkImage& image, GpuAllocation& allocation)
+{
+    if (vkCreateImage(m_device, &imageInfo, nullptr, &image) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create image!");
+    }
+
+    bool isImage = imageInfo.tiling == VK_IMAGE_TILING_OPTIMAL;
+    if (!m_dedicatedAllocation) {
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(m_device, image, &memRequirements);
+        allocation = allocate(memRequirements, info, isImage, nullptr, false);
+        vkBindImageMemory(m_device, image, allocation.memory, allocation.offset);
+        return;
+    }
+
+    VkImageMemoryRequirementsInfo2 requirementsInfo{};
+    requirementsInfo.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2;
+    requirementsInfo.image = image;
+    VkMemoryDedicatedRequirements dedicatedRequirements{};
+    dedicatedRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS;
+    VkMemoryRequirements2 memRequirements{};
+    memRequirements.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+    memRequirements.pNext = &dedicatedRequirements;
+    vkGetImageMemoryRequirements2(m_device, &requirementsInfo, &memRequirements);
+
+    VkMemoryDedicatedAllocateInfo dedicatedInfo{};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.image = image;
+    bool prefersDedicated = dedicatedRequirements.prefersDedicatedAllocation || dedicatedRequirements.requiresDedicatedAllocation;
+    allocation = allocate(memRequirements.memoryRequirements, info, isImage, &dedicatedInfo, prefersDedicated);
+    vkBindImageMemory(m_device, image, allocation.memory, allocation.offset);
+}
+
+void GpuAllocator::DestroyImage(VkImage& image, GpuAllocation& allocation)
+{
+    if (image != VK_NULL_HANDLE) {
+        vkDestroyImage(m_device, image, nullptr);
+        image = VK_NULL_HANDLE;
+    }
+    Free(allocation);
+}
+
+GpuAllocatorStats GpuAllocator::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    GpuAllocatorStats stats;
+    stats.blockCount = static_cast<uint32_t>(m_blocks.size());
+    stats.dedicatedCount = m_dedicatedCount;
+    stats.dedicatedBytes = m_dedicatedBytes;
+    stats.allocationCount = m_dedicatedCount;
+    stats.deviceMemoryCount = stats.blockCount + m_dedicatedCount;
+    for (const auto& block : m_blocks) {
+        stats.allocationCount += block->metadata.GetAllocationCount();
+        stats.blockBytes += block->metadata.GetSize();
+        stats.usedBytes += block->metadata.GetUsedBytes();
+        stats.freeBytes += block->metadata.GetFreeBytes();
+        stats.largestFreeRange = std::max<VkDeviceSize>(stats.largestFreeRange, block->metadata.GetLargestFreeRange());
+    }
+    stats.fragmentation = BlockMetadata::ComputeFragmentation(stats.largestFreeRange, stats.freeBytes);
+    return stats;
+}
+
+// =================================================================================
+// Private Helper Methods
+// =================================================================================
+
+uint32_t GpuAllocator::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const
+{
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++) {
+        if ((typeFilter & (1 << i)) && (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+            return i;
+        }
+    }
+    throw std::runtime_error("failed to find suitable memory type!");
+}
+
+VkDeviceSize GpuAllocator::blockSizeFor(uint32_t memoryTypeIndex) const
+{
+    // Small heaps (e.g. the 256 MiB host-visible device-local heap without ReBAR) get smaller blocks
+    uint32_t heapIndex = m_memoryProperties.memoryTypes[memoryTypeIndex].heapIndex;
+    VkDeviceSize heapSize = m_memoryProperties.memoryHeaps[heapIndex].size;
+    return std::min(DefaultBlockSize, std::max<VkDeviceSize>(heapSize / 8, 1024 * 1024));
+}
+
+VkDeviceMemory GpuAllocator::allocateDeviceMemory(VkDeviceSize size, uint32_t memoryTypeIndex, const void* pNext, void** mappedData)
+{
+    uint32_t liveCount = static_cast<uint32_t>(m_blocks.size()) + m_dedicatedCount;
+    if (liveCount >= m_maxAllocationCount) {
+        throw std::runtime_error("exceeded maxMemoryAllocationCount!");
+    }
+
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext = pNext;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    if (vkAllocateMemory(m_device, &allocInfo, nullptr, &memory) != VK_SUCCESS) {
+        throw std::runtime_error("failed to allocate device memory!");
+    }
+
+    // Host-visible memory stays mapped for its whole lifetime
+    *mappedData = nullptr;
+    if (m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        if (vkMapMemory(m_device, memory, 0, VK_WHOLE_SIZE, 0, mappedData) != VK_SUCCESS) {
+            vkFreeMemory(m_device, memory, nullptr);
+            throw std::runtime_error("failed to map device memory!");
+        }
+    }
+    return memory;
+}
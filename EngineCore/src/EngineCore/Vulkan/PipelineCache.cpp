@@ -0,0 +1,182 @@
+#include "EngineCore/Vulkan/PipelineCache.hpp"
+#include "EngineCore/Hash.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    constexpr char CacheMagic[8] = { 'V', 'E', 'P', 'C', 'A', 'C', 'H', 'E' };
+    constexpr uint32_t CacheFileVersion = 1;
+
+    /// The header written in front of the driver's cache data.
+    struct CacheFileHeader {
+        char magic[8];
+        uint32_t fileVersion;
+        uint32_t vendorID;
+        uint32_t deviceID;
+        uint32_t driverVersion;
+        uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+        uint64_t dataSize;
+        uint64_t dataHash;
+    };
+
+    // Fills a header describing the given device.
+    CacheFileHeader makeHeader(const VkPhysicalDeviceProperties& properties)
+    {
+        CacheFileHeader header{};
+        std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+        header.fileVersion = CacheFileVersion;
+        header.vendorID = properties.vendorID;
+        header.deviceID = properties.deviceID;
+        header.driverVersion = properties.driverVersion;
+        std::memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+        return header;
+    }
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+PipelineCache::PipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, std::string filePath)
+    : m_device(device), m_filePath(std::move(filePath))
+{
+    vkGetPhysicalDeviceProperties(physicalDevice, &m_deviceProperties);
+
+    auto start = std::chrono::steady_clock::now();
+    std::string initialData;
+    bool loaded = !m_filePath.empty() && load(initialData);
+
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = initialData.size();
+    createInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+    if (vkCreatePipelineCache(m_device, &createInfo, nullptr, &m_cache) != VK_SUCCESS) {
+        // The driver may still reject data that passed our checks; fall back to an empty cache
+        Log::GetCoreLogger()->warn("Driver rejected pipeline cache data, starting with an empty cache.");
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        loaded = false;
+        if (vkCreatePipelineCache(m_device, &createInfo, nullptr, &m_cache) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create pipeline cache!");
+        }
+    }
+
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (loaded) {
+        Log::GetCoreLogger()->info("Pipeline cache loaded from '{0}' ({1} bytes, {2:.2f} ms).", m_filePath, initialData.size(), milliseconds);
+    } else {
+        Log::GetCoreLogger()->info("Pipeline cache created empty.");
+    }
+}
+
+PipelineCache::~PipelineCache()
+{
+    if (m_cache != VK_NULL_HANDLE) {
+        vkDestroyPipelineCache(m_device, m_cache, nullptr);
+    }
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+bool PipelineCache::Save() const
+{
+    if (m_filePath.empty()) {
+        return false;
+    }
+
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(m_device, m_cache, &dataSize, nullptr) != VK_SUCCESS) {
+        Log::GetCoreLogger()->error("Failed to query pipeline cache size.");
+        return false;
+    }
+    std::vector<char> data(dataSize);
+    if (vkGetPipelineCacheData(m_device, m_cache, &dataSize, data.data()) != VK_SUCCESS) {
+        Log::GetCoreLogger()->error("Failed to read pipeline cache data.");
+        return false;
+    }
+    data.resize(dataSize);
+
+    CacheFileHeader header = makeHeader(m_deviceProperties);
+    header.dataSize = dataSize;
+    header.dataHash = HashBytes(data.data(), data.size());
+
+    // Write everything to a temporary file first, then swap it in with a rename
+    std::string tempPath = m_filePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            Log::GetCoreLogger()->error("Failed to open '{0}' for writing.", tempPath);
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(data.data(), data.size());
+        file.flush();
+        if (!file.good()) {
+            Log::GetCoreLogger()->error("Failed to write pipeline cache to '{0}'.", tempPath);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, m_filePath, error);
+    if (error) {
+        Log::GetCoreLogger()->error("Failed to replace pipeline cache '{0}': {1}", m_filePath, error.message());
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    Log::GetCoreLogger()->info("Pipeline cache saved to '{0}' ({1} bytes).", m_filePath, dataSize);
+    return true;
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+bool PipelineCache::load(std::string& data) const
+{
+    std::ifstream file(m_filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false; // No cache yet, e.g. on first launch
+    }
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+
+    CacheFileHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        Log::GetCoreLogger()->warn("Pipeline cache '{0}' is truncated, ignoring it.", m_filePath);
+        return false;
+    }
+
+    CacheFileHeader expected = makeHeader(m_deviceProperties);
+    if (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.fileVersion != expected.fileVersion) {
+        Log::GetCoreLogger()->warn("Pipeline cache '{0}' has an unknown format, ignoring it.", m_filePath);
+        return false;
+    }
+    if (header.vendorID != expected.vendorID || header.deviceID != expected.deviceID ||
+        header.driverVersion != expected.driverVersion ||
+        std::memcmp(header.pipelineCacheUUID, expected.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+        Log::GetCoreLogger()->info("Pipeline cache '{0}' was written by a different device or driver, ignoring it.", m_filePath);
+        return false;
+    }
+
+    if (header.dataSize != fileSize - sizeof(header)) {
+        Log::GetCoreLogger()->warn("Pipeline cache '{0}' has an unexpected size, ignoring it.", m_filePath);
+        return false;
+    }
+    data.resize(static_cast<size_t>(header.dataSize));
+    if (!file.read(data.data(), data.size()) || HashBytes(data.data(), data.size()) != header.dataHash) {
+        Log::GetCoreLogger()->warn("Pipeline cache '{0}' is corrupt, ignoring it.", m_filePath);
+        data.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,79 @@
+#include "EngineCore/Vulkan/QueueFamilies.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+QueueFamilies QueueFamilies::Find(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface)
+{
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, families.data());
+
+    auto canPresent = [&](uint32_t index) {
+        VkBool32 supported = VK_FALSE;
+        vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, index, surface, &supported);
+        return supported == VK_TRUE;
+    };
+
+    // Graphics: the first family with graphics and compute, preferring one that can also present
+    QueueFamilies result;
+    for (uint32_t i = 0; i < familyCount; i++) {
+        VkQueueFlags flags = families[i].queueFlags;
+        if (families[i].queueCount == 0 || (flags & VK_QUEUE_GRAPHICS_BIT) == 0 || (flags & VK_QUEUE_COMPUTE_BIT) == 0) {
+            continue;
+        }
+        if (result.graphics == None) {
+            result.graphics = i;
+        }
+        if (surface != VK_NULL_HANDLE && canPresent(i)) {
+            result.graphics = i;
+            result.present = i;
+            break;
+        }
+    }
+    if (result.graphics == None) {
+        throw std::runtime_error("failed to find a graphics queue family!");
+    }
+
+    if (surface != VK_NULL_HANDLE && result.present == None) {
+        for (uint32_t i = 0; i < familyCount && result.present == None; i++) {
+            if (families[i].queueCount > 0 && canPresent(i)) {
+                result.present = i;
+            }
+        }
+        if (result.present == None) {
+            throw std::runtime_error("failed to find a queue family that can present!");
+        }
+    }
+
+    // Transfer: a transfer-only family first, then any other family that can copy. Graphics and
+    // compute families implicitly support transfers even when they don't advertise it.
+    auto findFamily = [&](VkQueueFlags required, VkQueueFlags excluded) {
+        for (uint32_t i = 0; i < familyCount; i++) {
+            VkQueueFlags flags = families[i].queueFlags;
+            if (i != result.graphics && families[i].queueCount > 0 && (flags & required) == required && (flags & excluded) == 0) {
+                return i;
+            }
+        }
+        return None;
+    };
+    result.transfer = findFamily(VK_QUEUE_TRANSFER_BIT, VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+    if (result.transfer == None) {
+        result.transfer = findFamily(VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+    }
+    if (result.transfer == None) {
+        result.transfer = result.graphics;
+    }
+
+    // Async compute: a compute family without graphics
+    result.compute = findFamily(VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+    if (result.compute == None) {
+        result.compute = result.graphics;
+    }
+    return result;
+}
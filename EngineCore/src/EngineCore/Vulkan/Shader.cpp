@@ -0,0 +1,43 @@
+#include "EngineCore/Vulkan/Shader.hpp"
+#include "EngineCore/Logger.hpp"
+
+#include <fstream>
+#include <stdexcept>
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+std::vector<char> Shader::ReadFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::ate | std::ios::binary);
+    if (!file.is_open()) {
+        Log::GetCoreLogger()->error("Failed to open file: {0}", filename);
+        throw std::runtime_error("failed to open file: " + filename);
+    }
+    size_t fileSize = (size_t)file.tellg();
+    std::vector<char> buffer(fileSize);
+    file.seekg(0);
+    file.read(buffer.data(), fileSize);
+    file.close();
+    return buffer;
+}
+
+VkShaderModule Shader::CreateModule(VkDevice device, const std::vector<char>& code)
+{
+    VkShaderModuleCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    createInfo.codeSize = code.size();
+    createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
+
+    VkShaderModule shaderModule;
+    if (vkCreateShaderModule(device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
+        throw std::runtime_error("failed to create shader module!");
+    }
+    return shaderModule;
+}
+
+VkShaderModule Shader::LoadModule(VkDevice device, const std::string& filename)
+{
+    return CreateModule(device, ReadFile(filename));
+}
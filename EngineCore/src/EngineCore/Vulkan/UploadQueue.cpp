@@ -0,0 +1,486 @@
+#include "EngineCore/Vulkan/UploadQueue.hpp"
+#include "EngineCore/Logger.hpp"
+#include "EngineCore/Profiling/CpuProfiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    /// Ring allocations start on this alignment so the staging writes stay fast.
+    constexpr VkDeviceSize RingAlignment = 16;
+
+    VkCommandPool createCommandPool(VkDevice device, uint32_t queueFamilyIndex)
+    {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = queueFamilyIndex;
+        VkCommandPool pool = VK_NULL_HANDLE;
+        if (vkCreateCommandPool(device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create upload command pool!");
+        }
+        return pool;
+    }
+
+    VkCommandBuffer allocateCommandBuffer(VkDevice device, VkCommandPool pool)
+    {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = pool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        if (vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("failed to allocate upload command buffer!");
+        }
+        return commandBuffer;
+    }
+}
+
+// =================================================================================
+// Constructor and Destructor
+// =================================================================================
+
+UploadQueue::UploadQueue(const UploadQueueCreateInfo& createInfo)
+    : m_device(createInfo.device),
+      m_allocator(*createInfo.allocator),
+      m_graphicsQueue(createInfo.graphicsQueue),
+      m_graphicsFamily(createInfo.graphicsFamily),
+      m_transferQueue(createInfo.transferQueue ? createInfo.transferQueue : createInfo.graphicsQueue),
+      m_transferFamily(createInfo.transferQueue ? createInfo.transferFamily : createInfo.graphicsFamily),
+      m_dedicatedTransfer(m_transferFamily != m_graphicsFamily),
+      m_capacity((createInfo.capacity + RingAlignment - 1) / RingAlignment * RingAlignment)
+{
+    m_commandPool = createCommandPool(m_device, m_transferFamily);
+    if (m_dedicatedTransfer) {
+        m_acquireCommandPool = createCommandPool(m_device, m_graphicsFamily);
+
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &typeInfo;
+        if (vkCreateSemaphore(m_device, &semaphoreInfo, nullptr, &m_timeline) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create upload timeline semaphore!");
+        }
+    }
+
+    // Staging data only lives until its batch retires, so the ring comes from a linear block
+    GpuAllocationInfo allocInfo{};
+    allocInfo.properties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    allocInfo.transient = true;
+    m_allocator.CreateBuffer(m_capacity, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, allocInfo, m_ringBuffer, m_ringMemory);
+    Log::GetCoreLogger()->info("Upload queue created ({0} MiB staging ring, {1}).", m_capacity / (1024 * 1024),
+        m_dedicatedTransfer ? "dedicated transfer queue" : "graphics queue");
+}
+
+UploadQueue::~UploadQueue()
+{
+    // Copies that were recorded but never submitted are simply dropped with the pool
+    while (!m_pending.empty()) {
+        retireOldest();
+    }
+    recycleAcquired(true);
+    for (const Batch& batch : m_freeBatches) {
+        vkDestroyFence(m_device, batch.fence, nullptr);
+    }
+    if (m_recording.fence != VK_NULL_HANDLE) {
+        vkDestroyFence(m_device, m_recording.fence, nullptr);
+    }
+    vkDestroySemaphore(m_device, m_timeline, nullptr);
+    vkDestroyCommandPool(m_device, m_acquireCommandPool, nullptr);
+    vkDestroyCommandPool(m_device, m_commandPool, nullptr); // Frees every batch's command buffer
+    m_allocator.DestroyBuffer(m_ringBuffer, m_ringMemory);
+}
+
+// =================================================================================
+// Public Methods
+// =================================================================================
+
+void UploadQueue::UploadBuffer(const void* data, VkDeviceSize size, VkBuffer dstBuffer, VkDeviceSize dstOffset)
+{
+    ENGINE_PROFILE_FUNCTION();
+
+    // Large uploads go through the ring in pieces, so they never need all of it at once
+    const VkDeviceSize maxChunk = std::max(m_capacity / 4 / RingAlignment * RingAlignment, RingAlignment);
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        VkDeviceSize chunk = std::min(size, maxChunk);
+        VkDeviceSize ringOffset = stage(bytes, chunk);
+        VkBufferCopy region{};
+        region.srcOffset = ringOffset;
+        region.dstOffset = dstOffset;
+        region.size = chunk;
+        vkCmdCopyBuffer(m_recording.commandBuffer, m_ringBuffer, dstBuffer, 1, &region);
+        if (m_dedicatedTransfer) {
+            addOwnershipTransfer(dstBuffer, dstOffset, chunk);
+        }
+
+        bytes += chunk;
+        dstOffset += chunk;
+        size -= chunk;
+    }
+}
+
+void UploadQueue::BeginImage(VkImage image, uint32_t baseLevel, uint32_t levelCount)
+{
+    if (m_recording.commandBuffer == VK_NULL_HANDLE) {
+        beginBatch();
+    }
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, baseLevel, levelCount, 0, 1 };
+    vkCmdPipelineBarrier(m_recording.commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+void UploadQueue::UploadImage(const void* data, VkDeviceSize size, VkImage image, uint32_t level, uint32_t width, uint32_t height, uint32_t blockHeight)
+{
+    ENGINE_PROFILE_FUNCTION();
+
+    // Split the level into bands of whole block rows that fit into a chunk
+    const VkDeviceSize maxChunk = std::max(m_capacity / 4 / RingAlignment * RingAlignment, RingAlignment);
+    const uint32_t blockRows = (height + blockHeight - 1) / blockHeight;
+    const VkDeviceSize rowBytes = size / std::max(blockRows, 1u);
+    const uint32_t rowsPerBand = static_cast<uint32_t>(std::max<VkDeviceSize>(maxChunk / std::max<VkDeviceSize>(rowBytes, 1), 1));
+    const char* bytes = static_cast<const char*>(data);
+    for (uint32_t row = 0; row < blockRows; row += rowsPerBand) {
+        uint32_t rows = std::min(rowsPerBand, blockRows - row);
+        VkDeviceSize ringOffset = stage(bytes + row * rowBytes, rows * rowBytes);
+
+        VkBufferImageCopy region{};
+        region.bufferOffset = ringOffset;
+        region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1 };
+        region.imageOffset = { 0, static_cast<int32_t>(row * blockHeight), 0 };
+        region.imageExtent = { width, std::min(rows * blockHeight, height - row * blockHeight), 1 };
+        vkCmdCopyBufferToImage(m_recording.commandBuffer, m_ringBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    }
+}
+
+void UploadQueue::FinishImage(VkImage image, uint32_t baseLevel, uint32_t levelCount, VkImageLayout finalLayout)
+{
+    if (m_recording.commandBuffer == VK_NULL_HANDLE) {
+        beginBatch();
+    }
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = finalLayout;
+    barrier.image = image;
+    barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, baseLevel, levelCount, 0, 1 };
+    if (m_dedicatedTransfer) {
+        // Release with the layout transition; submitAcquire() records the matching acquire
+        barrier.dstAccessMask = 0;
+        barrier.srcQueueFamilyIndex = m_transferFamily;
+        barrier.dstQueueFamilyIndex = m_graphicsFamily;
+        vkCmdPipelineBarrier(m_recording.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &barrier);
+        m_recording.imageOwnership.push_back(barrier);
+    } else {
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        vkCmdPipelineBarrier(m_recording.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+}
+
+uint64_t UploadQueue::Submit()
+{
+    if (m_recording.commandBuffer == VK_NULL_HANDLE) {
+        return m_nextBatchId - 1;
+    }
+
+    if (m_dedicatedTransfer && !m_recording.ownership.empty()) {
+        // Release the written ranges to the graphics family; submitAcquire() records the other half
+        for (VkBufferMemoryBarrier& barrier : m_recording.ownership) {
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = 0;
+        }
+        vkCmdPipelineBarrier(m_recording.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            0, 0, nullptr, static_cast<uint32_t>(m_recording.ownership.size()), m_recording.ownership.data(), 0, nullptr);
+    } else if (!m_dedicatedTransfer) {
+        // Make the copies visible to everything submitted to the queue afterwards
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+        vkCmdPipelineBarrier(m_recording.commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            0, 1, &barrier, 0, nullptr, 0, nullptr);
+    }
+    if (vkEndCommandBuffer(m_recording.commandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to record upload command buffer!");
+    }
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &m_recording.commandBuffer;
+    VkFence fence = m_recording.fence;
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    if (m_dedicatedTransfer) {
+        // The semaphore tracks the copies; the fence is left for the acquire submission
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timelineInfo.signalSemaphoreValueCount = 1;
+        timelineInfo.pSignalSemaphoreValues = &m_recording.id;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &m_timeline;
+        fence = VK_NULL_HANDLE;
+    }
+    if (vkQueueSubmit(m_transferQueue, 1, &submitInfo, fence) != VK_SUCCESS) {
+        throw std::runtime_error("failed to submit upload command buffer!");
+    }
+
+    m_recording.ringEnd = m_head;
+    m_recording.ringBytes = m_recordingBytes;
+    m_recordingBytes = 0;
+    m_pending.push_back(std::move(m_recording));
+    m_recording = Batch{};
+    return m_nextBatchId++;
+}
+
+void UploadQueue::Update()
+{
+    while (!m_pending.empty() && isTransferDone(m_pending.front())) {
+        retireOldest();
+    }
+    recycleAcquired(false);
+}
+
+void UploadQueue::WaitIdle()
+{
+    ENGINE_PROFILE_FUNCTION();
+    Submit();
+    while (!m_pending.empty()) {
+        retireOldest();
+    }
+    recycleAcquired(true);
+}
+
+void UploadQueue::WaitAvailable(uint64_t batchId)
+{
+    if (batchId >= m_nextBatchId) {
+        Submit();
+    }
+    while (!IsAvailable(batchId) && !m_pending.empty()) {
+        ENGINE_PROFILE_SCOPE("UploadQueue::waitAvailable");
+        retireOldest();
+    }
+}
+
+// =================================================================================
+// Private Methods
+// =================================================================================
+
+VkDeviceSize UploadQueue::stage(const void* data, VkDeviceSize size)
+{
+    VkDeviceSize ringOffset = 0;
+    while (!tryAllocate(size, ringOffset)) {
+        // The ring is full: hand over what is recorded and wait for the oldest batch to free its space
+        if (m_pending.empty()) {
+            Submit();
+        }
+        if (m_pending.empty()) {
+            throw std::runtime_error("failed to allocate from the staging ring!");
+        }
+        ENGINE_PROFILE_SCOPE("UploadQueue::waitForSpace");
+        retireOldest();
+    }
+    std::memcpy(static_cast<char*>(m_ringMemory.mappedData) + ringOffset, data, static_cast<size_t>(size));
+
+    if (m_recording.commandBuffer == VK_NULL_HANDLE) {
+        beginBatch();
+    }
+    return ringOffset;
+}
+
+bool UploadQueue::tryAllocate(VkDeviceSize size, VkDeviceSize& offset)
+{
+    if (m_usedBytes == 0) {
+        m_head = 0;
+        m_tail = 0;
+    }
+
+    VkDeviceSize start = (m_head + RingAlignment - 1) / RingAlignment * RingAlignment;
+    if (m_usedBytes == 0 || m_head > m_tail) {
+        // Free: [head, capacity) and, after wrapping around, [0, tail)
+        if (start + size <= m_capacity) {
+            offset = start;
+        } else if (size <= m_tail) {
+            offset = 0;
+        } else {
+            return false;
+        }
+    } else {
+        // Wrapped: free is [head, tail)
+        if (start + size > m_tail) {
+            return false;
+        }
+        offset = start;
+    }
+
+    // Alignment and the skipped end of the ring stay with the batch until it retires
+    VkDeviceSize consumed = offset >= m_head ? offset + size - m_head : m_capacity - m_head + offset + size;
+    m_head = offset + size;
+    m_usedBytes += consumed;
+    m_recordingBytes += consumed;
+    return true;
+}
+
+void UploadQueue::beginBatch()
+{
+    if (!m_freeBatches.empty()) {
+        m_recording = std::move(m_freeBatches.back());
+        m_freeBatches.pop_back();
+        vkResetCommandBuffer(m_recording.commandBuffer, 0);
+        vkResetFences(m_device, 1, &m_recording.fence);
+        m_recording.ownership.clear();
+        m_recording.imageOwnership.clear();
+    } else {
+        m_recording.commandBuffer = allocateCommandBuffer(m_device, m_commandPool);
+        if (m_dedicatedTransfer) {
+            m_recording.acquireCommandBuffer = allocateCommandBuffer(m_device, m_acquireCommandPool);
+        }
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        if (vkCreateFence(m_device, &fenceInfo, nullptr, &m_recording.fence) != VK_SUCCESS) {
+            throw std::runtime_error("failed to create upload fence!");
+        }
+    }
+    m_recording.id = m_nextBatchId;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (vkBeginCommandBuffer(m_recording.commandBuffer, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("failed to begin recording upload command buffer!");
+    }
+}
+
+void UploadQueue::addOwnershipTransfer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size)
+{
+    // The chunks of one upload are contiguous, so they collapse into a single range
+    std::vector<VkBufferMemoryBarrier>& ownership = m_recording.ownership;
+    if (!ownership.empty() && ownership.back().buffer == buffer && ownership.back().offset + ownership.back().size == offset) {
+        ownership.back().size += size;
+        return;
+    }
+
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = m_transferFamily;
+    barrier.dstQueueFamilyIndex = m_graphicsFamily;
+    barrier.buffer = buffer;
+    barrier.offset = offset;
+    barrier.size = size;
+    ownership.push_back(barrier);
+}
+
+bool UploadQueue::isTransferDone(const Batch& batch) const
+{
+    if (m_dedicatedTransfer) {
+        uint64_t value = 0;
+        vkGetSemaphoreCounterValue(m_device, m_timeline, &value);
+        return value >= batch.id;
+    }
+    return vkGetFenceStatus(m_device, batch.fence) == VK_SUCCESS;
+}
+
+void UploadQueue::retireOldest()
+{
+    Batch batch = std::move(m_pending.front());
+    m_pending.pop_front();
+    if (m_dedicatedTransfer) {
+        VkSemaphoreWaitInfo waitInfo{};
+        waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores = &m_timeline;
+        waitInfo.pValues = &batch.id;
+        vkWaitSemaphores(m_device, &waitInfo, UINT64_MAX);
+    } else {
+        vkWaitForFences(m_device, 1, &batch.fence, VK_TRUE, UINT64_MAX);
+    }
+
+    // Batches are allocated from the ring in submission order, so the oldest one is at the tail
+    m_tail = batch.ringEnd;
+    m_usedBytes -= batch.ringBytes;
+    m_completedBatchId = batch.id;
+    if (m_dedicatedTransfer) {
+        submitAcquire(batch);
+        m_acquiring.push_back(std::move(batch));
+    } else {
+        m_freeBatches.push_back(std::move(batch));
+    }
+}
+
+void UploadQueue::submitAcquire(Batch& batch)
+{
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkResetCommandBuffer(batch.acquireCommandBuffer, 0);
+    if (vkBeginCommandBuffer(batch.acquireCommandBuffer, &beginInfo) != VK_SUCCESS) {
+        throw std::runtime_error("failed to begin recording upload acquire command buffer!");
+    }
+
+    // The same ranges as the release, made visible to every later graphics submission
+    for (VkBufferMemoryBarrier& barrier : batch.ownership) {
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+    }
+    for (VkImageMemoryBarrier& barrier : batch.imageOwnership) {
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+    }
+    vkCmdPipelineBarrier(batch.acquireCommandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0, 0, nullptr, static_cast<uint32_t>(batch.ownership.size()), batch.ownership.data(),
+        static_cast<uint32_t>(batch.imageOwnership.size()), batch.imageOwnership.data());
+    if (vkEndCommandBuffer(batch.acquireCommandBuffer) != VK_SUCCESS) {
+        throw std::runtime_error("failed to record upload acquire command buffer!");
+    }
+
+    // The semaphore has already reached the value, so the wait orders the acquire after the release without stalling
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.waitSemaphoreValueCount = 1;
+    timelineInfo.pWaitSemaphoreValues = &batch.id;
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.waitSemaphoreCount = 1;
+    submitInfo.pWaitSemaphores = &m_timeline;
+    submitInfo.pWaitDstStageMask = &waitStage;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &batch.acquireCommandBuffer;
+    if (vkQueueSubmit(m_graphicsQueue, 1, &submitInfo, batch.fence) != VK_SUCCESS) {
+        throw std::runtime_error("failed to submit upload acquire command buffer!");
+    }
+}
+
+void UploadQueue::recycleAcquired(bool wait)
+{
+    while (!m_acquiring.empty()) {
+        Batch& batch = m_acquiring.front();
+        if (wait) {
+            vkWaitForFences(m_device, 1, &batch.fence, VK_TRUE, UINT64_MAX);
+        } else if (vkGetFenceStatus(m_device, batch.fence) != VK_SUCCESS) {
+            return;
+        }
+        m_freeBatches.push_back(std::move(batch));
+        m_acquiring.pop_front();
+    }
+}
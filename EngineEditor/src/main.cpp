@@ -1,24 +1,43 @@
 #include <EngineCore/Application.hpp>
+#include <EngineCore/Config.hpp>
 #include <EngineCore/Logger.hpp>
+#include <EngineCore/Scene/CullingBenchmark.hpp>
 #include <stdexcept>
 #include <iostream>
 #include <memory> // Required for std::unique_ptr
 
 /**
  * @brief The main entry point for the Vulkan Engine Editor application.
+ * @param argc The number of command line arguments.
+ * @param argv The command line arguments, e.g. "--frames-in-flight=3".
  * @return EXIT_SUCCESS on successful execution, EXIT_FAILURE on error.
  */
-int main()
+int main(int argc, char** argv)
 {
     // First, initialize the logging system.
     Log::Init();
 
+    // Load startup settings: the config file first, then command line overrides.
+    EngineConfig config;
+    config.LoadFromFile("engine.cfg");
+    config.ApplyCommandLine(argc, argv);
+
+    // The culling micro-benchmark runs on the CPU only and needs no window or device
+    if (config.cullBenchmark) {
+        BenchmarkReport report = CullingBenchmark::Run();
+        report.Log();
+        if (!config.benchmarkOutput.empty() && !report.WriteJson(config.benchmarkOutput)) {
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
     // Create the application instance using a smart pointer for automatic memory management.
     // This ensures that the Application destructor is called even if an exception occurs.
     std::unique_ptr<Application> app;
     try
     {
-        app = std::make_unique<Application>();
+        app = std::make_unique<Application>(config);
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,56 @@
+#include <EngineCore/Assets/MeshFile.hpp>
+#include <EngineCore/Assets/MeshImporter.hpp>
+#include <EngineCore/Assets/MeshOptimizer.hpp>
+#include <EngineCore/Assets/MeshSimplifier.hpp>
+#include <EngineCore/Logger.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Converts an OBJ or glTF mesh into the engine's binary .emesh format.
+ * @param argc The number of command line arguments.
+ * @param argv The input path, the output path and optionally "--no-lods".
+ * @return EXIT_SUCCESS on successful conversion, EXIT_FAILURE on error.
+ */
+int main(int argc, char** argv)
+{
+    Log::Init();
+
+    if (argc < 3 || (argc == 4 && std::strcmp(argv[3], "--no-lods") != 0) || argc > 4) {
+        Log::GetClientLogger()->error("Usage: MeshConverter <input.obj|.glb> <output.emesh> [--no-lods]");
+        return EXIT_FAILURE;
+    }
+    const std::string input = argv[1];
+    const std::string output = argv[2];
+    const bool generateLods = argc < 4;
+
+    try
+    {
+        auto start = std::chrono::steady_clock::now();
+        if (!MeshImporter::IsSupported(input)) {
+            throw std::runtime_error("failed to convert '" + input + "': only .obj and .glb meshes are supported!");
+        }
+        MeshData mesh = MeshImporter::Load(input);
+        if (generateLods) {
+            // Baked here so loading the converted file never runs the simplifier
+            MeshSimplifier::GenerateLods(mesh, LodSettings{});
+        }
+        // Every level is reordered, so the file is staged as it is and never needs optimizing on load
+        MeshOptimizer::Optimize(mesh);
+        MeshFile::Write(output, mesh);
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        Log::GetClientLogger()->info("Converted '{0}' to '{1}': {2} vertices, {3} triangles, {4} LODs in {5:.2f} s.",
+            input, output, mesh.vertices.size(), mesh.lods.front().indexCount / 3, mesh.lods.size(), seconds);
+    }
+    catch (const std::exception& e)
+    {
+        Log::GetClientLogger()->critical("Conversion failed: {0}", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
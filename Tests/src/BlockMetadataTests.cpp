@@ -0,0 +1,209 @@
+#include "EngineCore/Vulkan/BlockMetadata.hpp"
+#include "TestHarness.hpp"
+
+#include <stdexcept>
+
+namespace
+{
+    uint64_t allocate(BlockMetadata& block, uint64_t size, uint64_t alignment = 1)
+    {
+        uint64_t offset = ~0ull;
+        if (!block.Allocate(size, alignment, offset)) {
+            throw std::runtime_error("allocation unexpectedly failed");
+        }
+        return offset;
+    }
+
+    /// Fills a 1024-byte block with four 256-byte allocations at 0, 256, 512 and 768.
+    BlockMetadata makeQuarteredBlock()
+    {
+        BlockMetadata block(1024, BlockMetadata::Algorithm::FreeList);
+        for (int i = 0; i < 4; i++) {
+            allocate(block, 256);
+        }
+        return block;
+    }
+}
+
+// =================================================================================
+// Free List
+// =================================================================================
+
+TEST_CASE(FreeListPicksTheSmallestFittingRange)
+{
+    BlockMetadata block(1024, BlockMetadata::Algorithm::FreeList);
+    uint64_t a = allocate(block, 100);
+    allocate(block, 50);
+    uint64_t c = allocate(block, 200);
+    allocate(block, 30);
+    allocate(block, 100);
+    block.Free(a, 100); // Hole [0, 100)
+    block.Free(c, 200); // Hole [150, 350), tail [480, 1024)
+
+    CHECK_EQ(allocate(block, 90), 0u);
+    CHECK_EQ(allocate(block, 150), 150u);
+    CHECK_EQ(allocate(block, 300), 480u);
+}
+
+TEST_CASE(FreeListPadsForAlignmentAndReusesThePadding)
+{
+    BlockMetadata block(1024, BlockMetadata::Algorithm::FreeList);
+    CHECK_EQ(allocate(block, 1), 0u);
+    CHECK_EQ(allocate(block, 16, 256), 256u);
+
+    // The padding [1, 256) stays free and is the best fit for a small allocation
+    CHECK_EQ(allocate(block, 200), 1u);
+    CHECK_EQ(block.GetUsedBytes(), 217u);
+    CHECK_EQ(block.GetAllocationCount(), 3u);
+
+    uint64_t offset = allocate(block, 8, 64);
+    CHECK_EQ(offset % 64, 0u);
+    CHECK_EQ(offset, 320u);
+}
+
+TEST_CASE(FreeListCoalescesWithBothNeighbours)
+{
+    BlockMetadata block = makeQuarteredBlock();
+
+    block.Free(512, 256);
+    block.Free(256, 256); // Merges with the next range
+    CHECK_EQ(block.GetLargestFreeRange(), 512u);
+    block.Free(768, 256); // Merges with the previous range
+    CHECK_EQ(block.GetLargestFreeRange(), 768u);
+    block.Free(0, 256);   // Merges with the next range into the whole block
+    CHECK_EQ(block.GetLargestFreeRange(), 1024u);
+    CHECK(block.IsEmpty());
+
+    // Only a single merged range can hold the whole block again
+    CHECK_EQ(allocate(block, 1024), 0u);
+}
+
+TEST_CASE(FreeListCoalescesBetweenTwoFreeRanges)
+{
+    BlockMetadata block = makeQuarteredBlock();
+    block.Free(256, 256);
+    block.Free(768, 256);
+    CHECK_EQ(block.GetLargestFreeRange(), 256u);
+
+    block.Free(512, 256); // Joins [256, 512) and [768, 1024)
+    CHECK_EQ(block.GetLargestFreeRange(), 768u);
+    CHECK_EQ(allocate(block, 768), 256u);
+}
+
+TEST_CASE(FreeListReportsExhaustion)
+{
+    BlockMetadata block(1024, BlockMetadata::Algorithm::FreeList);
+    uint64_t offset = 0;
+    CHECK(!block.Allocate(2048, 1, offset));
+    CHECK_EQ(allocate(block, 1024), 0u);
+    CHECK(!block.Allocate(1, 1, offset));
+    CHECK_EQ(block.GetAllocationCount(), 1u);
+    CHECK_EQ(block.GetUsedBytes(), 1024u);
+
+    // Enough bytes are free, but not at the required alignment
+    BlockMetadata small(100, BlockMetadata::Algorithm::FreeList);
+    CHECK_EQ(allocate(small, 50, 64), 0u);
+    CHECK(!small.Allocate(40, 64, offset));
+    CHECK_EQ(allocate(small, 40), 50u);
+}
+
+TEST_CASE(AllocateRejectsInvalidArguments)
+{
+    BlockMetadata block(1024, BlockMetadata::Algorithm::FreeList);
+    uint64_t offset = 0;
+    CHECK_THROWS(block.Allocate(0, 1, offset), std::invalid_argument);
+    CHECK_THROWS(block.Allocate(16, 0, offset), std::invalid_argument);
+    CHECK_THROWS(block.Allocate(16, 48, offset), std::invalid_argument);
+}
+
+TEST_CASE(FreeListDetectsDoubleAndMismatchedFrees)
+{
+    BlockMetadata block = makeQuarteredBlock();
+    block.Free(256, 256);
+
+    CHECK_THROWS(block.Free(256, 256), std::logic_error);  // Double free
+    CHECK_THROWS(block.Free(384, 256), std::logic_error);  // Starts inside a free range
+    CHECK_THROWS(block.Free(128, 256), std::logic_error);  // Ends inside a free range
+    CHECK_THROWS(block.Free(1024, 16), std::logic_error);  // Outside of the block
+    CHECK_THROWS(block.Free(768, 512), std::logic_error);  // Runs past the end of the block
+
+    // Nothing changed, so the remaining ranges still free cleanly and no byte is handed out twice
+    CHECK_EQ(block.GetAllocationCount(), 3u);
+    CHECK_EQ(block.GetUsedBytes(), 768u);
+    CHECK_EQ(allocate(block, 256), 256u);
+    uint64_t offset = 0;
+    CHECK(!block.Allocate(1, 1, offset));
+    block.Free(0, 256);
+    block.Free(256, 256);
+    block.Free(512, 256);
+    block.Free(768, 256);
+    CHECK(block.IsEmpty());
+    CHECK_EQ(block.GetLargestFreeRange(), 1024u);
+}
+
+// =================================================================================
+// Linear
+// =================================================================================
+
+TEST_CASE(LinearBumpsAndResetsOnceEmpty)
+{
+    BlockMetadata block(1024, BlockMetadata::Algorithm::Linear);
+    CHECK_EQ(allocate(block, 100), 0u);
+    CHECK_EQ(allocate(block, 100, 64), 128u);
+    CHECK_EQ(block.GetLargestFreeRange(), 796u);
+
+    // Freed space is not reused while another allocation is live
+    block.Free(0, 100);
+    CHECK_EQ(block.GetLargestFreeRange(), 796u);
+    uint64_t offset = 0;
+    CHECK(!block.Allocate(900, 1, offset));
+
+    block.Free(128, 100);
+    CHECK(block.IsEmpty());
+    CHECK_EQ(block.GetLargestFreeRange(), 1024u);
+    CHECK_EQ(allocate(block, 1024), 0u);
+    CHECK(!block.Allocate(1, 1, offset));
+}
+
+TEST_CASE(LinearDetectsFreesPastTheBumpPointer)
+{
+    BlockMetadata block(1024, BlockMetadata::Algorithm::Linear);
+    allocate(block, 100);
+    CHECK_THROWS(block.Free(100, 100), std::logic_error);
+    block.Free(0, 100);
+    CHECK_THROWS(block.Free(0, 100), std::logic_error);
+}
+
+// =================================================================================
+// Statistics
+// =================================================================================
+
+TEST_CASE(StatsAndFragmentation)
+{
+    BlockMetadata block = makeQuarteredBlock();
+    CHECK_EQ(block.GetSize(), 1024u);
+    CHECK_EQ(block.GetUsedBytes(), 1024u);
+    CHECK_EQ(block.GetFreeBytes(), 0u);
+    CHECK_EQ(block.GetFragmentation(), 0.0f); // A full block is not fragmented
+
+    // Two separate 256-byte holes: half the free space is unusable for a 512-byte request
+    block.Free(0, 256);
+    block.Free(512, 256);
+    CHECK_EQ(block.GetAllocationCount(), 2u);
+    CHECK_EQ(block.GetUsedBytes(), 512u);
+    CHECK_EQ(block.GetFreeBytes(), 512u);
+    CHECK_EQ(block.GetLargestFreeRange(), 256u);
+    CHECK_EQ(block.GetFragmentation(), 0.5f);
+
+    block.Free(256, 256);
+    CHECK_EQ(block.GetLargestFreeRange(), 768u);
+    CHECK_EQ(block.GetFragmentation(), 0.0f);
+
+    CHECK_EQ(BlockMetadata::ComputeFragmentation(0, 0), 0.0f);
+    CHECK_EQ(BlockMetadata::ComputeFragmentation(100, 400), 0.75f);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
@@ -0,0 +1,206 @@
+#include "EngineCore/Scene/Bvh.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "TestHarness.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// An axis-aligned box of 20 units around the origin.
+    Frustum makeFrustum()
+    {
+        Frustum frustum;
+        frustum.planes = {
+            glm::vec4(1.0f, 0.0f, 0.0f, 10.0f), glm::vec4(-1.0f, 0.0f, 0.0f, 10.0f),
+            glm::vec4(0.0f, 1.0f, 0.0f, 10.0f), glm::vec4(0.0f, -1.0f, 0.0f, 10.0f),
+            glm::vec4(0.0f, 0.0f, 1.0f, 10.0f), glm::vec4(0.0f, 0.0f, -1.0f, 10.0f),
+        };
+        return frustum;
+    }
+
+    Aabb makeBox(const glm::vec3& center, float halfSize)
+    {
+        return { center - glm::vec3(halfSize), center + glm::vec3(halfSize) };
+    }
+
+    /// Random boxes, plus a run of identical ones that no split plane can separate.
+    std::vector<Aabb> makeBounds(size_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        std::uniform_real_distribution<float> size(0.1f, 2.0f);
+        std::vector<Aabb> bounds;
+        for (size_t i = 0; i < count; i++) {
+            bounds.push_back(makeBox(glm::vec3(position(rng), position(rng), position(rng)), size(rng)));
+        }
+        for (int i = 0; i < 100; i++) {
+            bounds.push_back({ glm::vec3(1.0f), glm::vec3(2.0f) });
+        }
+        return bounds;
+    }
+
+    std::vector<uint32_t> sorted(std::vector<uint32_t> indices)
+    {
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    std::vector<uint32_t> bruteForceFrustum(const Frustum& frustum, const std::vector<Aabb>& bounds)
+    {
+        std::vector<uint32_t> visible;
+        for (uint32_t i = 0; i < bounds.size(); i++) {
+            if (frustum.IntersectsAabb(bounds[i].min, bounds[i].max)) {
+                visible.push_back(i);
+            }
+        }
+        return visible;
+    }
+
+    std::vector<uint32_t> bruteForceOverlap(const Aabb& box, const std::vector<Aabb>& bounds)
+    {
+        std::vector<uint32_t> overlapping;
+        for (uint32_t i = 0; i < bounds.size(); i++) {
+            if (box.Overlaps(bounds[i])) {
+                overlapping.push_back(i);
+            }
+        }
+        return overlapping;
+    }
+
+    /// The entry distance of the closest box the ray hits, or infinity if it misses all of them.
+    float bruteForceRay(const Ray& ray, const std::vector<Aabb>& bounds)
+    {
+        float closest = std::numeric_limits<float>::infinity();
+        for (const Aabb& box : bounds) {
+            float entry = 0.0f;
+            float exit = std::numeric_limits<float>::max();
+            for (int axis = 0; axis < 3; axis++) {
+                float t1 = (box.min[axis] - ray.origin[axis]) / ray.direction[axis];
+                float t2 = (box.max[axis] - ray.origin[axis]) / ray.direction[axis];
+                entry = std::max(entry, std::min(t1, t2));
+                exit = std::min(exit, std::max(t1, t2));
+            }
+            if (entry <= exit) {
+                closest = std::min(closest, entry);
+            }
+        }
+        return closest;
+    }
+
+    /// Runs every query kind against the BVH and the brute-force reference.
+    void checkQueries(const Bvh& bvh, const std::vector<Aabb>& bounds, std::mt19937& rng)
+    {
+        CHECK_EQ(bvh.GetObjectCount(), bounds.size());
+
+        Frustum frustum = makeFrustum();
+        std::vector<uint32_t> results;
+        bvh.QueryFrustum(frustum, results);
+        CHECK(sorted(results) == bruteForceFrustum(frustum, bounds));
+
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        for (int i = 0; i < 20; i++) {
+            Aabb box = makeBox(glm::vec3(position(rng), position(rng), position(rng)), 6.0f);
+            bvh.QueryAabb(box, results);
+            CHECK(sorted(results) == bruteForceOverlap(box, bounds));
+        }
+
+        // Rays start outside the scene and head roughly along +z, so most of them hit something
+        std::uniform_real_distribution<float> slope(-0.5f, 0.5f);
+        for (int i = 0; i < 50; i++) {
+            Ray ray{ glm::vec3(position(rng), position(rng), -100.0f), glm::vec3(slope(rng), slope(rng), 1.0f) };
+            float expected = bruteForceRay(ray, bounds);
+            RayHit hit;
+            bool found = bvh.Raycast(ray, hit);
+            CHECK_EQ(found, !std::isinf(expected));
+            if (found) {
+                CHECK(std::abs(hit.distance - expected) < 1e-3f);
+                CHECK(hit.objectIndex < bounds.size());
+            }
+        }
+    }
+}
+
+// =================================================================================
+// Queries
+// =================================================================================
+
+TEST_CASE(QueriesMatchBruteForce)
+{
+    std::mt19937 rng(3);
+    std::vector<Aabb> bounds = makeBounds(5000, rng);
+    Bvh bvh;
+    bvh.Build(bounds);
+    CHECK(bvh.GetDepth() > 1);
+    checkQueries(bvh, bounds, rng);
+}
+
+TEST_CASE(ParallelBuildMatchesBruteForce)
+{
+    // Large enough to be split into subtrees built on the pool
+    std::mt19937 rng(4);
+    std::vector<Aabb> bounds = makeBounds(Bvh::SubtreeSize * 6, rng);
+    ThreadPool pool(3);
+    Bvh bvh;
+    bvh.Build(bounds, &pool);
+    checkQueries(bvh, bounds, rng);
+}
+
+TEST_CASE(EmptyBvhFindsNothing)
+{
+    Bvh bvh;
+    bvh.Build({});
+    CHECK(bvh.IsEmpty());
+    std::vector<uint32_t> results;
+    CHECK_EQ(bvh.QueryFrustum(makeFrustum(), results), 0u);
+    CHECK_EQ(bvh.QueryAabb(makeBox(glm::vec3(0.0f), 100.0f), results), 0u);
+    RayHit hit;
+    CHECK(!bvh.Raycast(Ray{ glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f) }, hit));
+}
+
+// =================================================================================
+// Updates
+// =================================================================================
+
+TEST_CASE(QueriesMatchAfterUpdateObject)
+{
+    std::mt19937 rng(5);
+    std::vector<Aabb> bounds = makeBounds(5000, rng);
+    Bvh bvh;
+    bvh.Build(bounds);
+    checkQueries(bvh, bounds, rng);
+
+    // Moves within the scene, and some far outside the root's original bounds
+    std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+    for (int i = 0; i < 500; i++) {
+        uint32_t object = rng() % bounds.size();
+        glm::vec3 center(position(rng), position(rng), position(rng));
+        if (i % 50 == 0) {
+            center = center * 4.0f;
+        }
+        bounds[object] = makeBox(center, 0.5f);
+        bvh.UpdateObject(object, bounds[object]);
+    }
+    checkQueries(bvh, bounds, rng);
+}
+
+TEST_CASE(QueriesMatchAfterRefit)
+{
+    std::mt19937 rng(6);
+    std::vector<Aabb> bounds = makeBounds(5000, rng);
+    Bvh bvh;
+    bvh.Build(bounds);
+    for (Aabb& box : bounds) {
+        box.min += glm::vec3(3.0f, -1.0f, 0.5f);
+        box.max += glm::vec3(3.0f, -1.0f, 0.5f);
+    }
+    bvh.Refit(bounds);
+    checkQueries(bvh, bounds, rng);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
@@ -0,0 +1,58 @@
+#include "EngineCore/Config.hpp"
+#include "TestHarness.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    /// Applies command line arguments as main() would receive them.
+    void applyArguments(EngineConfig& config, std::vector<std::string> arguments)
+    {
+        std::vector<char*> argv = { const_cast<char*>("engine") };
+        for (std::string& argument : arguments) {
+            argv.push_back(argument.data());
+        }
+        config.ApplyCommandLine(static_cast<int>(argv.size()), argv.data());
+    }
+}
+
+// =================================================================================
+// Unsigned Settings
+// =================================================================================
+
+TEST_CASE(UnsignedSettingParses)
+{
+    EngineConfig config;
+    applyArguments(config, { "--scene-width=1920", "--frame-data-mb", "16" });
+    CHECK_EQ(config.sceneWidth, 1920u);
+    CHECK_EQ(config.frameDataMegabytes, 16u);
+}
+
+TEST_CASE(NegativeUnsignedSettingIsIgnored)
+{
+    EngineConfig config;
+    applyArguments(config, { "--scene-width=-1", "--frame-data-mb= -5" });
+    CHECK_EQ(config.sceneWidth, 1280u);
+    CHECK_EQ(config.frameDataMegabytes, 8u);
+}
+
+TEST_CASE(OutOfRangeUnsignedSettingIsIgnored)
+{
+    EngineConfig config;
+    applyArguments(config, { "--scene-width=4294967296", "--frame-data-mb=99999999999999999999" });
+    CHECK_EQ(config.sceneWidth, 1280u);
+    CHECK_EQ(config.frameDataMegabytes, 8u);
+}
+
+TEST_CASE(LargestUnsignedSettingParses)
+{
+    EngineConfig config;
+    applyArguments(config, { "--scene-width=4294967295" });
+    CHECK_EQ(config.sceneWidth, 4294967295u);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
@@ -0,0 +1,160 @@
+#include "EngineCore/Scene/CullingSystem.hpp"
+#include "EngineCore/ThreadPool.hpp"
+#include "TestHarness.hpp"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// A 20-unit box around the origin, tilted so no plane is axis-aligned.
+    Frustum makeFrustum()
+    {
+        Frustum frustum;
+        const glm::vec3 normals[] = {
+            glm::vec3(0.8f, 0.6f, 0.0f), glm::vec3(-0.8f, -0.6f, 0.0f),
+            glm::vec3(-0.6f, 0.8f, 0.0f), glm::vec3(0.6f, -0.8f, 0.0f),
+            glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f),
+        };
+        for (int i = 0; i < Frustum::PlaneCount; i++) {
+            frustum.planes[i] = glm::vec4(normals[i], 10.0f);
+        }
+        return frustum;
+    }
+
+    /// Volumes scattered over three times the frustum's extent, so about a tenth of them are visible.
+    void makeBounds(size_t count, SphereBoundsSoA& spheres, AabbBoundsSoA& boxes)
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(-30.0f, 30.0f);
+        std::uniform_real_distribution<float> size(0.0f, 2.0f);
+        spheres.Clear();
+        boxes.Clear();
+        for (size_t i = 0; i < count; i++) {
+            glm::vec3 center(position(rng), position(rng), position(rng));
+            float radius = size(rng);
+            spheres.Add(center, radius);
+            boxes.Add(center - glm::vec3(radius), center + glm::vec3(radius * 0.5f));
+        }
+    }
+
+    /// The visible indices by testing one volume at a time with the Frustum.
+    std::vector<uint32_t> bruteForce(const Frustum& frustum, const SphereBoundsSoA& spheres)
+    {
+        std::vector<uint32_t> visible;
+        for (size_t i = 0; i < spheres.Size(); i++) {
+            glm::vec3 center(spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]);
+            if (frustum.IntersectsSphere(center, spheres.radius[i])) {
+                visible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return visible;
+    }
+
+    std::vector<uint32_t> bruteForce(const Frustum& frustum, const AabbBoundsSoA& boxes)
+    {
+        std::vector<uint32_t> visible;
+        for (size_t i = 0; i < boxes.Size(); i++) {
+            glm::vec3 min(boxes.minX[i], boxes.minY[i], boxes.minZ[i]);
+            glm::vec3 max(boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i]);
+            if (frustum.IntersectsAabb(min, max)) {
+                visible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        return visible;
+    }
+
+    const SimdLevel AllLevels[] = { SimdLevel::Scalar, SimdLevel::SSE, SimdLevel::AVX2 };
+}
+
+// =================================================================================
+// Kernels
+// =================================================================================
+
+TEST_CASE(KernelsMatchBruteForceAtEveryTailLength)
+{
+    // Counts around the 4- and 8-wide kernels' batches leave every possible remainder
+    Frustum frustum = makeFrustum();
+    SphereBoundsSoA spheres;
+    AabbBoundsSoA boxes;
+    for (SimdLevel level : AllLevels) {
+        CullingSystem culling;
+        culling.SetSimdLevel(level);
+        for (size_t count = 0; count <= 67; count++) {
+            makeBounds(count, spheres, boxes);
+            std::vector<uint32_t> visible;
+            size_t visibleCount = culling.CullSpheres(frustum, spheres, visible);
+            CHECK_EQ(visibleCount, visible.size());
+            CHECK(visible == bruteForce(frustum, spheres));
+            visibleCount = culling.CullAabbs(frustum, boxes, visible);
+            CHECK_EQ(visibleCount, visible.size());
+            CHECK(visible == bruteForce(frustum, boxes));
+        }
+    }
+}
+
+TEST_CASE(KernelsMatchScalarOnLargeSets)
+{
+    Frustum frustum = makeFrustum();
+    SphereBoundsSoA spheres;
+    AabbBoundsSoA boxes;
+    makeBounds(100003, spheres, boxes);
+
+    CullingSystem scalar;
+    scalar.SetSimdLevel(SimdLevel::Scalar);
+    std::vector<uint32_t> expectedSpheres;
+    std::vector<uint32_t> expectedBoxes;
+    scalar.CullSpheres(frustum, spheres, expectedSpheres);
+    scalar.CullAabbs(frustum, boxes, expectedBoxes);
+    CHECK(!expectedSpheres.empty() && expectedSpheres.size() < spheres.Size());
+
+    for (SimdLevel level : AllLevels) {
+        CullingSystem culling;
+        culling.SetSimdLevel(level);
+        std::vector<uint32_t> visible;
+        culling.CullSpheres(frustum, spheres, visible);
+        CHECK(visible == expectedSpheres);
+        culling.CullAabbs(frustum, boxes, visible);
+        CHECK(visible == expectedBoxes);
+    }
+}
+
+// =================================================================================
+// Batches
+// =================================================================================
+
+TEST_CASE(ParallelBatchesKeepTheScalarOrder)
+{
+    // A partial last batch, and a batch boundary that is not a multiple of the SIMD width
+    Frustum frustum = makeFrustum();
+    SphereBoundsSoA spheres;
+    AabbBoundsSoA boxes;
+    makeBounds(CullingSystem::MinBatchSize * 5 + 13, spheres, boxes);
+    std::vector<uint32_t> expectedSpheres = bruteForce(frustum, spheres);
+    std::vector<uint32_t> expectedBoxes = bruteForce(frustum, boxes);
+
+    ThreadPool pool(3);
+    for (SimdLevel level : AllLevels) {
+        CullingSystem culling(&pool);
+        culling.SetSimdLevel(level);
+        std::vector<uint32_t> visible;
+        culling.CullSpheres(frustum, spheres, visible);
+        CHECK(visible == expectedSpheres);
+        culling.CullAabbs(frustum, boxes, visible);
+        CHECK(visible == expectedBoxes);
+    }
+}
+
+TEST_CASE(SimdLevelIsLoweredToTheSupportedOne)
+{
+    CullingSystem culling;
+    culling.SetSimdLevel(SimdLevel::AVX2);
+    CHECK(static_cast<int>(culling.GetSimdLevel()) <= static_cast<int>(CullingSystem::GetSupportedSimdLevel()));
+    culling.SetSimdLevel(SimdLevel::Scalar);
+    CHECK(culling.GetSimdLevel() == SimdLevel::Scalar);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
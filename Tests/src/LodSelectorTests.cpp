@@ -0,0 +1,118 @@
+#include "EngineCore/Scene/LodSelector.hpp"
+#include "TestHarness.hpp"
+
+#include <vector>
+
+namespace
+{
+    /// Levels whose errors double, so each one's boundary lies at a distance equal to its error.
+    const std::vector<MeshLod> Lods = {
+        { 0, 96, 0.0f },
+        { 96, 48, 1.0f },
+        { 144, 24, 2.0f },
+        { 168, 12, 4.0f },
+    };
+
+    /// One pixel per unit at distance 1 from a camera at the origin, a 1-pixel threshold and 25% hysteresis.
+    /// A level's projected error is then its error divided by the distance, and it is coarsened to at 0.75 pixels.
+    LodSelector makeSelector()
+    {
+        LodSelector selector;
+        selector.SetCamera(glm::mat4(1.0f), glm::mat4(1.0f), 2.0f);
+        selector.SetPixelError(1.0f);
+        selector.SetHysteresis(0.25f);
+        return selector;
+    }
+
+    uint32_t selectAt(const LodSelector& selector, float distance, uint32_t currentLod)
+    {
+        return selector.Select(Lods, glm::vec3(0.0f, 0.0f, distance), 0.0f, 1.0f, currentLod);
+    }
+}
+
+// =================================================================================
+// Camera
+// =================================================================================
+
+TEST_CASE(CameraPositionAndScaleComeFromTheMatrices)
+{
+    LodSelector selector;
+    glm::mat4 view(1.0f);
+    view[3] = glm::vec4(-5.0f, 2.0f, 0.0f, 1.0f); // Camera at (5, -2, 0)
+    glm::mat4 projection(1.0f);
+    projection[1][1] = -2.0f;                     // Flipped clip space Y
+    selector.SetCamera(view, projection, 100.0f);
+
+    CHECK_EQ(selector.GetCameraPosition().x, 5.0f);
+    CHECK_EQ(selector.GetCameraPosition().y, -2.0f);
+    CHECK_EQ(selector.GetPixelsPerUnit(), 100.0f);
+}
+
+// =================================================================================
+// Hysteresis
+// =================================================================================
+
+TEST_CASE(BothNeighboursAreStableAtTheThreshold)
+{
+    // At distance 1, LOD 1 projects to exactly the 1-pixel threshold
+    LodSelector selector = makeSelector();
+    CHECK_EQ(selectAt(selector, 1.0f, 0), 0u); // Not below 0.75 pixels, so no coarsening
+    CHECK_EQ(selectAt(selector, 1.0f, 1), 1u); // Not above 1 pixel, so no refining
+}
+
+TEST_CASE(RefinesAsSoonAsTheThresholdIsExceeded)
+{
+    LodSelector selector = makeSelector();
+    CHECK_EQ(selectAt(selector, 0.99f, 1), 0u);
+    CHECK_EQ(selectAt(selector, 1.99f, 2), 1u);
+    CHECK_EQ(selectAt(selector, 0.5f, 3), 0u); // Several levels at once
+}
+
+TEST_CASE(CoarsensOnlyBelowTheHysteresisBand)
+{
+    // LOD 1 projects to 0.75 pixels at distance 4/3
+    LodSelector selector = makeSelector();
+    CHECK_EQ(selectAt(selector, 1.30f, 0), 0u);
+    CHECK_EQ(selectAt(selector, 1.34f, 0), 1u);
+    CHECK_EQ(selectAt(selector, 100.0f, 0), 3u); // Several levels at once
+}
+
+TEST_CASE(OscillatingAroundABoundaryDoesNotPop)
+{
+    LodSelector selector = makeSelector();
+    uint32_t lod = selectAt(selector, 0.9f, 0);
+    CHECK_EQ(lod, 0u);
+    for (int frame = 0; frame < 20; frame++) {
+        lod = selectAt(selector, frame % 2 == 0 ? 1.1f : 0.95f, lod);
+        CHECK_EQ(lod, 0u); // Never reaches 4/3
+    }
+    lod = selectAt(selector, 1.5f, lod);
+    CHECK_EQ(lod, 1u);
+    for (int frame = 0; frame < 20; frame++) {
+        lod = selectAt(selector, frame % 2 == 0 ? 1.1f : 1.5f, lod);
+        CHECK_EQ(lod, 1u); // Never drops below 1
+    }
+}
+
+// =================================================================================
+// Edge Cases
+// =================================================================================
+
+TEST_CASE(EdgeCases)
+{
+    LodSelector selector = makeSelector();
+    CHECK_EQ(selector.Select({ Lods[0] }, glm::vec3(0.0f, 0.0f, 100.0f), 0.0f, 1.0f, 0), 0u);
+    CHECK_EQ(selectAt(selector, 100.0f, 17), 3u); // A stale level beyond the chain is clamped
+
+    // The camera inside the bounding sphere always gets the finest level
+    CHECK_EQ(selector.Select(Lods, glm::vec3(0.0f, 0.0f, 100.0f), 200.0f, 1.0f, 3), 0u);
+
+    // Scaling the object up scales its errors: at distance 2 and scale 2, LOD 2 projects to 2 pixels
+    CHECK_EQ(selector.Select(Lods, glm::vec3(0.0f, 0.0f, 2.0f), 0.0f, 1.0f, 2), 2u);
+    CHECK_EQ(selector.Select(Lods, glm::vec3(0.0f, 0.0f, 2.0f), 0.0f, 2.0f, 2), 1u);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
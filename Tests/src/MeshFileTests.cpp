@@ -0,0 +1,64 @@
+#include "EngineCore/Assets/MeshFile.hpp"
+#include "TestHarness.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace
+{
+    /// A quad as two triangles with a single level of detail.
+    MeshData makeQuad()
+    {
+        MeshData mesh;
+        mesh.name = "quad";
+        mesh.vertices = {
+            { glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f) },
+            { glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f) },
+            { glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(1.0f) },
+            { glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f) },
+        };
+        mesh.indices = { 0, 1, 2, 0, 2, 3 };
+        mesh.lods = { { 0, 6, 0.0f } };
+        mesh.ComputeBounds();
+        return mesh;
+    }
+
+    /// Removes the file when the case ends, whether it passed or not.
+    struct TemporaryFile
+    {
+        std::string path;
+        explicit TemporaryFile(std::string name) : path(std::move(name)) {}
+        ~TemporaryFile() { std::remove(path.c_str()); }
+    };
+}
+
+// =================================================================================
+// Loading
+// =================================================================================
+
+TEST_CASE(WrittenMeshLoadsBack)
+{
+    TemporaryFile file("MeshFileTests_valid.emesh");
+    MeshFile::Write(file.path, makeQuad());
+
+    MeshFile mesh(file.path);
+    CHECK_EQ(mesh.GetVertexCount(), 4u);
+    CHECK_EQ(mesh.GetIndexCount(), 6u);
+    CHECK_EQ(mesh.GetIndices()[5], 3u);
+}
+
+TEST_CASE(OutOfRangeIndexIsRejected)
+{
+    MeshData quad = makeQuad();
+    quad.indices[4] = 4; // One past the last vertex
+    TemporaryFile file("MeshFileTests_bad_index.emesh");
+    MeshFile::Write(file.path, quad);
+    CHECK_THROWS(MeshFile mesh(file.path), std::runtime_error);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
@@ -0,0 +1,131 @@
+#include "EngineCore/Assets/MeshImporter.hpp"
+#include "TestHarness.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /// Removes the file when the case ends, whether it passed or not.
+    struct TemporaryFile
+    {
+        std::string path;
+        explicit TemporaryFile(std::string name) : path(std::move(name)) {}
+        ~TemporaryFile() { std::remove(path.c_str()); }
+    };
+
+    void appendU32(std::string& out, uint32_t value)
+    {
+        char bytes[4];
+        std::memcpy(bytes, &value, 4);
+        out.append(bytes, 4);
+    }
+
+    /// Writes a .glb with the given JSON and a binary chunk holding one triangle's float positions.
+    void writeGlb(const std::string& path, std::string json)
+    {
+        const float positions[] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+        std::string bin(reinterpret_cast<const char*>(positions), sizeof(positions));
+        json.resize((json.size() + 3) / 4 * 4, ' ');
+
+        std::string file;
+        appendU32(file, 0x46546C67); // "glTF"
+        appendU32(file, 2);
+        appendU32(file, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+        appendU32(file, static_cast<uint32_t>(json.size()));
+        appendU32(file, 0x4E4F534A); // "JSON"
+        file += json;
+        appendU32(file, static_cast<uint32_t>(bin.size()));
+        appendU32(file, 0x004E4942); // "BIN\0"
+        file += bin;
+        std::ofstream(path, std::ios::binary).write(file.data(), static_cast<std::streamsize>(file.size()));
+    }
+
+    /// A single triangle; the parts are substituted to break one thing at a time.
+    std::string makeJson(const std::string& accessor = R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"})",
+                         const std::string& view = R"({"buffer":0,"byteLength":36})",
+                         const std::string& arrays = "")
+    {
+        std::string json = R"({"asset":{"version":"2.0"},"scene":0,"scenes":[{"nodes":[0]}],"nodes":[{"mesh":0}],)";
+        if (arrays.empty()) {
+            json += R"("meshes":[{"primitives":[{"attributes":{"POSITION":0}}]}],)";
+            json += R"("accessors":[)" + accessor + "],";
+            json += R"("bufferViews":[)" + view + "],";
+        } else {
+            json += arrays + ",";
+        }
+        json += R"("buffers":[{"byteLength":36}]})";
+        return json;
+    }
+
+    MeshData load(const std::string& json)
+    {
+        TemporaryFile file("MeshImporterTests.glb");
+        writeGlb(file.path, json);
+        return MeshImporter::Load(file.path);
+    }
+}
+
+// =================================================================================
+// Binary glTF
+// =================================================================================
+
+TEST_CASE(ValidTriangleLoads)
+{
+    MeshData mesh = load(makeJson());
+    CHECK_EQ(mesh.vertices.size(), 3u);
+    CHECK_EQ(mesh.indices.size(), 3u);
+
+    // An explicit stride, with the last element ending exactly at the view's end
+    mesh = load(makeJson(R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"})",
+                         R"({"buffer":0,"byteLength":36,"byteStride":12})"));
+    CHECK_EQ(mesh.vertices.size(), 3u);
+}
+
+TEST_CASE(MissingTopLevelArraysAreRejected)
+{
+    const std::string meshes = R"("meshes":[{"primitives":[{"attributes":{"POSITION":0}}]}])";
+    const std::string accessors = R"("accessors":[{"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"}])";
+    const std::string views = R"("bufferViews":[{"buffer":0,"byteLength":36}])";
+    CHECK_THROWS(load(makeJson("", "", meshes + "," + views)), std::runtime_error);
+    CHECK_THROWS(load(makeJson("", "", meshes + "," + accessors)), std::runtime_error);
+    CHECK_THROWS(load(makeJson("", "", accessors + "," + views)), std::runtime_error);
+}
+
+TEST_CASE(InvalidAccessorNumbersAreRejected)
+{
+    const std::string view = R"({"buffer":0,"byteLength":36})";
+    CHECK_THROWS(load(makeJson(R"({"bufferView":0,"componentType":5126,"count":-3,"type":"VEC3"})", view)), std::runtime_error);
+    CHECK_THROWS(load(makeJson(R"({"bufferView":0,"componentType":5126,"count":2.5,"type":"VEC3"})", view)), std::runtime_error);
+    CHECK_THROWS(load(makeJson(R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3","byteOffset":-12})", view)), std::runtime_error);
+    CHECK_THROWS(load(makeJson(R"({"bufferView":-1,"componentType":5126,"count":3,"type":"VEC3"})", view)), std::runtime_error);
+    CHECK_THROWS(load(makeJson(R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"})",
+                               R"({"buffer":0,"byteLength":36,"byteOffset":1e300})")), std::runtime_error);
+}
+
+TEST_CASE(AccessorsOutsideTheirBufferAreRejected)
+{
+    const std::string accessor = R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3"})";
+    CHECK_THROWS(load(makeJson(accessor, R"({"buffer":0,"byteLength":32})")), std::runtime_error);
+    CHECK_THROWS(load(makeJson(accessor, R"({"buffer":0,"byteLength":36,"byteOffset":4})")), std::runtime_error);
+    CHECK_THROWS(load(makeJson(R"({"bufferView":0,"componentType":5126,"count":3,"type":"VEC3","byteOffset":40})",
+                               R"({"buffer":0,"byteLength":36})")), std::runtime_error);
+
+    // A stride of 2^60 with 17 elements wraps the naive end offset around to a small value
+    CHECK_THROWS(load(makeJson(R"({"bufferView":0,"componentType":5126,"count":17,"type":"VEC3"})",
+                               R"({"buffer":0,"byteLength":36,"byteStride":1152921504606846976})")), std::runtime_error);
+    CHECK_THROWS(load(makeJson(accessor, R"({"buffer":0,"byteLength":36,"byteStride":256})")), std::runtime_error);
+    CHECK_THROWS(load(makeJson(accessor, R"({"buffer":0,"byteLength":36,"byteStride":8})")), std::runtime_error);
+    CHECK_THROWS(load(makeJson(R"({"bufferView":0,"componentType":5126,"count":9,"type":"SCALAR"})",
+                               R"({"buffer":0,"byteLength":36,"byteStride":2})")), std::runtime_error);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
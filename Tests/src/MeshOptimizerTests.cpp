@@ -0,0 +1,228 @@
+#include "EngineCore/Assets/MeshOptimizer.hpp"
+#include "TestHarness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    using Triangle = std::array<uint32_t, 3>;
+    using PositionTriangle = std::array<std::tuple<float, float, float>, 3>;
+
+    /// A UV sphere in ring order, the way generated and imported meshes usually arrive.
+    MeshData makeSphere(uint32_t segments)
+    {
+        const uint32_t rings = segments / 2;
+        const float pi = 3.14159265358979f;
+        MeshData mesh;
+        mesh.name = "sphere";
+        mesh.vertices.push_back({ glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(1.0f) });
+        for (uint32_t ring = 1; ring < rings; ring++) {
+            float polar = pi * ring / rings;
+            for (uint32_t segment = 0; segment < segments; segment++) {
+                float azimuth = 2.0f * pi * segment / segments;
+                glm::vec3 position(std::sin(polar) * std::cos(azimuth), std::cos(polar), std::sin(polar) * std::sin(azimuth));
+                mesh.vertices.push_back({ position, glm::vec3(1.0f) });
+            }
+        }
+        const uint32_t southPole = static_cast<uint32_t>(mesh.vertices.size());
+        mesh.vertices.push_back({ glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(1.0f) });
+
+        auto ringVertex = [segments](uint32_t ring, uint32_t segment) { return 1 + (ring - 1) * segments + segment % segments; };
+        for (uint32_t segment = 0; segment < segments; segment++) {
+            mesh.indices.insert(mesh.indices.end(), { 0, ringVertex(1, segment), ringVertex(1, segment + 1) });
+        }
+        for (uint32_t ring = 1; ring + 1 < rings; ring++) {
+            for (uint32_t segment = 0; segment < segments; segment++) {
+                uint32_t a = ringVertex(ring, segment);
+                uint32_t b = ringVertex(ring, segment + 1);
+                uint32_t c = ringVertex(ring + 1, segment);
+                uint32_t d = ringVertex(ring + 1, segment + 1);
+                mesh.indices.insert(mesh.indices.end(), { a, c, b, b, c, d });
+            }
+        }
+        for (uint32_t segment = 0; segment < segments; segment++) {
+            mesh.indices.insert(mesh.indices.end(), { southPole, ringVertex(rings - 1, segment + 1), ringVertex(rings - 1, segment) });
+        }
+        mesh.ComputeBounds();
+        mesh.ResetLods();
+        return mesh;
+    }
+
+    /// Shuffles the triangles of a list, keeping each triangle's corners in order.
+    void shuffleTriangles(std::vector<uint32_t>& indices, uint32_t seed)
+    {
+        std::vector<Triangle> triangles;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            triangles.push_back({ indices[i], indices[i + 1], indices[i + 2] });
+        }
+        std::shuffle(triangles.begin(), triangles.end(), std::mt19937(seed));
+        indices.clear();
+        for (const Triangle& triangle : triangles) {
+            indices.insert(indices.end(), triangle.begin(), triangle.end());
+        }
+    }
+
+    /// The triangles as a sorted list, each rotated to start at its smallest index so the winding is kept.
+    std::vector<Triangle> triangleSet(const uint32_t* indices, size_t count)
+    {
+        std::vector<Triangle> triangles;
+        for (size_t i = 0; i < count; i += 3) {
+            Triangle triangle = { indices[i], indices[i + 1], indices[i + 2] };
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+            triangles.push_back(triangle);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    /// Like triangleSet(), but by vertex position, which survives vertex renumbering.
+    std::vector<PositionTriangle> positionTriangleSet(const MeshData& mesh, const MeshLod& lod)
+    {
+        std::vector<PositionTriangle> triangles;
+        for (uint32_t i = lod.firstIndex; i < lod.firstIndex + lod.indexCount; i += 3) {
+            PositionTriangle triangle;
+            for (int corner = 0; corner < 3; corner++) {
+                const glm::vec3& position = mesh.vertices[mesh.indices[i + corner]].pos;
+                triangle[corner] = std::make_tuple(position.x, position.y, position.z);
+            }
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+            triangles.push_back(triangle);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    float acmr(const std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        return MeshOptimizer::AnalyzeVertexCache(indices.data(), indices.size(), static_cast<uint32_t>(vertexCount)).acmr;
+    }
+}
+
+// =================================================================================
+// Vertex Cache
+// =================================================================================
+
+TEST_CASE(VertexCacheKeepsTheTrianglesAndLowersAcmr)
+{
+    for (bool shuffled : { false, true }) {
+        MeshData mesh = makeSphere(64);
+        if (shuffled) {
+            shuffleTriangles(mesh.indices, 11);
+        }
+        std::vector<uint32_t> indices = mesh.indices;
+        const uint32_t vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+        MeshOptimizer::OptimizeVertexCache(indices.data(), indices.size(), vertexCount);
+
+        CHECK(triangleSet(indices.data(), indices.size()) == triangleSet(mesh.indices.data(), mesh.indices.size()));
+        CHECK(acmr(indices, vertexCount) <= acmr(mesh.indices, vertexCount));
+        CHECK(acmr(indices, vertexCount) < 0.8f); // A regular grid allows about 0.6 with a 16-entry cache
+    }
+}
+
+TEST_CASE(AnalyzeVertexCacheCountsMisses)
+{
+    // Two triangles sharing an edge: 4 misses, 4 vertices
+    const std::vector<uint32_t> quad = { 0, 1, 2, 2, 1, 3 };
+    VertexCacheStats stats = MeshOptimizer::AnalyzeVertexCache(quad.data(), quad.size(), 4);
+    CHECK_EQ(stats.acmr, 2.0f);
+    CHECK_EQ(stats.atvr, 1.0f);
+
+    // Repeating the quad once the cache has rotated costs the misses again
+    std::vector<uint32_t> list = quad;
+    for (uint32_t i = 0; i < MeshOptimizer::CacheSize; i++) {
+        list.insert(list.end(), { 4 + 3 * i, 5 + 3 * i, 6 + 3 * i });
+    }
+    list.insert(list.end(), quad.begin(), quad.end());
+    stats = MeshOptimizer::AnalyzeVertexCache(list.data(), list.size(), 4 + 3 * MeshOptimizer::CacheSize);
+    CHECK_EQ(stats.acmr * (list.size() / 3), 4.0f + 3.0f * MeshOptimizer::CacheSize + 4.0f);
+}
+
+// =================================================================================
+// Overdraw
+// =================================================================================
+
+TEST_CASE(OverdrawKeepsTheTrianglesWithinTheThreshold)
+{
+    MeshData mesh = makeSphere(64);
+    shuffleTriangles(mesh.indices, 12);
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    std::vector<uint32_t> cacheOrdered = mesh.indices;
+    MeshOptimizer::OptimizeVertexCache(cacheOrdered.data(), cacheOrdered.size(), vertexCount);
+
+    for (float threshold : { 1.0f, MeshOptimizer::DefaultOverdrawThreshold, 1.5f }) {
+        std::vector<uint32_t> indices = cacheOrdered;
+        MeshOptimizer::OptimizeOverdraw(indices.data(), indices.size(), mesh.vertices, threshold);
+        CHECK(triangleSet(indices.data(), indices.size()) == triangleSet(mesh.indices.data(), mesh.indices.size()));
+        CHECK(acmr(indices, vertexCount) <= acmr(cacheOrdered, vertexCount) * threshold * 1.0001f);
+    }
+}
+
+// =================================================================================
+// Whole Mesh
+// =================================================================================
+
+TEST_CASE(OptimizeKeepsEveryLevelsTriangles)
+{
+    // Two levels: all triangles, then every other one; the vertices only the first level uses stay
+    MeshData mesh = makeSphere(48);
+    shuffleTriangles(mesh.indices, 13);
+    const uint32_t fineCount = static_cast<uint32_t>(mesh.indices.size());
+    for (uint32_t i = 0; i < fineCount; i += 6) {
+        mesh.indices.insert(mesh.indices.end(), mesh.indices.begin() + i, mesh.indices.begin() + i + 3);
+    }
+    mesh.lods = { { 0, fineCount, 0.0f }, { fineCount, static_cast<uint32_t>(mesh.indices.size()) - fineCount, 0.1f } };
+
+    // An unused vertex is dropped
+    mesh.vertices.push_back({ glm::vec3(5.0f), glm::vec3(1.0f) });
+    const size_t usedVertices = mesh.vertices.size() - 1;
+
+    MeshData original = mesh;
+    MeshOptimizer::Optimize(mesh);
+
+    CHECK_EQ(mesh.vertices.size(), usedVertices);
+    CHECK_EQ(mesh.indices.size(), original.indices.size());
+    for (size_t lod = 0; lod < mesh.lods.size(); lod++) {
+        CHECK_EQ(mesh.lods[lod].firstIndex, original.lods[lod].firstIndex);
+        CHECK_EQ(mesh.lods[lod].indexCount, original.lods[lod].indexCount);
+        CHECK(positionTriangleSet(mesh, mesh.lods[lod]) == positionTriangleSet(original, original.lods[lod]));
+    }
+
+    std::vector<uint32_t> fineBefore(original.indices.begin(), original.indices.begin() + fineCount);
+    std::vector<uint32_t> fineAfter(mesh.indices.begin(), mesh.indices.begin() + fineCount);
+    CHECK(acmr(fineAfter, mesh.vertices.size()) <= acmr(fineBefore, original.vertices.size()));
+
+    // Vertices are numbered in order of first use
+    uint32_t next = 0;
+    bool sequential = true;
+    for (uint32_t index : mesh.indices) {
+        sequential = sequential && index <= next;
+        next = std::max(next, index + 1);
+    }
+    CHECK(sequential);
+}
+
+TEST_CASE(OptimizingTwiceDoesNotGetWorse)
+{
+    // The input is already well ordered; whatever the heuristics do, the result is not worse than that
+    MeshData mesh = makeSphere(64);
+    shuffleTriangles(mesh.indices, 14);
+    MeshOptimizer::Optimize(mesh);
+    const float optimized = acmr(mesh.indices, mesh.vertices.size());
+    const std::vector<PositionTriangle> triangles = positionTriangleSet(mesh, mesh.lods[0]);
+
+    for (float threshold : { 1.0f, 3.0f }) {
+        MeshOptimizer::Optimize(mesh, threshold);
+        CHECK(acmr(mesh.indices, mesh.vertices.size()) <= optimized);
+        CHECK(positionTriangleSet(mesh, mesh.lods[0]) == triangles);
+    }
+}
+
+int main()
+{
+    return Test::RunAll();
+}
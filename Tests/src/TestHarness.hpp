@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdio>
+#include <exception>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file TestHarness.hpp
+ * @brief A minimal unit-test harness for the CPU-only tests, without external dependencies.
+ *
+ * Each test executable defines its cases with TEST_CASE() and runs them from
+ * main() with Test::RunAll(). A failed CHECK reports the file and line and
+ * lets the case continue; an exception escaping a case fails it.
+ */
+namespace Test
+{
+    struct Case
+    {
+        const char* name;
+        void (*function)();
+    };
+
+    inline std::vector<Case>& GetCases()
+    {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    inline int& GetFailureCount()
+    {
+        static int failures = 0;
+        return failures;
+    }
+
+    /// @brief Adds a case to the executable's list at static initialization time.
+    struct Registrar
+    {
+        Registrar(const char* name, void (*function)()) { GetCases().push_back({ name, function }); }
+    };
+
+    inline void Fail(const char* file, int line, const std::string& message)
+    {
+        std::fprintf(stderr, "%s:%d: FAILED: %s\n", file, line, message.c_str());
+        GetFailureCount()++;
+    }
+
+    template <typename A, typename B>
+    void CheckEqual(const A& actual, const B& expected, const char* actualText, const char* expectedText, const char* file, int line)
+    {
+        if (!(actual == expected)) {
+            std::ostringstream message;
+            message << actualText << " == " << expectedText << " (" << actual << " vs " << expected << ")";
+            Fail(file, line, message.str());
+        }
+    }
+
+    /**
+     * @brief Runs every registered case.
+     * @return The process exit code: 0 if all checks passed, 1 otherwise.
+     */
+    inline int RunAll()
+    {
+        int failedCases = 0;
+        for (const Case& testCase : GetCases()) {
+            int failuresBefore = GetFailureCount();
+            try {
+                testCase.function();
+            } catch (const std::exception& e) {
+                Fail(__FILE__, __LINE__, std::string("unexpected exception: ") + e.what());
+            }
+            bool passed = GetFailureCount() == failuresBefore;
+            failedCases += passed ? 0 : 1;
+            std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", testCase.name);
+        }
+        std::printf("%zu cases, %d failed\n", GetCases().size(), failedCases);
+        return failedCases == 0 ? 0 : 1;
+    }
+}
+
+#define TEST_CASE(name)                                            \
+    static void name();                                            \
+    static const Test::Registrar name##Registrar(#name, &name);    \
+    static void name()
+
+#define CHECK(condition)                                           \
+    do {                                                           \
+        if (!(condition)) {                                        \
+            Test::Fail(__FILE__, __LINE__, #condition);            \
+        }                                                          \
+    } while (0)
+
+#define CHECK_EQ(actual, expected) Test::CheckEqual((actual), (expected), #actual, #expected, __FILE__, __LINE__)
+
+#define CHECK_THROWS(expression, exceptionType)                                         \
+    do {                                                                                \
+        bool thrown = false;                                                            \
+        try {                                                                           \
+            expression;                                                                 \
+        } catch (const exceptionType&) {                                                \
+            thrown = true;                                                              \
+        }                                                                               \
+        if (!thrown) {                                                                  \
+            Test::Fail(__FILE__, __LINE__, #expression " did not throw " #exceptionType); \
+        }                                                                               \
+    } while (0)
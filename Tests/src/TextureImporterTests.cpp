@@ -0,0 +1,111 @@
+#include "EngineCore/Assets/TextureImporter.hpp"
+#include "TestHarness.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    /// A single 4x4 level holding one block of the given format.
+    TextureData makeBlockTexture(VkFormat format, std::vector<uint8_t> block)
+    {
+        TextureData texture;
+        texture.name = "block";
+        texture.format = format;
+        texture.width = 4;
+        texture.height = 4;
+        TextureLevel level;
+        level.width = 4;
+        level.height = 4;
+        level.size = block.size();
+        level.data = std::move(block);
+        texture.levels.push_back(std::move(level));
+        return texture;
+    }
+
+    /// A BC4 block whose sixteen texels all use the same palette index.
+    std::vector<uint8_t> channelBlock(uint8_t endpoint0, uint8_t endpoint1, uint32_t index)
+    {
+        std::vector<uint8_t> block = { endpoint0, endpoint1, 0, 0, 0, 0, 0, 0 };
+        uint64_t indices = 0;
+        for (int i = 0; i < 16; i++) {
+            indices |= static_cast<uint64_t>(index) << (3 * i);
+        }
+        for (int i = 0; i < 6; i++) {
+            block[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+        }
+        return block;
+    }
+
+    int8_t signedTexel(const TextureData& texture, size_t channel)
+    {
+        return static_cast<int8_t>(texture.levels[0].data[channel]);
+    }
+}
+
+// =================================================================================
+// Decompression
+// =================================================================================
+
+TEST_CASE(Bc4UnormDecodesToUnorm)
+{
+    TextureData texture = makeBlockTexture(VK_FORMAT_BC4_UNORM_BLOCK, channelBlock(200, 100, 0));
+    CHECK(TextureImporter::Decompress(texture));
+    CHECK_EQ(texture.format, VK_FORMAT_R8G8B8A8_UNORM);
+    CHECK_EQ(texture.levels[0].data.size(), size_t(64));
+    CHECK_EQ(int(texture.levels[0].data[0]), 200);
+    CHECK_EQ(int(texture.levels[0].data[3]), 255);
+}
+
+TEST_CASE(Bc4SnormKeepsItsSign)
+{
+    // Endpoints -100 and 50, so the first palette entry is negative
+    TextureData texture = makeBlockTexture(VK_FORMAT_BC4_SNORM_BLOCK, channelBlock(static_cast<uint8_t>(-100), 50, 0));
+    CHECK(TextureImporter::Decompress(texture));
+    CHECK_EQ(texture.format, VK_FORMAT_R8G8B8A8_SNORM);
+    CHECK_EQ(int(signedTexel(texture, 0)), -100);
+    CHECK_EQ(int(signedTexel(texture, 3)), 127);
+}
+
+TEST_CASE(Bc4SnormSixValueModeUsesSignedExtremes)
+{
+    // a0 <= a1 selects the six-value mode, where indices 6 and 7 are -1.0 and 1.0
+    TextureData low = makeBlockTexture(VK_FORMAT_BC4_SNORM_BLOCK, channelBlock(10, 20, 6));
+    TextureData high = makeBlockTexture(VK_FORMAT_BC4_SNORM_BLOCK, channelBlock(10, 20, 7));
+    CHECK(TextureImporter::Decompress(low));
+    CHECK(TextureImporter::Decompress(high));
+    CHECK_EQ(int(signedTexel(low, 0)), -127);
+    CHECK_EQ(int(signedTexel(high, 0)), 127);
+}
+
+TEST_CASE(Bc4SnormClampsMinusOneTwentyEight)
+{
+    TextureData texture = makeBlockTexture(VK_FORMAT_BC4_SNORM_BLOCK, channelBlock(static_cast<uint8_t>(-128), 0, 0));
+    CHECK(TextureImporter::Decompress(texture));
+    CHECK_EQ(int(signedTexel(texture, 0)), -127);
+}
+
+TEST_CASE(Bc5SnormDecodesBothChannels)
+{
+    std::vector<uint8_t> block = channelBlock(static_cast<uint8_t>(-64), 0, 0);
+    std::vector<uint8_t> green = channelBlock(64, 0, 0);
+    block.insert(block.end(), green.begin(), green.end());
+    TextureData texture = makeBlockTexture(VK_FORMAT_BC5_SNORM_BLOCK, block);
+    CHECK(TextureImporter::Decompress(texture));
+    CHECK_EQ(texture.format, VK_FORMAT_R8G8B8A8_SNORM);
+    CHECK_EQ(int(signedTexel(texture, 0)), -64);
+    CHECK_EQ(int(signedTexel(texture, 1)), 64);
+    CHECK_EQ(int(signedTexel(texture, 2)), 0);
+}
+
+TEST_CASE(Bc7IsLeftForTheGpu)
+{
+    TextureData texture = makeBlockTexture(VK_FORMAT_BC7_UNORM_BLOCK, std::vector<uint8_t>(16, 0));
+    CHECK(!TextureImporter::Decompress(texture));
+    CHECK_EQ(texture.format, VK_FORMAT_BC7_UNORM_BLOCK);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
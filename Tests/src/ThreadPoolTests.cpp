@@ -0,0 +1,152 @@
+#include "EngineCore/ThreadPool.hpp"
+#include "TestHarness.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /// Occupies a worker until Release() is called.
+    class Blocker
+    {
+    public:
+        Blocker(ThreadPool& pool, JobPriority priority)
+        {
+            std::shared_future<void> released = m_release.get_future().share();
+            m_done = pool.Submit([this, released]() {
+                m_started.set_value();
+                released.wait();
+            }, priority);
+            m_started.get_future().wait();
+        }
+
+        ~Blocker() { Release(); }
+
+        void Release()
+        {
+            if (!m_released) {
+                m_released = true;
+                m_release.set_value();
+                m_done.wait();
+            }
+        }
+
+    private:
+        std::promise<void> m_started;
+        std::promise<void> m_release;
+        std::future<void> m_done;
+        bool m_released = false;
+    };
+}
+
+// =================================================================================
+// ParallelFor
+// =================================================================================
+
+TEST_CASE(ParallelForVisitsEveryItemOnce)
+{
+    ThreadPool pool(3);
+    std::vector<std::atomic<int>> visits(10007);
+    uint32_t batches = pool.ParallelFor(visits.size(), 16, [&visits](uint32_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            visits[i]++;
+        }
+    });
+    CHECK_EQ(batches, 4u);
+    int wrong = 0;
+    for (const std::atomic<int>& count : visits) {
+        wrong += count.load() == 1 ? 0 : 1;
+    }
+    CHECK_EQ(wrong, 0);
+}
+
+TEST_CASE(ParallelForRunsEveryBatchIndexOnce)
+{
+    ThreadPool pool(3);
+    std::mutex mutex;
+    std::vector<uint32_t> seen;
+    uint32_t batches = pool.ParallelFor(400, 100, [&](uint32_t batch, size_t, size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        seen.push_back(batch);
+    });
+    CHECK_EQ(batches, 4u);
+    CHECK_EQ(seen.size(), 4u);
+    for (uint32_t batch = 0; batch < batches; batch++) {
+        CHECK_EQ(std::count(seen.begin(), seen.end(), batch), 1);
+    }
+}
+
+TEST_CASE(ParallelForDoesNotWaitForBusyWorkers)
+{
+    // Every worker is stuck in a background job; the caller must still finish all batches itself
+    ThreadPool pool(2);
+    Blocker first(pool, JobPriority::Background);
+    Blocker second(pool, JobPriority::Background);
+
+    std::atomic<size_t> items{ 0 };
+    auto start = std::chrono::steady_clock::now();
+    uint32_t batches = pool.ParallelFor(3000, 1, [&items](uint32_t, size_t begin, size_t end) { items += end - begin; });
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    CHECK_EQ(batches, 3u);
+    CHECK_EQ(items.load(), 3000u);
+    CHECK(elapsed < std::chrono::seconds(5));
+}
+
+TEST_CASE(ParallelForRethrowsBatchExceptions)
+{
+    ThreadPool pool(2);
+    CHECK_THROWS(pool.ParallelFor(300, 1, [](uint32_t batch, size_t, size_t) {
+        if (batch == 2) {
+            throw std::runtime_error("batch failed");
+        }
+    }), std::runtime_error);
+
+    // The pool stays usable
+    std::atomic<size_t> items{ 0 };
+    pool.ParallelFor(300, 1, [&items](uint32_t, size_t begin, size_t end) { items += end - begin; });
+    CHECK_EQ(items.load(), 300u);
+}
+
+// =================================================================================
+// Priorities
+// =================================================================================
+
+TEST_CASE(NormalJobsRunBeforeQueuedBackgroundJobs)
+{
+    ThreadPool pool(1);
+    Blocker blocker(pool, JobPriority::Normal);
+
+    std::mutex mutex;
+    std::string order;
+    auto record = [&mutex, &order](char job) {
+        std::lock_guard<std::mutex> lock(mutex);
+        order += job;
+    };
+    std::future<void> background = pool.Submit([&record]() { record('b'); }, JobPriority::Background);
+    std::future<void> normal = pool.Submit([&record]() { record('n'); });
+    blocker.Release();
+    background.get();
+    normal.get();
+    CHECK_EQ(order, std::string("nb"));
+}
+
+TEST_CASE(SubmitReturnsResultsAndExceptions)
+{
+    ThreadPool pool(2);
+    std::future<int> value = pool.Submit([]() { return 42; }, JobPriority::Background);
+    std::future<int> failure = pool.Submit([]() -> int { throw std::runtime_error("job failed"); });
+    CHECK_EQ(value.get(), 42);
+    CHECK_THROWS(failure.get(), std::runtime_error);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
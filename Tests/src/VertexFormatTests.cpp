@@ -0,0 +1,109 @@
+#include "EngineCore/Assets/VertexFormat.hpp"
+#include "TestHarness.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace
+{
+    /// The exact value of a half float (IEEE 754 binary16).
+    float halfToFloat(uint16_t half)
+    {
+        const float sign = (half & 0x8000u) ? -1.0f : 1.0f;
+        const int exponent = (half >> 10) & 0x1f;
+        const int mantissa = half & 0x3ff;
+        if (exponent == 0x1f) {
+            return mantissa ? std::numeric_limits<float>::quiet_NaN() : sign * std::numeric_limits<float>::infinity();
+        }
+        if (exponent == 0) {
+            return sign * std::ldexp(static_cast<float>(mantissa), -24); // Subnormal
+        }
+        return sign * std::ldexp(static_cast<float>(mantissa + 0x400), exponent - 25);
+    }
+
+    bool isNaN(uint16_t half)
+    {
+        return (half & 0x7c00u) == 0x7c00u && (half & 0x3ffu) != 0;
+    }
+
+    constexpr uint16_t PositiveInfinity = 0x7c00;
+    constexpr uint16_t NegativeInfinity = 0xfc00;
+    constexpr uint16_t LargestHalf = 0x7bff;      // 65504
+    constexpr uint16_t SmallestSubnormal = 0x0001; // 2^-24
+    constexpr uint16_t LargestSubnormal = 0x03ff;
+    constexpr uint16_t SmallestNormal = 0x0400;    // 2^-14
+}
+
+// =================================================================================
+// FloatToHalf
+// =================================================================================
+
+TEST_CASE(EveryHalfRoundTrips)
+{
+    // Zeros, subnormals, normals and both infinities convert back to the same bits
+    int mismatches = 0;
+    for (uint32_t bits = 0; bits <= 0xffff; bits++) {
+        uint16_t half = static_cast<uint16_t>(bits);
+        if (!isNaN(half) && VertexFormat::FloatToHalf(halfToFloat(half)) != half) {
+            mismatches++;
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+TEST_CASE(InfinityAndNaN)
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+    CHECK_EQ(VertexFormat::FloatToHalf(infinity), PositiveInfinity);
+    CHECK_EQ(VertexFormat::FloatToHalf(-infinity), NegativeInfinity);
+    CHECK(isNaN(VertexFormat::FloatToHalf(std::numeric_limits<float>::quiet_NaN())));
+    CHECK(isNaN(VertexFormat::FloatToHalf(-std::numeric_limits<float>::quiet_NaN())));
+
+    // Finite floats beyond the half range overflow to infinity; halfway to 65536 is the first that does
+    CHECK_EQ(VertexFormat::FloatToHalf(65519.0f), LargestHalf);
+    CHECK_EQ(VertexFormat::FloatToHalf(65520.0f), PositiveInfinity);
+    CHECK_EQ(VertexFormat::FloatToHalf(-1e10f), NegativeInfinity);
+    CHECK_EQ(VertexFormat::FloatToHalf(std::numeric_limits<float>::max()), PositiveInfinity);
+}
+
+TEST_CASE(SubnormalsAndUnderflow)
+{
+    const float smallest = halfToFloat(SmallestSubnormal);
+    CHECK_EQ(VertexFormat::FloatToHalf(smallest), SmallestSubnormal);
+    CHECK_EQ(VertexFormat::FloatToHalf(-smallest), static_cast<uint16_t>(0x8000u | SmallestSubnormal));
+
+    // Half the smallest subnormal is a tie and rounds to even (zero), anything above it rounds up
+    CHECK_EQ(VertexFormat::FloatToHalf(smallest * 0.5f), static_cast<uint16_t>(0));
+    CHECK_EQ(VertexFormat::FloatToHalf(std::nextafter(smallest * 0.5f, 1.0f)), SmallestSubnormal);
+    CHECK_EQ(VertexFormat::FloatToHalf(smallest * 0.25f), static_cast<uint16_t>(0));
+    CHECK_EQ(VertexFormat::FloatToHalf(-smallest * 0.25f), static_cast<uint16_t>(0x8000));
+
+    // Float subnormals are far below the half range
+    CHECK_EQ(VertexFormat::FloatToHalf(std::numeric_limits<float>::denorm_min()), static_cast<uint16_t>(0));
+
+    // The largest subnormal rounds up into the smallest normal across the boundary
+    const float boundary = (halfToFloat(LargestSubnormal) + halfToFloat(SmallestNormal)) * 0.5f;
+    CHECK_EQ(VertexFormat::FloatToHalf(std::nextafter(boundary, 0.0f)), LargestSubnormal);
+    CHECK_EQ(VertexFormat::FloatToHalf(boundary), SmallestNormal); // Tie, and 0x0400 is even
+}
+
+TEST_CASE(RoundsToNearestWithTiesToEven)
+{
+    // Midpoints between neighbouring finite halves are exact floats
+    int mismatches = 0;
+    for (uint32_t bits = 0; bits < LargestHalf; bits++) {
+        uint16_t half = static_cast<uint16_t>(bits);
+        float midpoint = (halfToFloat(half) + halfToFloat(static_cast<uint16_t>(half + 1))) * 0.5f;
+        uint16_t even = (half & 1u) ? static_cast<uint16_t>(half + 1) : half;
+        mismatches += VertexFormat::FloatToHalf(midpoint) == even ? 0 : 1;
+        mismatches += VertexFormat::FloatToHalf(std::nextafter(midpoint, 0.0f)) == half ? 0 : 1;
+        mismatches += VertexFormat::FloatToHalf(std::nextafter(midpoint, 1e9f)) == half + 1 ? 0 : 1;
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+int main()
+{
+    return Test::RunAll();
+}
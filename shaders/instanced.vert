@@ -0,0 +1,26 @@
+#version 450
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec3 a_Color;
+
+// Per-instance attributes (instance-rate binding 1)
+layout(location = 2) in mat4 a_Model; // Occupies locations 2-5
+layout(location = 6) in vec4 a_InstanceColor;
+
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 model;
+    mat4 view;
+    mat4 proj;
+    vec4 positionScale;  // Dequantizes packed positions; (1, 0) for float vertices
+    vec4 positionOffset;
+} ubo;
+
+layout(location = 0) out vec3 v_Color;
+layout(location = 1) out vec3 v_ObjectPosition; // Where the material's textures are projected from
+
+void main() {
+    vec3 position = a_Position * ubo.positionScale.xyz + ubo.positionOffset.xyz;
+    gl_Position = ubo.proj * ubo.view * ubo.model * a_Model * vec4(position, 1.0);
+    v_ObjectPosition = position;
+    v_Color = a_Color * a_InstanceColor.rgb;
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+// Shared by simple.frag and simple_static.frag, which differ only in how sampleAlbedo() indexes the table
+
+layout(location = 0) in vec3 v_Color;
+layout(location = 1) in vec3 v_ObjectPosition;
+
+layout(location = 0) out vec4 o_Color;
+
+// The bindless table (set 1), sized to the BindlessTable's capacity
+layout(constant_id = 0) const uint TEXTURE_CAPACITY = 16;
+layout(set = 1, binding = 0) uniform sampler2D u_Textures[TEXTURE_CAPACITY];
+
+// MaterialConstants
+layout(push_constant) uniform Material {
+    uint albedoTexture;
+    float textureScale;
+} material;
+
+// Samples the material's albedo slot of the table
+vec3 sampleAlbedo(vec2 uv);
+
+void main() {
+    // Meshes have no texture coordinates: project along each object-space axis and blend by the face normal
+    vec3 position = v_ObjectPosition * material.textureScale;
+    vec3 weights = abs(cross(dFdx(v_ObjectPosition), dFdy(v_ObjectPosition)));
+    float weightSum = weights.x + weights.y + weights.z;
+    weights = weightSum > 0.0 ? weights / weightSum : vec3(1.0 / 3.0);
+    vec3 albedo = sampleAlbedo(position.yz) * weights.x +
+                  sampleAlbedo(position.xz) * weights.y +
+                  sampleAlbedo(position.xy) * weights.z;
+    o_Color = vec4(v_Color * albedo, 1.0);
+}
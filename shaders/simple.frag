@@ -1,9 +1,9 @@
 #version 450
+#extension GL_GOOGLE_include_directive : require
 
-layout(location = 0) in vec3 v_Color;
+#include "scene_material.glsl"
 
-layout(location = 0) out vec4 o_Color;
-
-void main() {
-    o_Color = vec4(v_Color, 1.0);
-}
\ No newline at end of file
+// Indexes the table with the push constant, which needs shaderSampledImageArrayDynamicIndexing
+vec3 sampleAlbedo(vec2 uv) {
+    return texture(u_Textures[material.albedoTexture], uv).rgb;
+}
@@ -7,11 +7,16 @@ layout(binding = 0) uniform UniformBufferObject {
     mat4 model;
     mat4 view;
     mat4 proj;
+    vec4 positionScale;  // Dequantizes packed positions; (1, 0) for float vertices
+    vec4 positionOffset;
 } ubo;
 
 layout(location = 0) out vec3 v_Color;
+layout(location = 1) out vec3 v_ObjectPosition; // Where the material's textures are projected from
 
 void main() {
-    gl_Position = ubo.proj * ubo.view * ubo.model * vec4(a_Position, 1.0);
+    vec3 position = a_Position * ubo.positionScale.xyz + ubo.positionOffset.xyz;
+    gl_Position = ubo.proj * ubo.view * ubo.model * vec4(position, 1.0);
+    v_ObjectPosition = position;
     v_Color = a_Color;
 }
\ No newline at end of file
@@ -0,0 +1,19 @@
+#version 450
+#extension GL_GOOGLE_include_directive : require
+
+#include "scene_material.glsl"
+
+// For devices without shaderSampledImageArrayDynamicIndexing: the table is in its fallback mode with
+// FallbackTextureCapacity (16) slots, and every slot is read with a constant index. The push constant
+// is uniform across the draw, so the branch does not diverge and the derivatives stay defined.
+#define ALBEDO_SLOT(slot) case slot: return texture(u_Textures[slot], uv).rgb;
+
+vec3 sampleAlbedo(vec2 uv) {
+    switch (int(material.albedoTexture)) {
+        ALBEDO_SLOT(0)  ALBEDO_SLOT(1)  ALBEDO_SLOT(2)  ALBEDO_SLOT(3)
+        ALBEDO_SLOT(4)  ALBEDO_SLOT(5)  ALBEDO_SLOT(6)  ALBEDO_SLOT(7)
+        ALBEDO_SLOT(8)  ALBEDO_SLOT(9)  ALBEDO_SLOT(10) ALBEDO_SLOT(11)
+        ALBEDO_SLOT(12) ALBEDO_SLOT(13) ALBEDO_SLOT(14) ALBEDO_SLOT(15)
+    }
+    return texture(u_Textures[0], uv).rgb; // The default white texture
+}